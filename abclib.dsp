@@ -627,6 +627,10 @@ SOURCE=.\src\base\io\ioReadEqn.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\base\io\ioReadPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\base\io\ioReadPla.c
 # End Source File
 # Begin Source File
@@ -767,6 +771,10 @@ SOURCE=.\src\base\ver\verFormula.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\base\ver\verPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\base\ver\verParse.c
 # End Source File
 # Begin Source File
@@ -1211,6 +1219,10 @@ SOURCE=.\src\bdd\extrab\extraBddCas.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\bdd\extrab\extraBddGov.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\bdd\extrab\extraBddImage.c
 # End Source File
 # Begin Source File
@@ -3691,6 +3703,10 @@ SOURCE=.\src\opt\mfs\mfsSat.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\opt\mfs\mfsSim.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\opt\mfs\mfsStrash.c
 # End Source File
 # Begin Source File
@@ -6015,6 +6031,10 @@ SOURCE=.\src\aig\gia\giaMuxes.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaNewBdd.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaNewBdd.h
 # End Source File
 # Begin Source File
@@ -6607,6 +6627,10 @@ SOURCE=.\src\proof\dch\dchMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\dch\dchPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\dch\dchSat.c
 # End Source File
 # Begin Source File
@@ -369,6 +369,7 @@ struct Jf_Par_t_
     int            fCutHashing;
     int            fCutSimple;
     int            fCutGroup;
+    int            fLowMem;
     int            fVerbose;
     int            fVeryVerbose;
     int            nLutSizeMax;
@@ -392,6 +393,7 @@ struct Jf_Par_t_
     float *        pTimesArr;
     float *        pTimesReq;
     char *         ZFile;
+    char *         pMatchFile;
 };
 
 static inline unsigned     Gia_ObjCutSign( unsigned ObjId )       { return (1 << (ObjId & 31));                                 }
@@ -1816,6 +1818,9 @@ extern Vec_Int_t *         Gia_ManComputeDistance( Gia_Man_t * p, int iObj, Vec_
 extern Gia_Man_t *         Gia_ManTtopt( Gia_Man_t * p, int nIns, int nOuts, int nRounds );
 extern Gia_Man_t *         Gia_ManTtoptCare( Gia_Man_t * p, int nIns, int nOuts, int nRounds, char * pFileName, int nRarity );
 
+/*=== giaNewBdd.cpp ===========================================================*/
+extern int                 Gia_ManNewBddPar( Gia_Man_t * p, int nThreads, int nQuant, int fCheck, int fVerbose );
+
 /*=== giaTransduction.cpp ===========================================================*/
 extern Gia_Man_t *         Gia_ManTransductionBdd( Gia_Man_t * pGia, int nType, int fMspf, int nRandom, int nSortType, int nPiShuffle, int nParameter, int fLevel, Gia_Man_t * pExdc, int fNewLine, int nVerbose );
 extern Gia_Man_t *         Gia_ManTransductionTt( Gia_Man_t * pGia, int nType, int fMspf, int nRandom, int nSortType, int nPiShuffle, int nParameter, int fLevel, Gia_Man_t * pExdc, int fNewLine, int nVerbose );
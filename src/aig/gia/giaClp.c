@@ -38,6 +38,9 @@ extern int Abc_CountZddCubes( DdManager * dd, DdNode * zCover );
 extern int Abc_NtkDeriveFlatGiaSop( Gia_Man_t * pGia, int * gFanins, char * pSop );
 extern int Gia_ManFactorNode( Gia_Man_t * p, char * pSop, Vec_Int_t * vLeaves );
 
+// the largest number of times the collapsing problem is split along each path
+#define GIA_CLP_SPLIT_MAX  12
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -301,6 +304,181 @@ Vec_Ptr_t * Gia_ManCollapse( Gia_Man_t * p, DdManager * dd, int nBddLimit, int f
     return vFuncs;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Derives global BDDs of the COs for the given CI functions.]
+
+  Description [Similar to Gia_ManCollapse() but the CIs are assigned
+  the given BDDs (variables or constants) and the governor is consulted
+  after each node. Returns the referenced BDDs of the COs, or NULL if 
+  the limits are exceeded.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Gia_ManCollapseCof( Gia_Man_t * p, DdManager * dd, Vec_Ptr_t * vCiFuncs, int nBddLimit, Extra_BddGov_t * pGov )
+{
+    Vec_Ptr_t * vFuncs, * vRes;
+    DdNode * bFunc0, * bFunc1, * bFunc;
+    Gia_Obj_t * pObj;
+    int i, Id;
+    ABC_FREE( p->pRefs );
+    Gia_ManCreateRefs( p );
+    vFuncs = Vec_PtrStart( Gia_ManObjNum(p) );
+    Vec_PtrWriteEntry( vFuncs, 0, Cudd_ReadLogicZero(dd) ), Cudd_Ref(Cudd_ReadLogicZero(dd));
+    Gia_ManForEachCiId( p, Id, i )
+        Vec_PtrWriteEntry( vFuncs, Id, Vec_PtrEntry(vCiFuncs, i) ), Cudd_Ref((DdNode *)Vec_PtrEntry(vCiFuncs, i));
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        bFunc0 = Cudd_NotCond( (DdNode *)Vec_PtrEntry(vFuncs, Gia_ObjFaninId0(pObj, i)), Gia_ObjFaninC0(pObj) );
+        bFunc1 = Cudd_NotCond( (DdNode *)Vec_PtrEntry(vFuncs, Gia_ObjFaninId1(pObj, i)), Gia_ObjFaninC1(pObj) );
+        bFunc  = Cudd_bddAndLimit( dd, bFunc0, bFunc1, nBddLimit );  
+        if ( bFunc == NULL )
+        {
+            Extra_BddGovIsOut( pGov );
+            Gia_ManCollapseDeref( dd, vFuncs );
+            ABC_FREE( p->pRefs );
+            return NULL;
+        }
+        Cudd_Ref( bFunc );
+        Vec_PtrWriteEntry( vFuncs, i, bFunc );
+        Gia_ObjCollapseDeref( p, dd, vFuncs, Gia_ObjFaninId0(pObj, i) );
+        Gia_ObjCollapseDeref( p, dd, vFuncs, Gia_ObjFaninId1(pObj, i) );
+        if ( Extra_BddGovCheck( pGov ) )
+        {
+            Gia_ManCollapseDeref( dd, vFuncs );
+            ABC_FREE( p->pRefs );
+            return NULL;
+        }
+    }
+    vRes = Vec_PtrAlloc( Gia_ManCoNum(p) );
+    Gia_ManForEachCo( p, pObj, i )
+    {
+        bFunc = Cudd_NotCond( (DdNode *)Vec_PtrEntry(vFuncs, Gia_ObjFaninId0p(p, pObj)), Gia_ObjFaninC0(pObj) );
+        Vec_PtrPush( vRes, bFunc );  Cudd_Ref( bFunc );
+    }
+    Gia_ManCollapseDeref( dd, vFuncs );
+    ABC_FREE( p->pRefs );
+    return vRes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives global BDDs of the COs by splitting on the top variables.]
+
+  Description [If the BDDs cannot be built within the limits, the CI
+  whose variable is currently at the top of the order is replaced by 
+  constant 0 and 1 in turn, and the BDDs of the cofactors, which are
+  built one after another, are combined using ITE.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Gia_ManCollapseSplit_rec( Gia_Man_t * p, DdManager * dd, Vec_Ptr_t * vCiFuncs, int nBddLimit, Extra_BddGov_t * pGov, int nSplitMax, int * pnSplits )
+{
+    Vec_Ptr_t * vRes, * vRes0, * vRes1 = NULL;
+    DdNode * bVar, * bFunc, * bFunc0;
+    int i, iCi = -1, Level, LevelBest = ABC_INFINITY;
+    vRes = Gia_ManCollapseCof( p, dd, vCiFuncs, nBddLimit, pGov );
+    if ( vRes != NULL || nSplitMax == 0 )
+        return vRes;
+    // find the free CI with the topmost variable
+    Vec_PtrForEachEntry( DdNode *, vCiFuncs, bVar, i )
+    {
+        if ( Cudd_IsConstant(bVar) )
+            continue;
+        Level = Cudd_ReadPerm( dd, Cudd_Regular(bVar)->index );
+        if ( LevelBest > Level )
+            LevelBest = Level, iCi = i;
+    }
+    if ( iCi == -1 )
+        return NULL;
+    (*pnSplits)++;
+    // compute the cofactors one at a time
+    bVar = (DdNode *)Vec_PtrEntry( vCiFuncs, iCi );
+    Vec_PtrWriteEntry( vCiFuncs, iCi, Cudd_ReadLogicZero(dd) );
+    vRes0 = Gia_ManCollapseSplit_rec( p, dd, vCiFuncs, nBddLimit, pGov, nSplitMax - 1, pnSplits );
+    if ( vRes0 != NULL )
+    {
+        Vec_PtrWriteEntry( vCiFuncs, iCi, Cudd_ReadOne(dd) );
+        vRes1 = Gia_ManCollapseSplit_rec( p, dd, vCiFuncs, nBddLimit, pGov, nSplitMax - 1, pnSplits );
+    }
+    Vec_PtrWriteEntry( vCiFuncs, iCi, bVar );
+    if ( vRes1 == NULL )
+    {
+        if ( vRes0 )
+            Gia_ManCollapseDeref( dd, vRes0 );
+        return NULL;
+    }
+    // combine the cofactors
+    vRes = Vec_PtrAlloc( Vec_PtrSize(vRes0) );
+    Vec_PtrForEachEntry( DdNode *, vRes0, bFunc0, i )
+    {
+        bFunc = Cudd_bddIte( dd, bVar, (DdNode *)Vec_PtrEntry(vRes1, i), bFunc0 );
+        if ( bFunc == NULL )
+        {
+            Extra_BddGovIsOut( pGov );
+            Gia_ManCollapseDeref( dd, vRes );
+            vRes = NULL;
+            break;
+        }
+        Vec_PtrPush( vRes, bFunc );  Cudd_Ref( bFunc );
+    }
+    Gia_ManCollapseDeref( dd, vRes0 );
+    Gia_ManCollapseDeref( dd, vRes1 );
+    return vRes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives global BDDs of the COs within the memory budget.]
+
+  Description [The BDDs are built under the control of the governor,
+  which schedules reordering depending on the growth of the live nodes 
+  and reports when the memory budget (nMemLimitMb, in megabytes) or the
+  limit on the live nodes (nLiveMax) are exceeded. In this case, the 
+  problem is split into cofactors w.r.t. the top variables (up to
+  GIA_CLP_SPLIT_MAX times along each path), which are processed 
+  sequentially.
+  The CIs are mapped into the variables given in vCiFuncs (if NULL, the
+  i-th CI is mapped into the i-th variable). Returns the referenced BDDs
+  of the COs, or NULL if they cannot be built.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Gia_ManCollapseGov( Gia_Man_t * p, DdManager * dd, Vec_Ptr_t * vCiFuncs, int nBddLimit, int nLiveMax, int nMemLimitMb, int fReorder, int fVerbose )
+{
+    Extra_BddGov_t * pGov;
+    Vec_Ptr_t * vRes, * vCiFuncsNew = vCiFuncs;
+    int i, nSplits = 0;
+    abctime clk = Abc_Clock();
+    if ( vCiFuncsNew == NULL )
+    {
+        vCiFuncsNew = Vec_PtrAlloc( Gia_ManCiNum(p) );
+        for ( i = 0; i < Gia_ManCiNum(p); i++ )
+            Vec_PtrPush( vCiFuncsNew, Cudd_bddIthVar(dd, i) );
+    }
+    assert( Vec_PtrSize(vCiFuncsNew) == Gia_ManCiNum(p) );
+    pGov = Extra_BddGovStart( dd, nMemLimitMb, nLiveMax, fReorder, fVerbose );
+    vRes = Gia_ManCollapseSplit_rec( p, dd, vCiFuncsNew, nBddLimit, pGov, GIA_CLP_SPLIT_MAX, &nSplits );
+    Extra_BddGovStop( pGov );
+    if ( vCiFuncsNew != vCiFuncs )
+        Vec_PtrFree( vCiFuncsNew );
+    if ( fVerbose )
+    {
+        printf( "Collapsing %s with %d splits.  ", vRes ? "succeeded" : "failed", nSplits );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    return vRes;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -312,7 +490,7 @@ Vec_Ptr_t * Gia_ManCollapse( Gia_Man_t * p, DdManager * dd, int nBddLimit, int f
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_ManCollapseTest( Gia_Man_t * p, int fVerbose )
+Gia_Man_t * Gia_ManCollapseTest( Gia_Man_t * p, int nMemLimitMb, int fVerbose )
 {
     Gia_Man_t * pNew;
     DdManager * dd, * ddNew;
@@ -321,7 +499,10 @@ Gia_Man_t * Gia_ManCollapseTest( Gia_Man_t * p, int fVerbose )
     // derive global BDDs
     dd = Cudd_Init( Gia_ManCiNum(p), 0, CUDD_UNIQUE_SLOTS, CUDD_CACHE_SLOTS, 0 );
     Cudd_AutodynEnable( dd,  CUDD_REORDER_SYMM_SIFT );
-    vFuncs = Gia_ManCollapse( p, dd, 10000, 0 );
+    if ( nMemLimitMb )
+        vFuncs = Gia_ManCollapseGov( p, dd, NULL, ABC_INFINITY, 0, nMemLimitMb, 1, fVerbose );
+    else
+        vFuncs = Gia_ManCollapse( p, dd, 10000, 0 );
     Cudd_AutodynDisable( dd );
     if ( vFuncs == NULL ) 
     {
@@ -362,7 +543,7 @@ Gia_Man_t * Gia_ManCollapseTest( Gia_Man_t * p, int fVerbose )
 void Gia_ManCollapseTestTest( Gia_Man_t * p )
 {
     Gia_Man_t * pNew;
-    pNew = Gia_ManCollapseTest( p, 0 );
+    pNew = Gia_ManCollapseTest( p, 0, 0 );
     Gia_ManPrintStats( p, NULL );
     Gia_ManPrintStats( pNew, NULL );
     Gia_ManStop( pNew );
@@ -509,7 +690,7 @@ void Gia_ManRecurDsd( Gia_Man_t * p, int fVerbose )
 
 #else
 
-Gia_Man_t * Gia_ManCollapseTest( Gia_Man_t * p, int fVerbose )
+Gia_Man_t * Gia_ManCollapseTest( Gia_Man_t * p, int nMemLimitMb, int fVerbose )
 {
     return NULL;
 }
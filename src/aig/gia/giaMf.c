@@ -76,6 +76,14 @@ struct Mf_Man_t_
     int             iCur;           // current position
     int             Iter;           // mapping iterations
     int             fUseEla;        // use exact area
+    // bounded-memory mode
+    int *           pCutBest;       // best cuts of all nodes
+    Vec_Int_t       vSetRefs;       // the number of fanouts that did not use the cutset
+    Vec_Int_t       vFreeSets;      // free cutsets
+    int             nSetWords;      // the size of one cutset
+    int             nSetsUsed;      // the number of cutsets used
+    int             nSetsPeak;      // the peak number of cutsets used
+    double          nSetInts;       // the number of words in the cutsets of one round
     // statistics
     abctime         clkStart;       // starting time
     double          CutCount[4];    // cut counts
@@ -85,7 +93,7 @@ struct Mf_Man_t_
 static inline Mf_Obj_t * Mf_ManObj( Mf_Man_t * p, int i )            { return p->pLfObjs + i;                                          }
 static inline int *      Mf_ManCutSet( Mf_Man_t * p, int i )         { return (int *)Vec_PtrEntry(&p->vPages, i >> 16) + (i & 0xFFFF); }
 static inline int *      Mf_ObjCutSet( Mf_Man_t * p, int i )         { return Mf_ManCutSet(p, Mf_ManObj(p, i)->iCutSet);               }
-static inline int *      Mf_ObjCutBest( Mf_Man_t * p, int i )        { return Mf_ObjCutSet(p, i) + 1;                                  }
+static inline int *      Mf_ObjCutBest( Mf_Man_t * p, int i )        { return p->pCutBest ? p->pCutBest + i * (p->pPars->nLutSize + 1) : Mf_ObjCutSet(p, i) + 1; }
 
 static inline int        Mf_ObjMapRefNum( Mf_Man_t * p, int i )      { return Mf_ManObj(p, i)->nMapRefs;                               }
 static inline int        Mf_ObjMapRefInc( Mf_Man_t * p, int i )      { return Mf_ManObj(p, i)->nMapRefs++;                             }
@@ -729,16 +737,50 @@ static inline int Mf_ManPrepareCuts( Mf_Cut_t * pCuts, Mf_Man_t * p, int iObj, i
     }
     return Mf_CutCreateUnit( pCuts, iObj );
 }
+static inline int Mf_ManAllocSet( Mf_Man_t * p )
+{
+    if ( Vec_IntSize(&p->vFreeSets) == 0 )
+    {
+        int k, iPage = Vec_PtrSize(&p->vPages);
+        int nSets = ((1<<16) - 2) / p->nSetWords;
+        Vec_PtrPush( &p->vPages, ABC_ALLOC(int, (1<<16)) );
+        for ( k = nSets - 1; k >= 0; k-- )
+            Vec_IntPush( &p->vFreeSets, (iPage << 16) | (2 + k * p->nSetWords) );
+    }
+    p->nSetsPeak = Abc_MaxInt( p->nSetsPeak, ++p->nSetsUsed );
+    return Vec_IntPop( &p->vFreeSets );
+}
+static inline void Mf_ManFreeSet( Mf_Man_t * p, int iObj )
+{
+    Vec_IntPush( &p->vFreeSets, Mf_ManObj(p, iObj)->iCutSet );
+    p->nSetsUsed--;
+}
+static inline void Mf_ManDerefSet( Mf_Man_t * p, int iObj )
+{
+    if ( !Gia_ObjIsAnd(Gia_ManObj(p->pGia, iObj)) )
+        return;
+    assert( Vec_IntEntry(&p->vSetRefs, iObj) > 0 );
+    Vec_IntAddToEntry( &p->vSetRefs, iObj, -1 );
+    if ( Vec_IntEntry(&p->vSetRefs, iObj) == 0 )
+        Mf_ManFreeSet( p, iObj );
+}
 static inline int Mf_ManSaveCuts( Mf_Man_t * p, Mf_Cut_t ** pCuts, int nCuts )
 {
     int i, * pPlace, iCur, nInts = 1;
     for ( i = 0; i < nCuts; i++ )
         nInts += pCuts[i]->nLeaves + 1;
-    if ( (p->iCur & 0xFFFF) + nInts > 0xFFFF )
-        p->iCur = ((p->iCur >> 16) + 1) << 16;
-    if ( Vec_PtrSize(&p->vPages) == (p->iCur >> 16) )
-        Vec_PtrPush( &p->vPages, ABC_ALLOC(int, (1<<16)) );
-    iCur = p->iCur; p->iCur += nInts;
+    if ( p->Iter == 0 )
+        p->nSetInts += nInts;
+    if ( p->pCutBest )
+        iCur = Mf_ManAllocSet( p );
+    else
+    {
+        if ( (p->iCur & 0xFFFF) + nInts > 0xFFFF )
+            p->iCur = ((p->iCur >> 16) + 1) << 16;
+        if ( Vec_PtrSize(&p->vPages) == (p->iCur >> 16) )
+            Vec_PtrPush( &p->vPages, ABC_ALLOC(int, (1<<16)) );
+        iCur = p->iCur; p->iCur += nInts;
+    }
     pPlace = Mf_ManCutSet( p, iCur );
     *pPlace++ = nCuts;
     for ( i = 0; i < nCuts; i++ )
@@ -1397,6 +1439,12 @@ Mf_Man_t * Mf_ManAlloc( Gia_Man_t * pGia, Jf_Par_t * pPars )
     p->pLfObjs   = ABC_CALLOC( Mf_Obj_t, Gia_ManObjNum(pGia) );
     p->iCur      = 2;
     Vec_PtrGrow( &p->vPages, 256 );
+    if ( pPars->fLowMem )
+    {
+        p->pCutBest  = ABC_CALLOC( int, Gia_ManObjNum(pGia) * (pPars->nLutSize + 1) );
+        p->nSetWords = 1 + pPars->nCutNum * (pPars->nLutSize + 1);
+        Vec_IntGrow( &p->vFreeSets, (1<<12) );
+    }
     if ( pPars->fGenCnf || pPars->fGenLit )
     {
         Vec_IntGrow( &p->vCnfSizes, 10000 );
@@ -1423,6 +1471,9 @@ void Mf_ManFree( Mf_Man_t * p )
     ABC_FREE( p->vCnfMem.pArray );
     ABC_FREE( p->vPages.pArray );
     ABC_FREE( p->vTemp.pArray );
+    ABC_FREE( p->vSetRefs.pArray );
+    ABC_FREE( p->vFreeSets.pArray );
+    ABC_FREE( p->pCutBest );
     ABC_FREE( p->pLfObjs );
     ABC_FREE( p );
 }
@@ -1490,6 +1541,7 @@ void Mf_ManPrintInit( Mf_Man_t * p )
     printf( "Coarse = %d  ",  p->pPars->fCoarsen );
     printf( "CNF = %d  ",     p->pPars->fGenCnf );
     printf( "FFL = %d  ",     p->pPars->fGenLit );
+    printf( "LowMem = %d  ",  p->pPars->fLowMem );
     printf( "\n" );
     printf( "Computing cuts...\r" );
     fflush( stdout );
@@ -1499,6 +1551,7 @@ void Mf_ManPrintQuit( Mf_Man_t * p, Gia_Man_t * pNew )
     float MemGia   = Gia_ManMemory(p->pGia) / (1<<20);
     float MemMan   = 1.0 * sizeof(Mf_Obj_t) * Gia_ManObjNum(p->pGia) / (1<<20);
     float MemCuts  = 1.0 * sizeof(int) * (1 << 16) * Vec_PtrSize(&p->vPages) / (1<<20);
+    float MemBest  = p->pCutBest ? 1.0 * sizeof(int) * (p->pPars->nLutSize + 1) * Gia_ManObjNum(p->pGia) / (1<<20) : 0;
     float MemTt    = p->vTtMem ? Vec_MemMemory(p->vTtMem) / (1<<20) : 0;
     float MemMap   = Vec_IntMemory(pNew->vMapping) / (1<<20);
     if ( p->CutCount[0] == 0 )
@@ -1515,8 +1568,15 @@ void Mf_ManPrintQuit( Mf_Man_t * p, Gia_Man_t * pNew )
     printf( "Cut = %.2f MB   ",         MemCuts );
     printf( "Map = %.2f MB  ",          MemMap ); 
     printf( "TT = %.2f MB  ",           MemTt ); 
-    printf( "Total = %.2f MB",          MemGia + MemMan + MemCuts + MemMap + MemTt ); 
+    printf( "Total = %.2f MB",          MemGia + MemMan + MemCuts + MemBest + MemMap + MemTt ); 
     printf( "\n" );
+    if ( p->pCutBest )
+    {
+        printf( "Bounded memory: Best = %.2f MB  ", MemBest );
+        printf( "Peak cutsets = %d (%.2f %%)  ", p->nSetsPeak, 100.0 * p->nSetsPeak / Abc_MaxInt(1, Gia_ManAndNum(p->pGia)) );
+        printf( "Cut memory = %.2f MB  ", MemCuts + MemBest );
+        printf( "Default = %.2f MB\n", 1.0 * sizeof(int) * p->nSetInts / (1<<20) );
+    }
     if ( 1 )
     {
         int i;
@@ -1819,6 +1879,59 @@ void Mf_ManComputeMapping( Mf_Man_t * p )
     Mf_ManSetMapRefs( p );
     Mf_ManPrintStats( p, (char *)(p->fUseEla ? "Ela  " : (p->Iter ? "Area " : "Delay")) );
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Technology mappping with bounded memory.]
+
+  Description [Recomputes the cuts in each round. The cutset of a node
+  is kept only until the cuts of all its fanouts are computed. After
+  this, the memory is recycled while the best cut is saved separately.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Mf_ManSetSetRefs( Mf_Man_t * p )
+{
+    int i;
+    Vec_IntFill( &p->vSetRefs, Gia_ManObjNum(p->pGia), 0 );
+    Gia_ManForEachAndId( p->pGia, i )
+    {
+        Vec_IntAddToEntry( &p->vSetRefs, Gia_ObjFaninId0(Gia_ManObj(p->pGia, i), i), 1 );
+        Vec_IntAddToEntry( &p->vSetRefs, Gia_ObjFaninId1(Gia_ManObj(p->pGia, i), i), 1 );
+        if ( Gia_ObjSibl(p->pGia, i) )
+            Vec_IntAddToEntry( &p->vSetRefs, Gia_ObjSibl(p->pGia, i), 1 );
+        if ( Gia_ObjIsMuxId(p->pGia, i) )
+            Vec_IntAddToEntry( &p->vSetRefs, Gia_ObjFaninId2(p->pGia, i), 1 );
+    }
+}
+void Mf_ManComputeMappingLowMem( Mf_Man_t * p )
+{
+    int i, * pCut, nSize = p->pPars->nLutSize + 1;
+    Mf_ManSetSetRefs( p );
+    Gia_ManForEachAndId( p->pGia, i )
+    {
+        Mf_ObjMergeOrder( p, i );
+        if ( p->Iter )
+            Mf_ObjComputeBestCut( p, i );
+        pCut = Mf_ObjCutSet(p, i) + 1;
+        memcpy( p->pCutBest + i * nSize, pCut, sizeof(int) * (Mf_CutSize(pCut) + 1) );
+        // recycle the cutsets that are no longer needed
+        Mf_ManDerefSet( p, Gia_ObjFaninId0(Gia_ManObj(p->pGia, i), i) );
+        Mf_ManDerefSet( p, Gia_ObjFaninId1(Gia_ManObj(p->pGia, i), i) );
+        if ( Gia_ObjSibl(p->pGia, i) )
+            Mf_ManDerefSet( p, Gia_ObjSibl(p->pGia, i) );
+        if ( Gia_ObjIsMuxId(p->pGia, i) )
+            Mf_ManDerefSet( p, Gia_ObjFaninId2(p->pGia, i) );
+        if ( Vec_IntEntry(&p->vSetRefs, i) == 0 )
+            Mf_ManFreeSet( p, i );
+    }
+    assert( p->nSetsUsed == 0 );
+    Mf_ManSetMapRefs( p );
+    Mf_ManPrintStats( p, (char *)(p->fUseEla ? "Ela  " : (p->Iter ? "Area " : "Delay")) );
+}
 Gia_Man_t * Mf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars )
 {
     Mf_Man_t * p;
@@ -1836,12 +1949,23 @@ Gia_Man_t * Mf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars )
         printf( "Derived " );  Gia_ManPrintMuxStats( pCls );  printf( "\n" );
     }
     Mf_ManPrintInit( p );
-    Mf_ManComputeCuts( p );
-    for ( p->Iter = 1; p->Iter < p->pPars->nRounds; p->Iter++ )
-        Mf_ManComputeMapping( p );
-    p->fUseEla = 1;
-    for ( ; p->Iter < p->pPars->nRounds + pPars->nRoundsEla; p->Iter++ )
-        Mf_ManComputeMapping( p );
+    if ( pPars->fLowMem )
+    {
+        for ( p->Iter = 0; p->Iter < Abc_MaxInt(1, p->pPars->nRounds); p->Iter++ )
+            Mf_ManComputeMappingLowMem( p );
+        p->fUseEla = 1;
+        for ( ; p->Iter < p->pPars->nRounds + pPars->nRoundsEla; p->Iter++ )
+            Mf_ManComputeMappingLowMem( p );
+    }
+    else
+    {
+        Mf_ManComputeCuts( p );
+        for ( p->Iter = 1; p->Iter < p->pPars->nRounds; p->Iter++ )
+            Mf_ManComputeMapping( p );
+        p->fUseEla = 1;
+        for ( ; p->Iter < p->pPars->nRounds + pPars->nRoundsEla; p->Iter++ )
+            Mf_ManComputeMapping( p );
+    }
     //Mf_ManOptimization( p );
     if ( pPars->fVeryVerbose && pPars->fCutMin )
         Vec_MemDumpTruthTables( p->vTtMem, Gia_ManName(p->pGia), pPars->nLutSize );
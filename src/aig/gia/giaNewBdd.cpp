@@ -0,0 +1,161 @@
+/**CFile****************************************************************
+
+  FileName    [giaNewBdd.cpp]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Building global BDDs with the thread-safe mode of NewBdd.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: giaNewBdd.cpp,v 1.00 2026/10/18 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include <unordered_map>
+
+#include "gia.h"
+#include "giaNewBdd.h"
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Builds the BDDs of the COs and quantifies the first CIs.]
+
+  Description [The AND nodes are built by And, because most of them are
+  too small to pay for starting the threads. The quantification of the
+  COs is done by ExistPar, which splits the top levels of the recursion
+  among nThreads threads when nThreads > 1. Returns the BDDs of the COs
+  after quantification.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_ManNewBddBuild( Gia_Man_t * p, NewBdd::Man & Man, int nQuant, std::vector<NewBdd::lit> & vCos )
+{
+    std::vector<NewBdd::lit> vLits( Gia_ManObjNum(p) );
+    Gia_Obj_t * pObj; int i;
+    vLits[0] = 0;
+    Gia_ManForEachCi( p, pObj, i )
+        vLits[Gia_ObjId(p, pObj)] = Man.IthVar( i );
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        NewBdd::lit x0 = Man.LitNotCond( vLits[Gia_ObjFaninId0(pObj, i)], Gia_ObjFaninC0(pObj) );
+        if ( Gia_ObjIsBuf(pObj) )
+            vLits[i] = x0;
+        else
+            vLits[i] = Man.And( x0, Man.LitNotCond( vLits[Gia_ObjFaninId1(pObj, i)], Gia_ObjFaninC1(pObj) ) );
+    }
+    // the cube of the first nQuant CIs
+    NewBdd::lit c = 1;
+    for ( i = Abc_MinInt(nQuant, Gia_ManCiNum(p)) - 1; i >= 0; i-- )
+        c = Man.And( c, Man.IthVar(i) );
+    vCos.clear();
+    Gia_ManForEachCo( p, pObj, i )
+    {
+        NewBdd::lit x = Man.LitNotCond( vLits[Gia_ObjFaninId0p(p, pObj)], Gia_ObjFaninC0(pObj) );
+        vCos.push_back( c == 1 ? x : Man.ExistPar(x, c) );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks that two BDDs in different managers are the same.]
+
+  Description [Both managers should use the same variable order.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_ManNewBddEqual_rec( NewBdd::Man & Man0, NewBdd::lit x, NewBdd::Man & Man1, NewBdd::lit y, std::unordered_map<NewBdd::lit, NewBdd::lit> & Visited )
+{
+    if ( x < 2 || y < 2 )
+        return x == y;
+    if ( Man0.LitIsCompl(x) != Man1.LitIsCompl(y) || Man0.Var(x) != Man1.Var(y) )
+        return 0;
+    auto it = Visited.find( Man0.LitRegular(x) );
+    if ( it != Visited.end() )
+        return it->second == Man1.LitRegular(y);
+    if ( !Gia_ManNewBddEqual_rec(Man0, Man0.Then(x), Man1, Man1.Then(y), Visited) ||
+         !Gia_ManNewBddEqual_rec(Man0, Man0.Else(x), Man1, Man1.Else(y), Visited) )
+        return 0;
+    Visited[Man0.LitRegular(x)] = Man1.LitRegular(y);
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Builds global BDDs of the COs using several threads.]
+
+  Description [Quantifies the first nQuant CIs from each CO. If fCheck
+  is set, builds the same BDDs again with one thread and compares them.
+  Returns 0 if the comparison failed, and 1 otherwise.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManNewBddPar( Gia_Man_t * p, int nThreads, int nQuant, int fCheck, int fVerbose )
+{
+    std::vector<NewBdd::lit> vCos, vCos1;
+    abctime clk = Abc_Clock();
+    int i, RetValue = 1;
+    if ( Gia_ManCiNum(p) >= (int)NewBdd::VarMax() )
+    {
+        printf( "The number of CIs (%d) is too large.\n", Gia_ManCiNum(p) );
+        return 0;
+    }
+    NewBdd::Param Par;
+    Par.nThreads = nThreads;
+    Par.nVerbose = fVerbose;
+    NewBdd::Man Man( Gia_ManCiNum(p), Par );
+    Gia_ManNewBddBuild( p, Man, nQuant, vCos );
+    printf( "Built BDDs of %d COs with %d nodes using %d thread%s.  ", Gia_ManCoNum(p), (int)Man.CountNodes(vCos), nThreads, nThreads > 1 ? "s" : "" );
+    ABC_PRT( "Time", Abc_Clock() - clk );
+    if ( !fCheck )
+        return 1;
+    clk = Abc_Clock();
+    NewBdd::Param Par1;
+    Par1.nVerbose = fVerbose;
+    NewBdd::Man Man1( Gia_ManCiNum(p), Par1 );
+    Gia_ManNewBddBuild( p, Man1, nQuant, vCos1 );
+    std::unordered_map<NewBdd::lit, NewBdd::lit> Visited;
+    for ( i = 0; i < Gia_ManCoNum(p); i++ )
+        if ( !Gia_ManNewBddEqual_rec(Man, vCos[i], Man1, vCos1[i], Visited) )
+        {
+            printf( "Verification FAILED for CO %d.  ", i );
+            RetValue = 0;
+            break;
+        }
+    if ( RetValue )
+        printf( "Verification against one thread succeeded.  " );
+    ABC_PRT( "Time", Abc_Clock() - clk );
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_IMPL_END
+
@@ -28,6 +28,13 @@
 #include <iomanip>
 #include <cmath>
 
+#ifdef ABC_USE_PTHREADS
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <shared_mutex>
+#endif
+
 ABC_NAMESPACE_CXX_HEADER_START
 
 namespace NewBdd {
@@ -162,6 +169,69 @@ namespace NewBdd {
     }
   };
 
+#ifdef ABC_USE_PTHREADS
+  // lossy computed table shared by threads; an entry is guarded by
+  // a sequence number (odd while being written), and readers that
+  // overlap with a writer simply miss, as do writers that collide
+  class ConcurrentCache {
+  private:
+    struct Entry {
+      std::atomic<unsigned> Seq;
+      std::atomic<lit>      x;
+      std::atomic<lit>      y;
+      std::atomic<lit>      z;
+    };
+    cac    Mask;
+    Entry *pEntries;
+
+  public:
+    ConcurrentCache(int nCacheSizeLog) {
+      cac nSize = (cac)1 << nCacheSizeLog;
+      if(!nSize)
+        fatal_error("Memout (nCacheMax) in init");
+      Mask = nSize - 1;
+      pEntries = new Entry[nSize];
+      Clear();
+    }
+    ~ConcurrentCache() {
+      delete [] pEntries;
+    }
+    inline lit Lookup(lit x, lit y) {
+      Entry &e = pEntries[CacHash(x, y) & Mask];
+      unsigned Seq = e.Seq.load(std::memory_order_acquire);
+      if(Seq & 1)
+        return LitMax();
+      lit ex = e.x.load(std::memory_order_relaxed);
+      lit ey = e.y.load(std::memory_order_relaxed);
+      lit ez = e.z.load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if(e.Seq.load(std::memory_order_relaxed) != Seq || ex != x || ey != y)
+        return LitMax();
+      return ez;
+    }
+    inline void Insert(lit x, lit y, lit z) {
+      Entry &e = pEntries[CacHash(x, y) & Mask];
+      unsigned Seq = e.Seq.load(std::memory_order_relaxed);
+      if((Seq & 1) || !e.Seq.compare_exchange_strong(Seq, Seq + 1, std::memory_order_acquire))
+        return;
+      std::atomic_thread_fence(std::memory_order_release);
+      e.x.store(x, std::memory_order_relaxed);
+      e.y.store(y, std::memory_order_relaxed);
+      e.z.store(z, std::memory_order_relaxed);
+      e.Seq.store(Seq + 2, std::memory_order_release);
+    }
+    // must not be called while operations are running
+    void Clear() {
+      for(cac i = 0; i <= Mask; i++) {
+        pEntries[i].Seq.store(0, std::memory_order_relaxed);
+        pEntries[i].x.store(0, std::memory_order_relaxed);
+        pEntries[i].y.store(0, std::memory_order_relaxed);
+        pEntries[i].z.store(0, std::memory_order_relaxed);
+      }
+    }
+  };
+#endif
+
   struct Param {
     int    nObjsAllocLog;
     int    nObjsMaxLog;
@@ -176,6 +246,7 @@ namespace NewBdd {
     double MaxGrowth;
     bool   fReoVerbose;
     int    nVerbose;
+    int    nThreads;
     std::vector<var> *pVar2Level;
     Param() {
       nObjsAllocLog  = 20;
@@ -191,6 +262,7 @@ namespace NewBdd {
       MaxGrowth      = 1.2;
       fReoVerbose    = false;
       nVerbose       = 0;
+      nThreads       = 1;
       pVar2Level     = NULL;
     }
   };
@@ -220,7 +292,24 @@ namespace NewBdd {
     std::vector<bvar>   vUniqueCounts;
     std::vector<bvar>   vUniqueTholds;
     std::vector<std::vector<bvar> > vvUnique;
+    int    nCacheSizeLog;
+    int    nCacheMaxLog;
+    int    nCacheVerbose;
     Cache *cache;
+    Cache *cacheExist; // allocated by the first Exist
+#ifdef ABC_USE_PTHREADS
+    // the manager is thread-safe when nThreads > 1: operations hold
+    // mutexMan shared, while resizing, garbage collection, and
+    // reordering hold it exclusively; mutexAlloc guards nObjs and
+    // the removed-node list while operations run concurrently
+    int    nThreads;
+    int    nForkDepth;
+    std::shared_mutex       mutexMan;
+    std::mutex              mutexAlloc;
+    std::vector<std::mutex> vUniqueLocks;
+    ConcurrentCache *ccache;
+    ConcurrentCache *ccacheExist;
+#endif
 
   public:
     inline lit  Bvar2Lit(bvar a)          const { return (lit)a << 1;                                       }
@@ -405,7 +494,7 @@ namespace NewBdd {
           if(RefOfBvar(a))
             ResetMark_rec(Bvar2Lit(a));
       }
-      cache->Clear();
+      ClearCaches();
       return RemovedHead;
     }
 
@@ -496,6 +585,212 @@ namespace NewBdd {
       cache->Insert(x, y, z);
       return z;
     }
+    lit Exist_rec(lit x, lit c) {
+      if(x < 2)
+        return x;
+      while(c != 1 && Level(c) < Level(x))
+        c = Then(c);
+      if(c == 1)
+        return x;
+      lit z = cacheExist->Lookup(x, c);
+      if(z != LitMax())
+        return z;
+      var v = Var(x);
+      lit x1 = Then(x), x0 = Else(x);
+      if(Level(c) == Level(x)) {
+        lit z1 = Exist_rec(x1, Then(c));
+        if(z1 == 1)
+          z = 1;
+        else {
+          IncRef(z1);
+          lit z0 = Exist_rec(x0, Then(c));
+          IncRef(z0);
+          z = LitNot(And_rec(LitNot(z1), LitNot(z0)));
+          DecRef(z1);
+          DecRef(z0);
+        }
+      } else {
+        lit z1 = Exist_rec(x1, c);
+        IncRef(z1);
+        lit z0 = Exist_rec(x0, c);
+        IncRef(z0);
+        z = UniqueCreate(v, z1, z0);
+        DecRef(z1);
+        DecRef(z0);
+      }
+      cacheExist->Insert(x, c, z);
+      return z;
+    }
+    void ClearCaches() {
+      cache->Clear();
+      if(cacheExist)
+        cacheExist->Clear();
+#ifdef ABC_USE_PTHREADS
+      if(ccache)
+        ccache->Clear();
+      if(ccacheExist)
+        ccacheExist->Clear();
+#endif
+    }
+    inline void ReorderIfNeeded() {
+      if(nObjs > nReo) {
+        Reorder();
+        while(nReo < nObjs) {
+          nReo <<= 1;
+          if((lit)nReo > (lit)BvarMax())
+            nReo = BvarMax();
+        }
+      }
+    }
+
+#ifdef ABC_USE_PTHREADS
+  private:
+    // node allocation in the thread-safe mode; returns 0 if out of nodes
+    inline bvar AllocBvarPar() {
+      std::lock_guard<std::mutex> lock(mutexAlloc);
+      if(nObjs < nObjsAlloc)
+        return nObjs++;
+      bvar a = RemovedHead;
+      if(a)
+        RemovedHead = vNexts[a];
+      return a;
+    }
+    inline bvar NumObjsPar() {
+      std::lock_guard<std::mutex> lock(mutexAlloc);
+      return nObjs;
+    }
+    inline lit UniqueCreatePar(var v, lit x1, lit x0) {
+      if(x1 == x0)
+        return x1;
+      bool c = LitIsCompl(x0);
+      if(c)
+        x1 = LitNot(x1), x0 = LitNot(x0);
+      std::lock_guard<std::mutex> lock(vUniqueLocks[v]);
+      std::vector<bvar>::iterator p, q;
+      p = q = vvUnique[v].begin() + (UniqHash(x1, x0) & vUniqueMasks[v]);
+      for(; *q; q = vNexts.begin() + *q)
+        if(VarOfBvar(*q) == v && ThenOfBvar(*q) == x1 && ElseOfBvar(*q) == x0)
+          return LitNotCond(Bvar2Lit(*q), c);
+      bvar a = AllocBvarPar();
+      if(!a)
+        return LitMax();
+      SetVarOfBvar(a, v);
+      SetThenOfBvar(a, x1);
+      SetElseOfBvar(a, x0);
+      vNexts[a] = *p;
+      *p = a;
+      if(!vOneCounts.empty())
+        vOneCounts[a] = OneCount(x1) / 2 + OneCount(x0) / 2;
+      vUniqueCounts[v]++;
+      if(vUniqueCounts[v] > vUniqueTholds[v])
+        ResizeUnique(v);
+      return LitNotCond(Bvar2Lit(a), c);
+    }
+    // the recursive calls return LitMax() when out of nodes; the two
+    // branches are solved by different threads at the top nDepth levels
+    lit AndPar_rec(lit x, lit y, int nDepth) {
+      if(x == 0 || y == 1)
+        return x;
+      if(x == 1 || y == 0)
+        return y;
+      if(Lit2Bvar(x) == Lit2Bvar(y))
+        return (x == y)? x: 0;
+      if(x > y)
+        std::swap(x, y);
+      lit z = ccache->Lookup(x, y);
+      if(z != LitMax())
+        return z;
+      var v;
+      lit x0, x1, y0, y1, z0, z1;
+      if(Level(x) < Level(y))
+        v = Var(x), x1 = Then(x), x0 = Else(x), y0 = y1 = y;
+      else if(Level(x) > Level(y))
+        v = Var(y), x0 = x1 = x, y1 = Then(y), y0 = Else(y);
+      else
+        v = Var(x), x1 = Then(x), x0 = Else(x), y1 = Then(y), y0 = Else(y);
+      if(nDepth > 0) {
+        std::thread t([&]() { z1 = AndPar_rec(x1, y1, nDepth - 1); });
+        z0 = AndPar_rec(x0, y0, nDepth - 1);
+        t.join();
+      } else {
+        z1 = AndPar_rec(x1, y1, 0);
+        if(z1 == LitMax())
+          return z1;
+        z0 = AndPar_rec(x0, y0, 0);
+      }
+      if(z1 == LitMax() || z0 == LitMax())
+        return LitMax();
+      z = UniqueCreatePar(v, z1, z0);
+      if(z != LitMax())
+        ccache->Insert(x, y, z);
+      return z;
+    }
+    lit ExistPar_rec(lit x, lit c, int nDepth) {
+      if(x < 2)
+        return x;
+      while(c != 1 && Level(c) < Level(x))
+        c = Then(c);
+      if(c == 1)
+        return x;
+      lit z = ccacheExist->Lookup(x, c);
+      if(z != LitMax())
+        return z;
+      var v = Var(x);
+      lit x1 = Then(x), x0 = Else(x), z1, z0;
+      lit c1 = (Level(c) == Level(x))? Then(c): c;
+      if(nDepth > 0) {
+        std::thread t([&]() { z1 = ExistPar_rec(x1, c1, nDepth - 1); });
+        z0 = ExistPar_rec(x0, c1, nDepth - 1);
+        t.join();
+      } else {
+        z1 = ExistPar_rec(x1, c1, 0);
+        if(z1 == LitMax())
+          return z1;
+        z0 = (z1 == 1 && c1 != c)? 1: ExistPar_rec(x0, c1, 0);
+      }
+      if(z1 == LitMax() || z0 == LitMax())
+        return LitMax();
+      if(c1 != c) {
+        z = AndPar_rec(LitNot(z1), LitNot(z0), 0);
+        if(z == LitMax())
+          return z;
+        z = LitNot(z);
+      } else {
+        z = UniqueCreatePar(v, z1, z0);
+        if(z == LitMax())
+          return z;
+      }
+      ccacheExist->Insert(x, c, z);
+      return z;
+    }
+    // runs an operation (0 = And, 1 = Exist) in the thread-safe mode;
+    // when nodes run out, the manager is grown exclusively and the
+    // operation is restarted, reusing the results in the cache
+    lit ApplyPar(int Op, lit x, lit y, int nDepth) {
+      while(true) {
+        {
+          std::shared_lock<std::shared_mutex> lock(mutexMan);
+          if(NumObjsPar() <= nReo && (!Op || ccacheExist)) {
+            lit z = Op? ExistPar_rec(x, y, nDepth): AndPar_rec(x, y, nDepth);
+            if(z != LitMax())
+              return z;
+          }
+        }
+        std::unique_lock<std::shared_mutex> lock(mutexMan);
+        if(Op && !ccacheExist)
+          ccacheExist = new ConcurrentCache(nCacheMaxLog);
+        else if(nObjs > nReo)
+          ReorderIfNeeded();
+        else if(nObjs == nObjsAlloc && !RemovedHead) {
+          bool fRemoved = false;
+          if(nGbc > 1)
+            fRemoved = Gbc();
+          if(!Resize() && !fRemoved && (nGbc != 1 || !Gbc()))
+            fatal_error("Memout (node)");
+        }
+      }
+    }
+#endif
 
   private:
     bvar Swap(var i) {
@@ -713,7 +1008,26 @@ namespace NewBdd {
         vOneCounts.resize(nObjsAlloc);
       }
       // set up cache
-      cache = new Cache(p.nCacheSizeLog, p.nCacheMaxLog, p.nCacheVerbose);
+      nCacheSizeLog = p.nCacheSizeLog;
+      nCacheMaxLog = p.nCacheMaxLog;
+      nCacheVerbose = p.nCacheVerbose;
+      cache = new Cache(nCacheSizeLog, nCacheMaxLog, nCacheVerbose);
+      cacheExist = NULL;
+#ifdef ABC_USE_PTHREADS
+      // set up thread-safe mode
+      nThreads = p.nThreads;
+      nForkDepth = 0;
+      while((1 << (nForkDepth + 1)) <= nThreads)
+        nForkDepth++;
+      ccache = NULL;
+      ccacheExist = NULL;
+      if(nThreads > 1) {
+        if(nVerbose)
+          std::cout << "Allocating " << ((cac)1 << p.nCacheMaxLog) << " concurrent cache entries" << std::endl;
+        vUniqueLocks = std::vector<std::mutex>(nVars);
+        ccache = new ConcurrentCache(p.nCacheMaxLog);
+      }
+#endif
       // create nodes for variables
       nObjs = 1;
       vVars[0] = VarMax();
@@ -752,6 +1066,11 @@ namespace NewBdd {
           std::cout << "Free " << vRefs.size() << " refs" << std::endl;
       }
       delete cache;
+      delete cacheExist;
+#ifdef ABC_USE_PTHREADS
+      delete ccache;
+      delete ccacheExist;
+#endif
     }
     void Reorder() {
       if(nVerbose >= 2)
@@ -761,23 +1080,53 @@ namespace NewBdd {
       CountEdges();
       Sift();
       vEdges.clear();
-      cache->Clear();
+      ClearCaches();
       nGbc = nGbc_;
     }
+    // with nThreads > 1, And, Or, Exist, and their parallel versions may
+    // be called concurrently from several threads, while the other methods
+    // may not
     inline lit And(lit x, lit y) {
-      if(nObjs > nReo) {
-        Reorder();
-        while(nReo < nObjs) {
-          nReo <<= 1;
-          if((lit)nReo > (lit)BvarMax())
-            nReo = BvarMax();
-        }
-      }
+#ifdef ABC_USE_PTHREADS
+      if(nThreads > 1)
+        return ApplyPar(0, x, y, 0);
+#endif
+      ReorderIfNeeded();
       return And_rec(x, y);
     }
     inline lit Or(lit x, lit y) {
       return LitNot(And(LitNot(x), LitNot(y)));
     }
+    // quantifies the variables of cube c (a conjunction of positive literals)
+    inline lit Exist(lit x, lit c) {
+#ifdef ABC_USE_PTHREADS
+      if(nThreads > 1)
+        return ApplyPar(1, x, c, 0);
+#endif
+      ReorderIfNeeded();
+      if(!cacheExist)
+        cacheExist = new Cache(nCacheSizeLog, nCacheMaxLog, nCacheVerbose);
+      return Exist_rec(x, c);
+    }
+    // fork-join versions for large operations, splitting the top levels
+    // of the recursion among nThreads threads
+    inline lit AndPar(lit x, lit y) {
+#ifdef ABC_USE_PTHREADS
+      if(nThreads > 1)
+        return ApplyPar(0, x, y, nForkDepth);
+#endif
+      return And(x, y);
+    }
+    inline lit OrPar(lit x, lit y) {
+      return LitNot(AndPar(LitNot(x), LitNot(y)));
+    }
+    inline lit ExistPar(lit x, lit c) {
+#ifdef ABC_USE_PTHREADS
+      if(nThreads > 1)
+        return ApplyPar(1, x, c, nForkDepth);
+#endif
+      return Exist(x, c);
+    }
 
   public:
     void SetRef(std::vector<lit> const &vLits) {
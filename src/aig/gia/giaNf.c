@@ -157,6 +157,8 @@ static inline int *        Nf_CutFromHandle( int * pCutSet, int h )
 static inline int          Nf_CfgVar( Nf_Cfg_t Cfg, int i )                          { return (Cfg.Perm >> (i<<2)) & 15;                                }
 static inline int          Nf_CfgCompl( Nf_Cfg_t Cfg, int i )                        { return (Cfg.Phase >> i) & 1;                                     }
 
+static inline int          Nf_StoFuncPart( word uTruth, int nParts )                { word uFunc = (uTruth & 1) ? ~uTruth : uTruth; return (int)((unsigned)((uFunc * ABC_CONST(0x9E3779B97F4A7C15)) >> 32) % (unsigned)nParts); }
+
 #define Nf_SetForEachCut( pList, pCut, i )                   for ( i = 0, pCut = pList + 1; i < pList[0]; i++, pCut += Nf_CutSize(pCut) + 1 )
 #define Nf_CutForEachVarCompl( pCut, Cfg, iVar, fCompl, i )  for ( i = 0; i < Nf_CutSize(pCut) && (iVar = Nf_CutLeaves(pCut)[Nf_CfgVar(Cfg, i)]) && ((fCompl = Nf_CfgCompl(Cfg, i)), 1); i++ )
 #define Nf_CfgForEachVarCompl( Cfg, Size, iVar, fCompl, i )  for ( i = 0; i < Size && ((iVar = Nf_CfgVar(Cfg, i)), 1) && ((fCompl = Nf_CfgCompl(Cfg, i)), 1); i++ )
@@ -252,13 +254,13 @@ void Nf_StoCreateGateAdd( Vec_Mem_t * vTtMem, Vec_Wec_t * vTt2Match, Mio_Cell2_t
             Vec_IntPush( vStore, pCell->iDelays[Abc_Lit2Var(pFans[k])] );
     }
 }
-void Nf_StoCreateGateMaches( Vec_Mem_t * vTtMem, Vec_Wec_t * vTt2Match, Mio_Cell2_t * pCell, int ** pComp, int ** pPerm, int * pnPerms, Vec_Wec_t * vProfs, Vec_Int_t * vStore, int fPinFilter, int fPinPerm, int fPinQuick )
+void Nf_StoCreateGateMaches( Vec_Mem_t * vTtMem, Vec_Wec_t * vTt2Match, Mio_Cell2_t * pCell, int ** pComp, int ** pPerm, int * pnPerms, Vec_Wec_t * vProfs, Vec_Int_t * vStore, int fPinFilter, int fPinPerm, int fPinQuick, int iPart, int nParts, int * pPos, Vec_Int_t * vFirst )
 {
     int Perm[NF_LEAF_MAX], * Perm1, * Perm2;
     int nPerms = pnPerms[pCell->nFanins];
     int nMints = (1 << pCell->nFanins);
     word tCur, tTemp1, tTemp2;
-    int i, p, c;
+    int i, p, c, nFuncs;
     assert( pCell->nFanins <= 6 );
     for ( i = 0; i < (int)pCell->nFanins; i++ )
         Perm[i] = Abc_Var2Lit( i, 0 );
@@ -268,7 +270,15 @@ void Nf_StoCreateGateMaches( Vec_Mem_t * vTtMem, Vec_Wec_t * vTt2Match, Mio_Cell
         tTemp2 = tCur;
         for ( c = 0; c < nMints; c++ )
         {
-            Nf_StoCreateGateAdd( vTtMem, vTt2Match, pCell, tCur, Perm, pCell->nFanins, vProfs, vStore, fPinFilter, fPinPerm, fPinQuick );
+            if ( nParts == 1 || Nf_StoFuncPart(tCur, nParts) == iPart )
+            {
+                nFuncs = Vec_MemEntryNum( vTtMem );
+                Nf_StoCreateGateAdd( vTtMem, vTt2Match, pCell, tCur, Perm, pCell->nFanins, vProfs, vStore, fPinFilter, fPinPerm, fPinQuick );
+                if ( vFirst && nFuncs < Vec_MemEntryNum(vTtMem) )
+                    Vec_IntPush( vFirst, *pPos );
+            }
+            if ( pPos )
+                (*pPos)++;
             // update
             tCur  = Abc_Tt6Flip( tCur, pComp[pCell->nFanins][c] );
             Perm1 = Perm + pComp[pCell->nFanins][c];
@@ -285,14 +295,121 @@ void Nf_StoCreateGateMaches( Vec_Mem_t * vTtMem, Vec_Wec_t * vTt2Match, Mio_Cell
     }
     assert( tTemp1 == tCur );
 }
-Mio_Cell2_t * Nf_StoDeriveMatches( Vec_Mem_t * vTtMem, Vec_Wec_t * vTt2Match, int * pnCells, int fPinFilter, int fPinPerm, int fPinQuick )
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the matches of one partition of the functions.]
+
+  Description [Each thread enumerates all permutations and phases of all 
+  cells but only keeps the functions that hash into its own partition. 
+  Because a function is owned by one thread, its match list is built in 
+  the same order as in the serial flow. The position of the first 
+  appearance of each function is recorded to number the functions 
+  after merging exactly as the serial flow would.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Nf_StoJob_t_ Nf_StoJob_t;
+struct Nf_StoJob_t_
+{
+    Mio_Cell2_t *  pCells;
+    int            nCells;
+    int **         pComp;
+    int **         pPerm;
+    int *          pnPerms;
+    int            fPinFilter;
+    int            fPinPerm;
+    int            fPinQuick;
+    int            iPart;
+    int            nParts;
+    Vec_Mem_t *    vTtMem;      // functions of this partition
+    Vec_Wec_t *    vTt2Match;   // their matches
+    Vec_Int_t *    vFirst;      // the first appearance of each function
+};
+int Nf_StoDeriveMatchesJob( void * pArg )
+{
+    Nf_StoJob_t * pJob = (Nf_StoJob_t *)pArg;
+    Vec_Wec_t * vProfs = Vec_WecAlloc( 1000 );
+    Vec_Int_t * vStore = Vec_IntAlloc( 10000 );
+    int i, Pos = 0;
+    Vec_WecPushLevel( vProfs );
+    Vec_WecPushLevel( vProfs );
+    for ( i = 2; i < pJob->nCells; i++ )
+        Nf_StoCreateGateMaches( pJob->vTtMem, pJob->vTt2Match, pJob->pCells+i, pJob->pComp, pJob->pPerm, pJob->pnPerms, vProfs, vStore, 
+            pJob->fPinFilter, pJob->fPinPerm, pJob->fPinQuick, pJob->iPart, pJob->nParts, &Pos, pJob->vFirst );
+    Vec_WecFree( vProfs );
+    Vec_IntFree( vStore );
+    return 1;
+}
+void Nf_StoDeriveMatchesPar( Vec_Mem_t * vTtMem, Vec_Wec_t * vTt2Match, Mio_Cell2_t * pCells, int nCells, int ** pComp, int ** pPerm, int * pnPerms, int fPinFilter, int fPinPerm, int fPinQuick, int nProcs )
+{
+    int nParts = nProcs - 1;
+    Nf_StoJob_t * pJobs = ABC_CALLOC( Nf_StoJob_t, nParts );
+    Vec_Ptr_t * vJobs = Vec_PtrAlloc( nParts );
+    Vec_Wrd_t * vOrder = Vec_WrdAlloc( 10000 );
+    int i, k, Pos, iFunc, nFuncs = Vec_MemEntryNum(vTtMem);
+    word Key;
+    assert( nFuncs == 2 && Vec_WecSize(vTt2Match) == 2 );
+    for ( k = 0; k < nParts; k++ )
+    {
+        Nf_StoJob_t * pJob = pJobs + k;
+        pJob->pCells     = pCells;
+        pJob->nCells     = nCells;
+        pJob->pComp      = pComp;
+        pJob->pPerm      = pPerm;
+        pJob->pnPerms    = pnPerms;
+        pJob->fPinFilter = fPinFilter;
+        pJob->fPinPerm   = fPinPerm;
+        pJob->fPinQuick  = fPinQuick;
+        pJob->iPart      = k;
+        pJob->nParts     = nParts;
+        pJob->vTtMem     = Vec_MemAllocForTT( 6, 0 );
+        pJob->vTt2Match  = Vec_WecAlloc( 1000 );
+        pJob->vFirst     = Vec_IntAlloc( 1000 );
+        Vec_WecPushLevel( pJob->vTt2Match );
+        Vec_WecPushLevel( pJob->vTt2Match );
+        Vec_IntFill( pJob->vFirst, nFuncs, -1 );
+        Vec_PtrPush( vJobs, pJob );
+    }
+    Util_ProcessThreads( Nf_StoDeriveMatchesJob, vJobs, nProcs, 0, 0 );
+    // the functions present from the start keep their IDs
+    for ( k = 0; k < nParts; k++ )
+    {
+        for ( i = 0; i < nFuncs; i++ )
+            Vec_IntAppend( Vec_WecEntry(vTt2Match, i), Vec_WecEntry(pJobs[k].vTt2Match, i) );
+        Vec_IntForEachEntryStart( pJobs[k].vFirst, Pos, i, nFuncs )
+            Vec_WrdPush( vOrder, ((word)Pos << 32) | (word)(i * nParts + k) );
+    }
+    // the new functions are numbered in the order of their first appearance
+    Vec_WrdSort( vOrder, 0 );
+    Vec_WrdForEachEntry( vOrder, Key, i )
+    {
+        Nf_StoJob_t * pJob = pJobs + (int)((unsigned)Key % nParts);
+        int iFuncOld = (int)((unsigned)Key / nParts);
+        iFunc = Vec_MemHashInsert( vTtMem, Vec_MemReadEntry(pJob->vTtMem, iFuncOld) );
+        assert( iFunc == Vec_WecSize(vTt2Match) );
+        Vec_IntAppend( Vec_WecPushLevel(vTt2Match), Vec_WecEntry(pJob->vTt2Match, iFuncOld) );
+    }
+    for ( k = 0; k < nParts; k++ )
+    {
+        Vec_MemHashFree( pJobs[k].vTtMem );
+        Vec_MemFree( pJobs[k].vTtMem );
+        Vec_WecFree( pJobs[k].vTt2Match );
+        Vec_IntFree( pJobs[k].vFirst );
+    }
+    ABC_FREE( pJobs );
+    Vec_PtrFree( vJobs );
+    Vec_WrdFree( vOrder );
+}
+void Nf_StoDeriveMatches( Vec_Mem_t * vTtMem, Vec_Wec_t * vTt2Match, Mio_Cell2_t * pCells, int nCells, int fPinFilter, int fPinPerm, int fPinQuick, int nProcs )
 {
-    int fVerbose = 0;
     //abctime clk = Abc_Clock();
     Vec_Wec_t * vProfs = Vec_WecAlloc( 1000 );
     Vec_Int_t * vStore = Vec_IntAlloc( 10000 );
     int * pComp[7], * pPerm[7], nPerms[7], i;
-    Mio_Cell2_t * pCells;
     Vec_WecPushLevel( vProfs );
     Vec_WecPushLevel( vProfs );
     for ( i = 1; i <= 6; i++ )
@@ -301,10 +418,11 @@ Mio_Cell2_t * Nf_StoDeriveMatches( Vec_Mem_t * vTtMem, Vec_Wec_t * vTt2Match, in
         pPerm[i] = Extra_PermSchedule( i );
     for ( i = 1; i <= 6; i++ )
         nPerms[i] = Extra_Factorial( i );
-    pCells = Mio_CollectRootsNewDefault2( 6, pnCells, fVerbose );
-    if ( pCells != NULL )
-    for ( i = 2; i < *pnCells; i++ )
-        Nf_StoCreateGateMaches( vTtMem, vTt2Match, pCells+i, pComp, pPerm, nPerms, vProfs, vStore, fPinFilter, fPinPerm, fPinQuick );
+    if ( pCells != NULL && nProcs > 2 )
+        Nf_StoDeriveMatchesPar( vTtMem, vTt2Match, pCells, nCells, pComp, pPerm, nPerms, fPinFilter, fPinPerm, fPinQuick, nProcs );
+    else if ( pCells != NULL )
+    for ( i = 2; i < nCells; i++ )
+        Nf_StoCreateGateMaches( vTtMem, vTt2Match, pCells+i, pComp, pPerm, nPerms, vProfs, vStore, fPinFilter, fPinPerm, fPinQuick, 0, 1, NULL, NULL );
     for ( i = 1; i <= 6; i++ )
         ABC_FREE( pComp[i] );
     for ( i = 1; i <= 6; i++ )
@@ -312,7 +430,6 @@ Mio_Cell2_t * Nf_StoDeriveMatches( Vec_Mem_t * vTtMem, Vec_Wec_t * vTt2Match, in
     Vec_WecFree( vProfs );
     Vec_IntFree( vStore );
     //Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
-    return pCells;
 }
 void Nf_StoPrintOne( Nf_Man_t * p, int Count, int t, int i, int GateId, Nf_Cfg_t Mat )
 {
@@ -409,7 +526,7 @@ Nf_Man_t * Nf_StoCreate( Gia_Man_t * pGia, Jf_Par_t * pPars )
     }
     Vec_IntFree(vFlowRefs);
     // matching
-    Mio_LibraryMatchesFetch( (Mio_Library_t *)Abc_FrameReadLibGen(), &p->vTtMem, &p->vTt2Match, &p->pCells, &p->nCells, p->pPars->fPinFilter, p->pPars->fPinPerm, p->pPars->fPinQuick );
+    Mio_LibraryMatchesFetch( (Mio_Library_t *)Abc_FrameReadLibGen(), &p->vTtMem, &p->vTt2Match, &p->pCells, &p->nCells, p->pPars->fPinFilter, p->pPars->fPinPerm, p->pPars->fPinQuick, p->pPars->nProcNum, p->pPars->pMatchFile, p->pPars->fVerbose );
     if ( p->pCells == NULL )
         return NULL;
     p->InvDelayI = p->pCells[3].iDelays[0];
@@ -1545,34 +1545,41 @@ void Abc_ResubPrepareManager( int nWords )
         s_pResbMan = Gia_ResbAlloc( nWords );
 }
 
-int Abc_ResubComputeFunction( void ** ppDivs, int nDivs, int nWords, int nLimit, int nDivsMax, int iChoice, int fUseXor, int fDebug, int fVerbose, int ** ppArray )
+// same as Abc_ResubComputeFunction() but uses the given manager (or the global one, if NULL)
+int Gia_ResbComputeFunction( Gia_ResbMan_t * p, void ** ppDivs, int nDivs, int nWords, int nLimit, int nDivsMax, int iChoice, int fUseXor, int fDebug, int fVerbose, int ** ppArray )
 {
     Vec_Ptr_t Divs = { nDivs, nDivs, ppDivs };
-    assert( s_pResbMan != NULL ); // first call Abc_ResubPrepareManager()
-    Gia_ManResubPerform( s_pResbMan, &Divs, nWords, nLimit, nDivsMax, iChoice, fUseXor, fDebug, fVerbose==2, 0 );
+    if ( p == NULL )
+        p = s_pResbMan;
+    assert( p != NULL ); // first call Abc_ResubPrepareManager()
+    Gia_ManResubPerform( p, &Divs, nWords, nLimit, nDivsMax, iChoice, fUseXor, fDebug, fVerbose==2, 0 );
     if ( fVerbose )
     {
-        int nGates = Vec_IntSize(s_pResbMan->vGates)/2;
+        int nGates = Vec_IntSize(p->vGates)/2;
         if ( nGates )
         {
             printf( "      Gain = %2d  Gates = %2d  __________  F = ", nLimit+1-nGates, nGates );
-            Gia_ManResubPrint( s_pResbMan->vGates, nDivs );
+            Gia_ManResubPrint( p->vGates, nDivs );
             printf( "\n" );
         }
     }
     if ( fDebug )
     {
-        if ( !Gia_ManResubVerify(s_pResbMan, NULL) )
+        if ( !Gia_ManResubVerify(p, NULL) )
         {
-            Gia_ManResubPrint( s_pResbMan->vGates, nDivs );
+            Gia_ManResubPrint( p->vGates, nDivs );
             printf( "Verification FAILED.\n" );
         }
         //else
         //    printf( "Verification succeeded.\n" );
     }
-    *ppArray = Vec_IntArray(s_pResbMan->vGates);
-    assert( Vec_IntSize(s_pResbMan->vGates)/2 <= nLimit );
-    return Vec_IntSize(s_pResbMan->vGates);
+    *ppArray = Vec_IntArray(p->vGates);
+    assert( Vec_IntSize(p->vGates)/2 <= nLimit );
+    return Vec_IntSize(p->vGates);
+}
+int Abc_ResubComputeFunction( void ** ppDivs, int nDivs, int nWords, int nLimit, int nDivsMax, int iChoice, int fUseXor, int fDebug, int fVerbose, int ** ppArray )
+{
+    return Gia_ResbComputeFunction( NULL, ppDivs, nDivs, nWords, nLimit, nDivsMax, iChoice, fUseXor, fDebug, fVerbose, ppArray );
 }
 
 void Abc_ResubDumpProblem( char * pFileName, void ** ppDivs, int nDivs, int nWords )
@@ -62,8 +62,10 @@ struct Gia_Rsb2Man_t_
     word           CareSet;
 };
 
+typedef struct Gia_ResbMan_t_ Gia_ResbMan_t;
+
 extern void Abc_ResubPrepareManager( int nWords );
-extern int Abc_ResubComputeFunction( void ** ppDivs, int nDivs, int nWords, int nLimit, int nDivsMax, int iChoice, int fUseXor, int fDebug, int fVerbose, int ** ppArray );
+extern int Gia_ResbComputeFunction( Gia_ResbMan_t * p, void ** ppDivs, int nDivs, int nWords, int nLimit, int nDivsMax, int iChoice, int fUseXor, int fDebug, int fVerbose, int ** ppArray );
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -431,7 +433,7 @@ int Abc_ResubNodeToTry( Vec_Int_t * vTried, int iFirst, int iLast )
             return iNode;
     return -1;
 }
-int Abc_ResubComputeWindow( int * pObjs, int nObjs, int nDivsMax, int nLevelIncrease, int fUseXor, int fUseZeroCost, int fDebug, int fVerbose, int ** ppArray, int * pnResubs )
+int Gia_Rsb2ComputeWindow( Gia_ResbMan_t * pResb, int * pObjs, int nObjs, int nDivsMax, int nLevelIncrease, int fUseXor, int fUseZeroCost, int fDebug, int fVerbose, int ** ppArray, int * pnResubs )
 {
     int iNode, nChanges = 0, RetValue = 0;
     Gia_Rsb2Man_t * p = Gia_Rsb2ManAlloc(); 
@@ -440,7 +442,7 @@ int Abc_ResubComputeWindow( int * pObjs, int nObjs, int nDivsMax, int nLevelIncr
     while ( (iNode = Abc_ResubNodeToTry(&p->vTried, p->nPis+1, p->iFirstPo)) > 0 )
     {
         int nDivs = Gia_Rsb2ManDivs( p, iNode );
-        int * pResub, nResub = Abc_ResubComputeFunction( Vec_PtrArray(&p->vpDivs), nDivs, 1, p->nMffc-1, nDivsMax, 0, fUseXor, fDebug, fVerbose, &pResub );
+        int * pResub, nResub = Gia_ResbComputeFunction( pResb, Vec_PtrArray(&p->vpDivs), nDivs, 1, p->nMffc-1, nDivsMax, 0, fUseXor, fDebug, fVerbose, &pResub );
         if ( nResub == 0 )
             Vec_IntPush( &p->vTried, iNode );
         else
@@ -474,6 +476,10 @@ int Abc_ResubComputeWindow( int * pObjs, int nObjs, int nDivsMax, int nLevelIncr
         *pnResubs = nChanges;
     return RetValue;
 }
+int Abc_ResubComputeWindow( int * pObjs, int nObjs, int nDivsMax, int nLevelIncrease, int fUseXor, int fUseZeroCost, int fDebug, int fVerbose, int ** ppArray, int * pnResubs )
+{
+    return Gia_Rsb2ComputeWindow( NULL, pObjs, nObjs, nDivsMax, nLevelIncrease, fUseXor, fUseZeroCost, fDebug, fVerbose, ppArray, pnResubs );
+}
 int Abc_ResubComputeWindow2( int * pObjs, int nObjs, int nDivsMax, int nLevelIncrease, int fUseXor, int fUseZeroCost, int fDebug, int fVerbose, int ** ppArray, int * pnResubs )
 {
     *ppArray = ABC_ALLOC( int, 2*nObjs );
@@ -530,24 +536,32 @@ Gia_Man_t * Gia_ManFromResub( int * pObjs, int nObjs, int nIns )
     }
     return pNew;
 }
+// performs resubstitution of a window with at most six inputs using the given
+// resub manager (or the global one, if NULL); returns NULL if nothing changed
+Gia_Man_t * Gia_ManResub2Window( Gia_Man_t * p, Gia_ResbMan_t * pResb, int nDivsMax )
+{
+    Gia_Man_t * pNew = NULL;
+    int nResubs, nObjsNew, * pObjsNew, * pObjs = Gia_ManToResub( p );
+    assert( Gia_ManCiNum(p) <= 6 );
+    nObjsNew = Gia_Rsb2ComputeWindow( pResb, pObjs, Gia_ManObjNum(p), nDivsMax, -1, 0, 0, 0, 0, &pObjsNew, &nResubs );
+    //printf( "Performed resub %d times.  Reduced %d nodes.\n", nResubs, nObjsNew ? Gia_ManObjNum(p) - nObjsNew : 0 );
+    if ( nObjsNew )
+        pNew = Gia_ManFromResub( pObjsNew, nObjsNew, Gia_ManCiNum(p) );
+    ABC_FREE( pObjs );
+    ABC_FREE( pObjsNew );
+    return pNew;
+}
 Gia_Man_t * Gia_ManResub2Test( Gia_Man_t * p )
 {
     Gia_Man_t * pNew;
-    int nResubs, nObjsNew, * pObjsNew, * pObjs = Gia_ManToResub( p );
 //Gia_ManPrint( p );
     Abc_ResubPrepareManager( 1 );
-    nObjsNew = Abc_ResubComputeWindow( pObjs, Gia_ManObjNum(p), 1000, -1, 0, 0, 0, 0, &pObjsNew, &nResubs );
-    //printf( "Performed resub %d times.  Reduced %d nodes.\n", nResubs, nObjsNew ? Gia_ManObjNum(p) - nObjsNew : 0 );
+    pNew = Gia_ManResub2Window( p, NULL, 1000 );
     Abc_ResubPrepareManager( 0 );
-    if ( nObjsNew )
-    {
-        pNew = Gia_ManFromResub( pObjsNew, nObjsNew, Gia_ManCiNum(p) );
+    if ( pNew )
         pNew->pName = Abc_UtilStrsav( p->pName );
-    }
     else 
         pNew = Gia_ManDup( p );
-    ABC_FREE( pObjs );
-    ABC_FREE( pObjsNew );
     return pNew;
 }
 
@@ -1270,8 +1284,7 @@ Gia_Man_t * Gia_RsbDeriveGiaFromWindows( Gia_Man_t * p, Vec_Int_t * vWin, Vec_In
     pNew->pName = Abc_UtilStrsav( p->pName );
     pNew->pSpec = Abc_UtilStrsav( p->pSpec );
     Gia_ManHashAlloc( pNew );
-    Gia_ManFillValue( p );
-    Gia_ManConst0(p)->Value = 0;
+    // precondition: the values of the window nodes are ~0 (they are reset on exit)
     Gia_ManForEachObjVec( vIns, p, pObj, i )
         pObj->Value = Gia_ManAppendCi( pNew );
     Gia_ManForEachObjVec( vWin, p, pObj, i )
@@ -1280,6 +1293,10 @@ Gia_Man_t * Gia_RsbDeriveGiaFromWindows( Gia_Man_t * p, Vec_Int_t * vWin, Vec_In
     Gia_ManForEachObjVec( vOuts, p, pObj, i )
         Gia_ManAppendCo( pNew, pObj->Value );
     Gia_ManHashStop( pNew );
+    Gia_ManForEachObjVec( vWin, p, pObj, i )
+        pObj->Value = ~0;
+    Gia_ManForEachObjVec( vIns, p, pObj, i )
+        pObj->Value = ~0;
     return pNew;
 }
 
@@ -1363,6 +1380,7 @@ void Gia_RsbEnumerateWindows( Gia_Man_t * p, int nInputsMax, int nLevelsMax )
     Gia_Man_t * pIn, * pOut;
     abctime clk = Abc_Clock();
     Gia_ManStaticFanoutStart( p );
+    Gia_ManFillValue( p );
     Gia_ManForEachAnd( p, pObj, i )
     {
         Vec_Int_t * vWin, * vIns, * vOuts;
@@ -9,7 +9,7 @@
   Synopsis    [Resubstitution computation.]
 
   Author      [Alan Mishchenko]
-  
+
   Affiliation [UC Berkeley]
 
   Date        [Ver. 1.0. Started - June 20, 2005.]
@@ -26,24 +26,393 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+typedef struct Gia_ResbMan_t_ Gia_ResbMan_t;
+
+typedef struct Gia_Rsb3Win_t_ Gia_Rsb3Win_t;
+struct Gia_Rsb3Win_t_
+{
+    int            iPivot;    // the pivot node
+    int            Status;    // 0 = pending; 1 = accepted; 2 = rejected
+    Vec_Int_t *    vIns;      // window inputs
+    Vec_Int_t *    vNodes;    // window internal nodes
+    Vec_Int_t *    vOuts;     // window outputs
+    Gia_Man_t *    pIn;       // window AIG
+    Gia_Man_t *    pOut;      // resynthesized window AIG
+};
+
+typedef struct Gia_Rsb3Job_t_ Gia_Rsb3Job_t;
+struct Gia_Rsb3Job_t_
+{
+    Gia_ResbMan_t * pResb;    // resub manager of this thread
+    Vec_Ptr_t *     vWins;    // windows to resynthesize
+    int             nDivsMax; // the max number of divisors
+};
+
+extern Gia_ResbMan_t * Gia_ResbAlloc( int nWords );
+extern void            Gia_ResbFree( Gia_ResbMan_t * p );
+extern Gia_Man_t *     Gia_ManResub2Window( Gia_Man_t * p, Gia_ResbMan_t * pResb, int nDivsMax );
+extern int             Gia_RsbWindowCompute( Gia_Man_t * p, int iObj, int nInputsMax, int nLevelsMax, Vec_Wec_t * vLevels, Vec_Int_t * vPaths, Vec_Int_t ** pvWin, Vec_Int_t ** pvIns );
+extern Vec_Int_t *     Gia_RsbFindOutputs( Gia_Man_t * p, Vec_Int_t * vWin, Vec_Int_t * vIns, Vec_Int_t * vRefs );
+extern Gia_Man_t *     Gia_RsbDeriveGiaFromWindows( Gia_Man_t * p, Vec_Int_t * vWin, Vec_Int_t * vIns, Vec_Int_t * vOuts );
+extern int             Gia_ManVerifyTwoTruths( Gia_Man_t * p1, Gia_Man_t * p2 );
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Window manipulation.]
 
   Description []
-               
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_Rsb3WinFree( Gia_Rsb3Win_t * pWin )
+{
+    Vec_IntFreeP( &pWin->vIns );
+    Vec_IntFreeP( &pWin->vNodes );
+    Vec_IntFreeP( &pWin->vOuts );
+    Gia_ManStopP( &pWin->pIn );
+    Gia_ManStopP( &pWin->pOut );
+    ABC_FREE( pWin );
+}
+// returns 0 if the window can be added; 1 if it overlaps with a pending window; 2 if it overlaps with an accepted one
+int Gia_Rsb3WinCheck( Vec_Ptr_t * vWins, Vec_Int_t * vOwner, Vec_Bit_t * vIsOut, Vec_Int_t * vWin, Vec_Int_t * vIns )
+{
+    Gia_Rsb3Win_t * pWin;
+    int i, iObj, iOwner, Res = 0;
+    Vec_IntForEachEntry( vWin, iObj, i )
+    {
+        if ( (iOwner = Vec_IntEntry(vOwner, iObj)) == -1 )
+            continue;
+        // the inputs may be the outputs of other windows, because their functions are preserved
+        if ( Vec_IntFind(vIns, iObj) >= 0 && Vec_BitEntry(vIsOut, iObj) )
+            continue;
+        pWin = (Gia_Rsb3Win_t *)Vec_PtrEntry( vWins, iOwner );
+        if ( pWin->Status == 1 )
+            return 2;
+        Res = 1;
+    }
+    return Res;
+}
+void Gia_Rsb3WinMark( Gia_Rsb3Win_t * pWin, Vec_Int_t * vOwner, Vec_Bit_t * vIsOut, int iWin )
+{
+    int i, iObj;
+    Vec_IntForEachEntry( pWin->vNodes, iObj, i )
+        Vec_IntWriteEntry( vOwner, iObj, iWin );
+    Vec_IntForEachEntry( pWin->vOuts, iObj, i )
+        Vec_BitWriteEntry( vIsOut, iObj, iWin >= 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Resynthesizes the windows assigned to one thread.]
+
+  Description [A window is kept only if the number of AND nodes is reduced
+  and the result is verified to be equivalent using truth tables.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_Rsb3SolveJob( void * pArg )
+{
+    Gia_Rsb3Job_t * pJob = (Gia_Rsb3Job_t *)pArg;
+    Gia_Rsb3Win_t * pWin;
+    int i;
+    Vec_PtrForEachEntry( Gia_Rsb3Win_t *, pJob->vWins, pWin, i )
+    {
+        pWin->pOut = Gia_ManResub2Window( pWin->pIn, pJob->pResb, pJob->nDivsMax );
+        if ( pWin->pOut == NULL )
+            continue;
+        if ( Gia_ManAndNum(pWin->pOut) >= Gia_ManAndNum(pWin->pIn) || !Gia_ManVerifyTwoTruths(pWin->pIn, pWin->pOut) )
+            Gia_ManStopP( &pWin->pOut );
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the new AIG with the accepted windows.]
+
+  Description [The AIG is constructed recursively from the COs. When an
+  output of an accepted window is reached for the first time, the inputs
+  of the window are constructed and the resynthesized window is inserted.
+  If the construction of the inputs leads back to the same window, the
+  replacement would create a combinational loop; in this case, the window
+  is dropped and its original structure is used instead.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_Rsb3InsertWindow( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Rsb3Win_t * pWin )
+{
+    Gia_Obj_t * pObj;
+    int i;
+    Gia_ManConst0(pWin->pOut)->Value = 0;
+    Gia_ManForEachCi( pWin->pOut, pObj, i )
+        pObj->Value = Gia_ManObj( p, Vec_IntEntry(pWin->vIns, i) )->Value;
+    Gia_ManForEachAnd( pWin->pOut, pObj, i )
+    {
+        assert( !Gia_ObjIsXor(pObj) );
+        pObj->Value = Gia_ManHashAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+    }
+    Gia_ManForEachCo( pWin->pOut, pObj, i )
+        Gia_ManObj( p, Vec_IntEntry(pWin->vOuts, i) )->Value = Gia_ObjFanin0Copy(pObj);
+}
+int Gia_Rsb3Rebuild_rec( Gia_Man_t * pNew, Gia_Man_t * p, int iObj, Vec_Ptr_t * vWins, Vec_Int_t * vOut2Win, int * pnLoops )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
+    int k, iIn, iWin = Vec_IntEntry( vOut2Win, iObj );
+    if ( ~pObj->Value )
+        return pObj->Value;
+    if ( iWin >= 0 )
+    {
+        Gia_Rsb3Win_t * pWin = (Gia_Rsb3Win_t *)Vec_PtrEntry( vWins, iWin );
+        if ( pWin->Status == 1 )
+        {
+            pWin->Status = 3; // in progress
+            Vec_IntForEachEntry( pWin->vIns, iIn, k )
+                Gia_Rsb3Rebuild_rec( pNew, p, iIn, vWins, vOut2Win, pnLoops );
+            if ( pWin->Status == 3 )
+            {
+                Gia_Rsb3InsertWindow( pNew, p, pWin );
+                pWin->Status = 4; // inserted
+                assert( ~pObj->Value );
+                return pObj->Value;
+            }
+            assert( pWin->Status == 2 );
+        }
+        else if ( pWin->Status == 3 )
+        {
+            pWin->Status = 2;
+            (*pnLoops)++;
+        }
+    }
+    assert( Gia_ObjIsAnd(pObj) );
+    Gia_Rsb3Rebuild_rec( pNew, p, Gia_ObjFaninId0(pObj, iObj), vWins, vOut2Win, pnLoops );
+    Gia_Rsb3Rebuild_rec( pNew, p, Gia_ObjFaninId1(pObj, iObj), vWins, vOut2Win, pnLoops );
+    return pObj->Value = Gia_ManHashAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+}
+Gia_Man_t * Gia_Rsb3Rebuild( Gia_Man_t * p, Vec_Ptr_t * vWins, int * pnLoops )
+{
+    Gia_Man_t * pNew, * pTemp;
+    Gia_Rsb3Win_t * pWin;
+    Gia_Obj_t * pObj;
+    Vec_Int_t * vOut2Win = Vec_IntStartFull( Gia_ManObjNum(p) );
+    int i, k, iObj;
+    Vec_PtrForEachEntry( Gia_Rsb3Win_t *, vWins, pWin, i )
+        if ( pWin->Status == 1 )
+            Vec_IntForEachEntry( pWin->vOuts, iObj, k )
+                Vec_IntWriteEntry( vOut2Win, iObj, i );
+    pNew = Gia_ManStart( Gia_ManObjNum(p) );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    pNew->pSpec = Abc_UtilStrsav( p->pSpec );
+    Gia_ManFillValue( p );
+    Gia_ManConst0(p)->Value = 0;
+    Gia_ManForEachCi( p, pObj, i )
+        pObj->Value = Gia_ManAppendCi( pNew );
+    Gia_ManHashAlloc( pNew );
+    Gia_ManForEachCo( p, pObj, i )
+        Gia_Rsb3Rebuild_rec( pNew, p, Gia_ObjFaninId0p(p, pObj), vWins, vOut2Win, pnLoops );
+    Gia_ManForEachCo( p, pObj, i )
+        pObj->Value = Gia_ManAppendCo( pNew, Gia_ObjFanin0Copy(pObj) );
+    Gia_ManHashStop( pNew );
+    Gia_ManSetRegNum( pNew, Gia_ManRegNum(p) );
+    Vec_IntFree( vOut2Win );
+    pNew = Gia_ManCleanup( pTemp = pNew );
+    Gia_ManStop( pTemp );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs windowed resubstitution of the AIG.]
+
+  Description [Each AND node is used as a pivot to compute a window with
+  at most nCutSize (<= 6) inputs, which is resynthesized by the truth-table
+  based resubstitution engine. The windows are selected on the main thread
+  in rounds; each round collects the non-overlapping windows of all pending
+  pivots (a pivot whose window overlaps with a pending window of the round
+  is deferred to the next round), which are then resynthesized by nProcs
+  threads of a pool that is kept alive between the rounds. The results are committed in the order
+  of the pivots, so the resulting AIG does not depend on the number of
+  threads. Finally, the AIG is rebuilt with the improved windows.]
+
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_ManPerformNewResub( Gia_Man_t * p, int nWinCount, int nCutSize, int nProcs, int fVerbose )
+Gia_Man_t * Gia_ManPerformNewResub( Gia_Man_t * p, int nWinCount, int nCutSize, int nDivsMax, int nProcs, int fVerbose )
 {
-    return NULL;
+    int nLevelsMax = 20;
+    int nJobs = Abc_MaxInt( 1, nProcs - 1 );
+    Gia_Man_t * pNew;
+    Gia_Rsb3Job_t * pJobs;
+    Gia_Rsb3Win_t * pWin;
+    Util_ThPool_t * pPool;
+    Vec_Ptr_t * vJobs   = Vec_PtrAlloc( nJobs );
+    Vec_Ptr_t * vWins   = Vec_PtrAlloc( 1000 );
+    Vec_Ptr_t * vBatch  = Vec_PtrAlloc( 1000 );
+    Vec_Int_t * vOwner  = Vec_IntStartFull( Gia_ManObjNum(p) );
+    Vec_Bit_t * vIsOut  = Vec_BitStart( Gia_ManObjNum(p) );
+    Vec_Int_t * vRefs   = Vec_IntStart( Gia_ManObjNum(p) );
+    Vec_Int_t * vPaths  = Vec_IntStart( Gia_ManObjNum(p) );
+    Vec_Int_t * vPivots = Vec_IntAlloc( Gia_ManAndNum(p) );
+    Vec_Int_t * vDefer  = Vec_IntAlloc( 100 );
+    Vec_Int_t * vDeferNew = Vec_IntAlloc( 100 );
+    Vec_Int_t * vWin, * vIns;
+    Vec_Wec_t * vLevels;
+    Gia_Obj_t * pObj;
+    int i, k, iObj, iPivot, iNext = 0, nTried = 0, nWinsAll = 0, nImproved = 0, nGain = 0, nRounds = 0, nLoops = 0;
+    abctime clk = Abc_Clock(), clkWin = 0, clkRes = 0, clkBld;
+    if ( nCutSize <= 0 || nCutSize > 6 )
+        nCutSize = 6;
+    if ( nDivsMax <= 0 )
+        nDivsMax = 1000;
+    if ( Gia_ManHasChoices(p) || p->pMuxes )
+    {
+        printf( "Resubstitution cannot be applied to the AIG with choices or XOR/MUX nodes.\n" );
+        return Gia_ManDup( p );
+    }
+    pJobs = ABC_CALLOC( Gia_Rsb3Job_t, nJobs );
+    for ( k = 0; k < nJobs; k++ )
+    {
+        pJobs[k].pResb    = Gia_ResbAlloc( 1 );
+        pJobs[k].vWins    = Vec_PtrAlloc( 1000 );
+        pJobs[k].nDivsMax = nDivsMax;
+        Vec_PtrPush( vJobs, pJobs + k );
+    }
+    pPool = Util_ThPoolStart( Gia_Rsb3SolveJob, nProcs );
+    vLevels = Vec_WecStart( Gia_ManLevelNum(p) + 1 );
+    Gia_ManStaticFanoutStart( p );
+    Gia_ManFillValue( p );
+    Gia_ManForEachAnd( p, pObj, i )
+        Vec_IntPush( vPivots, i );
+    while ( iNext < Vec_IntSize(vPivots) || Vec_IntSize(vDefer) > 0 )
+    {
+        abctime clk2 = Abc_Clock();
+        // select the non-overlapping windows of this round (deferred pivots go first)
+        Vec_PtrClear( vBatch );
+        Vec_IntClear( vDeferNew );
+        for ( i = 0; i < Vec_IntSize(vDefer) || iNext < Vec_IntSize(vPivots); )
+        {
+            if ( nWinCount && nTried == nWinCount )
+            {
+                iNext = Vec_IntSize(vPivots);
+                Vec_IntShrink( vDefer, i );
+                break;
+            }
+            iPivot = i < Vec_IntSize(vDefer) ? Vec_IntEntry(vDefer, i++) : Vec_IntEntry(vPivots, iNext++);
+            if ( Vec_IntEntry(vOwner, iPivot) >= 0 )
+            {
+                pWin = (Gia_Rsb3Win_t *)Vec_PtrEntry( vWins, Vec_IntEntry(vOwner, iPivot) );
+                if ( pWin->Status == 0 )
+                    Vec_IntPush( vDeferNew, iPivot );
+                continue;
+            }
+            if ( !Gia_RsbWindowCompute( p, iPivot, nCutSize, nLevelsMax, vLevels, vPaths, &vWin, &vIns ) )
+                continue;
+            k = Gia_Rsb3WinCheck( vWins, vOwner, vIsOut, vWin, vIns );
+            if ( k > 0 )
+            {
+                if ( k == 1 )
+                    Vec_IntPush( vDeferNew, iPivot );
+                Vec_IntFree( vWin );
+                Vec_IntFree( vIns );
+                continue;
+            }
+            nTried++;
+            pWin = ABC_CALLOC( Gia_Rsb3Win_t, 1 );
+            pWin->iPivot = iPivot;
+            pWin->vIns   = vIns;
+            pWin->vOuts  = Gia_RsbFindOutputs( p, vWin, vIns, vRefs );
+            pWin->vNodes = Vec_IntAlloc( Vec_IntSize(vWin) );
+            Vec_IntForEachEntry( vWin, iObj, k )
+                if ( Vec_IntFind(vIns, iObj) == -1 )
+                    Vec_IntPush( pWin->vNodes, iObj );
+            pWin->pIn = Gia_RsbDeriveGiaFromWindows( p, vWin, vIns, pWin->vOuts );
+            Vec_IntFree( vWin );
+            Gia_Rsb3WinMark( pWin, vOwner, vIsOut, Vec_PtrSize(vWins) );
+            Vec_PtrPush( vWins, pWin );
+            Vec_PtrPush( vBatch, pWin );
+        }
+        ABC_SWAP( Vec_Int_t *, vDefer, vDeferNew );
+        clkWin += Abc_Clock() - clk2;
+        if ( Vec_PtrSize(vBatch) == 0 )
+            continue;
+        // resynthesize the windows
+        clk2 = Abc_Clock();
+        for ( k = 0; k < nJobs; k++ )
+            Vec_PtrClear( pJobs[k].vWins );
+        Vec_PtrForEachEntry( Gia_Rsb3Win_t *, vBatch, pWin, i )
+            Vec_PtrPush( pJobs[i % nJobs].vWins, pWin );
+        Util_ThPoolRun( pPool, vJobs );
+        nRounds++;
+        clkRes += Abc_Clock() - clk2;
+        // commit the results in the order of the pivots
+        Vec_PtrForEachEntry( Gia_Rsb3Win_t *, vBatch, pWin, i )
+        {
+            Gia_ManStopP( &pWin->pIn );
+            if ( pWin->pOut == NULL )
+            {
+                pWin->Status = 2;
+                Gia_Rsb3WinMark( pWin, vOwner, vIsOut, -1 );
+                continue;
+            }
+            pWin->Status = 1;
+            nImproved++;
+        }
+    }
+    Gia_ManStaticFanoutStop( p );
+    Util_ThPoolStop( pPool );
+    nWinsAll = Vec_PtrSize( vWins );
+    // rebuild the AIG
+    clkBld = Abc_Clock();
+    if ( nImproved )
+        pNew = Gia_Rsb3Rebuild( p, vWins, &nLoops );
+    else
+        pNew = Gia_ManDup( p );
+    clkBld = Abc_Clock() - clkBld;
+    nGain = Gia_ManAndNum(p) - Gia_ManAndNum(pNew);
+    if ( fVerbose )
+    {
+        printf( "Pivots = %d. Windows = %d. Improved = %d. Loops = %d. Rounds = %d. Threads = %d. Gain = %d nodes (%.2f %%).\n",
+            Vec_IntSize(vPivots), nWinsAll, nImproved - nLoops, nLoops, nRounds, nProcs, nGain, 100.0*nGain/Abc_MaxInt(1, Gia_ManAndNum(p)) );
+        Abc_PrintTime( 1, "Windowing", clkWin );
+        Abc_PrintTime( 1, "Resub    ", clkRes );
+        Abc_PrintTime( 1, "Rebuild  ", clkBld );
+        Abc_PrintTime( 1, "Total    ", Abc_Clock() - clk );
+    }
+    // cleanup
+    Vec_PtrForEachEntry( Gia_Rsb3Win_t *, vWins, pWin, i )
+        Gia_Rsb3WinFree( pWin );
+    for ( k = 0; k < nJobs; k++ )
+    {
+        Gia_ResbFree( pJobs[k].pResb );
+        Vec_PtrFree( pJobs[k].vWins );
+    }
+    ABC_FREE( pJobs );
+    Vec_PtrFree( vJobs );
+    Vec_PtrFree( vWins );
+    Vec_PtrFree( vBatch );
+    Vec_IntFree( vOwner );
+    Vec_BitFree( vIsOut );
+    Vec_IntFree( vRefs );
+    Vec_IntFree( vPaths );
+    Vec_IntFree( vPivots );
+    Vec_IntFree( vDefer );
+    Vec_IntFree( vDeferNew );
+    Vec_WecFree( vLevels );
+    return pNew;
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -74,6 +74,7 @@ struct Sbl_Man_t_
     Vec_Int_t *    vRoots;       // driver nodes (a subset of vAnds)
     Vec_Int_t *    vRootVars;    // driver nodes (as SAT variables)
     Hsh_VecMan_t * pHash;        // hash table for windows
+    Vec_Int_t *    vValues;      // window index of each object (or -1)
     // timing 
     Vec_Int_t *    vArrs;        // arrival times  
     Vec_Int_t *    vReqs;        // required times  
@@ -114,6 +115,8 @@ struct Sbl_Man_t_
 
 extern sat_solver * Sbm_AddCardinSolver( int LogN, Vec_Int_t ** pvVars );
 
+static inline int Sbl_ManObjValue( Sbl_Man_t * p, int iObj ) { return Vec_IntEntry( p->vValues, iObj ); }
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -146,6 +149,7 @@ Sbl_Man_t * Sbl_ManAlloc( Gia_Man_t * pGia, int Number )
     p->vRoots     = Vec_IntAlloc( p->nVars );
     p->vRootVars  = Vec_IntAlloc( p->nVars );
     p->pHash      = Hsh_VecManStart( 1000 );
+    p->vValues    = Vec_IntStartFull( Gia_ManObjNum(pGia) );
     // timing
     p->vArrs      = Vec_IntAlloc( 0 );
     p->vReqs      = Vec_IntAlloc( 0 );
@@ -171,8 +175,6 @@ Sbl_Man_t * Sbl_ManAlloc( Gia_Man_t * pGia, int Number )
     p->vLits      = Vec_IntAlloc( 64 );
     p->vAssump    = Vec_IntAlloc( 64 );
     p->vPolar     = Vec_IntAlloc( 1000 );
-    // other
-    Gia_ManFillValue( pGia );
     return p;
 }
 void Sbl_ManClean( Sbl_Man_t * p )
@@ -211,8 +213,6 @@ void Sbl_ManClean( Sbl_Man_t * p )
     Vec_IntClear( p->vLits );
     Vec_IntClear( p->vAssump );
     Vec_IntClear( p->vPolar );
-    // other
-    Gia_ManFillValue( p->pGia );
 }
 void Sbl_ManStop( Sbl_Man_t * p )
 {
@@ -225,6 +225,7 @@ void Sbl_ManStop( Sbl_Man_t * p )
     Vec_IntFree( p->vRoots );
     Vec_IntFree( p->vRootVars );
     Hsh_VecManStop( p->pHash );
+    Vec_IntFree( p->vValues );
     // timing
     Vec_IntFree( p->vArrs );
     Vec_IntFree( p->vReqs );
@@ -534,20 +535,11 @@ int Sbl_ManEvaluateMapping( Sbl_Man_t * p, int DelayGlo )
   SeeAlso     []
 
 ***********************************************************************/
-void Sbl_ManUpdateMapping( Sbl_Man_t * p )
+void Sbl_ManSaveMapping( Sbl_Man_t * p, Vec_Int_t * vMapping )
 {
-//    Gia_Obj_t * pObj;
-    Vec_Int_t * vObj;
     word CutI1, CutI2, CutN1, CutN2;
-    int i, c, b, iObj, iTemp; 
-    assert( Vec_IntSize(p->vSolBest) < Vec_IntSize(p->vSolInit) );
-    Vec_IntForEachEntry( p->vAnds, iObj, i )
-    {
-        vObj = Vec_WecEntry(p->pGia->vMapping2, iObj);
-        Vec_IntForEachEntry( vObj, iTemp, b )
-            Gia_ObjLutRefDecId( p->pGia, iTemp );
-        Vec_IntClear( vObj );
-    }
+    int i, c, b, iObj, iSize; 
+    Vec_IntClear( vMapping );
     Vec_IntForEachEntry( p->vSolBest, c, i )
     {
         CutI1 = Vec_WrdEntry( p->vCutsI1, c );
@@ -556,43 +548,77 @@ void Sbl_ManUpdateMapping( Sbl_Man_t * p )
         CutN2 = Vec_WrdEntry( p->vCutsN2, c );
         iObj = Vec_IntEntry( p->vCutsObj, c );
         iObj = Vec_IntEntry( p->vAnds, iObj );
-        vObj = Vec_WecEntry( p->pGia->vMapping2, iObj );
-        Vec_IntClear( vObj );
-        assert( Vec_IntSize(vObj) == 0 );
+        Vec_IntPush( vMapping, iObj );
+        iSize = Vec_IntSize( vMapping );
+        Vec_IntPush( vMapping, 0 );
         for ( b = 0; b < 64; b++ )
             if ( (CutI1 >> b) & 1 )
-                Vec_IntPush( vObj, Vec_IntEntry(p->vLeaves, b) );
+                Vec_IntPush( vMapping, Vec_IntEntry(p->vLeaves, b) );
         for ( b = 0; b < 64; b++ )
             if ( (CutI2 >> b) & 1 )
-                Vec_IntPush( vObj, Vec_IntEntry(p->vLeaves, 64+b) );
+                Vec_IntPush( vMapping, Vec_IntEntry(p->vLeaves, 64+b) );
         for ( b = 0; b < 64; b++ )
             if ( (CutN1 >> b) & 1 )
-                Vec_IntPush( vObj, Vec_IntEntry(p->vAnds, b) );
+                Vec_IntPush( vMapping, Vec_IntEntry(p->vAnds, b) );
         for ( b = 0; b < 64; b++ )
             if ( (CutN2 >> b) & 1 )
-                Vec_IntPush( vObj, Vec_IntEntry(p->vAnds, 64+b) );
-        Vec_IntForEachEntry( vObj, iTemp, b )
-            Gia_ObjLutRefIncId( p->pGia, iTemp );
+                Vec_IntPush( vMapping, Vec_IntEntry(p->vAnds, 64+b) );
+        Vec_IntWriteEntry( vMapping, iSize, Vec_IntSize(vMapping) - iSize - 1 );
+    }
+}
+void Sbl_ManApplyMapping( Gia_Man_t * pGia, Vec_Int_t * vAnds, Vec_Int_t * vMapping )
+{
+//    Gia_Obj_t * pObj;
+    Vec_Int_t * vObj;
+    int i, k, iObj, iTemp, nSize; 
+    Vec_IntForEachEntry( vAnds, iObj, i )
+    {
+        vObj = Vec_WecEntry(pGia->vMapping2, iObj);
+        Vec_IntForEachEntry( vObj, iTemp, k )
+            Gia_ObjLutRefDecId( pGia, iTemp );
+        Vec_IntClear( vObj );
+    }
+    for ( i = 0; i < Vec_IntSize(vMapping); i += nSize + 2 )
+    {
+        iObj  = Vec_IntEntry( vMapping, i );
+        nSize = Vec_IntEntry( vMapping, i+1 );
+        vObj  = Vec_WecEntry( pGia->vMapping2, iObj );
+        // the last cut of the node wins if several cuts were selected
+        Vec_IntForEachEntry( vObj, iTemp, k )
+            Gia_ObjLutRefDecId( pGia, iTemp );
+        Vec_IntClear( vObj );
+        for ( k = 0; k < nSize; k++ )
+        {
+            iTemp = Vec_IntEntry( vMapping, i+2+k );
+            Vec_IntPush( vObj, iTemp );
+            Gia_ObjLutRefIncId( pGia, iTemp );
+        }
     }
 /*
     // verify
-    Gia_ManForEachLut2Vec( p->pGia, vObj, i )
-        Vec_IntForEachEntry( vObj, iTemp, b )
-            Gia_ObjLutRefDecId( p->pGia, iTemp );
-    Gia_ManForEachCo( p->pGia, pObj, i )
-        Gia_ObjLutRefDecId( p->pGia, Gia_ObjFaninId0p(p->pGia, pObj) );
-
-    for ( i = 0; i < Gia_ManObjNum(p->pGia); i++ )
-        if ( p->pGia->pLutRefs[i] )
-            printf( "Object %d has %d refs\n", i, p->pGia->pLutRefs[i] );
-
-    Gia_ManForEachCo( p->pGia, pObj, i )
-        Gia_ObjLutRefIncId( p->pGia, Gia_ObjFaninId0p(p->pGia, pObj) );
-    Gia_ManForEachLut2Vec( p->pGia, vObj, i )
-        Vec_IntForEachEntry( vObj, iTemp, b )
-            Gia_ObjLutRefIncId( p->pGia, iTemp );
+    Gia_ManForEachLut2Vec( pGia, vObj, i )
+        Vec_IntForEachEntry( vObj, iTemp, k )
+            Gia_ObjLutRefDecId( pGia, iTemp );
+    Gia_ManForEachCo( pGia, pObj, i )
+        Gia_ObjLutRefDecId( pGia, Gia_ObjFaninId0p(pGia, pObj) );
+
+    for ( i = 0; i < Gia_ManObjNum(pGia); i++ )
+        if ( pGia->pLutRefs[i] )
+            printf( "Object %d has %d refs\n", i, pGia->pLutRefs[i] );
+
+    Gia_ManForEachCo( pGia, pObj, i )
+        Gia_ObjLutRefIncId( pGia, Gia_ObjFaninId0p(pGia, pObj) );
+    Gia_ManForEachLut2Vec( pGia, vObj, i )
+        Vec_IntForEachEntry( vObj, iTemp, k )
+            Gia_ObjLutRefIncId( pGia, iTemp );
 */
 }
+void Sbl_ManUpdateMapping( Sbl_Man_t * p )
+{
+    assert( Vec_IntSize(p->vSolBest) < Vec_IntSize(p->vSolInit) );
+    Sbl_ManSaveMapping( p, p->vLits );
+    Sbl_ManApplyMapping( p->pGia, p->vAnds, p->vLits );
+}
 
 /**Function*************************************************************
 
@@ -768,16 +794,16 @@ int Sbl_ManComputeCuts( Sbl_Man_t * p )
         }
         Vec_WrdPush( p->vCutsN1, 0 );
         Vec_WrdPush( p->vCutsN2, 0 );
-        pObj->Value = i;
+        Vec_IntWriteEntry( p->vValues, Gia_ObjId(p->pGia, pObj), i );
     }
     // assign internal cuts
     Gia_ManForEachObjVec( p->vAnds, p->pGia, pObj, i )
     {
         assert( Gia_ObjIsAnd(pObj) );
-        assert( ~Gia_ObjFanin0(pObj)->Value );
-        assert( ~Gia_ObjFanin1(pObj)->Value );
-        Sbl_ManComputeCutsOne( p, Gia_ObjFanin0(pObj)->Value, Gia_ObjFanin1(pObj)->Value, i );
-        pObj->Value = Vec_IntSize(p->vLeaves) + i;
+        assert( Sbl_ManObjValue(p, Gia_ObjFaninId0p(p->pGia, pObj)) >= 0 );
+        assert( Sbl_ManObjValue(p, Gia_ObjFaninId1p(p->pGia, pObj)) >= 0 );
+        Sbl_ManComputeCutsOne( p, Sbl_ManObjValue(p, Gia_ObjFaninId0p(p->pGia, pObj)), Sbl_ManObjValue(p, Gia_ObjFaninId1p(p->pGia, pObj)), i );
+        Vec_IntWriteEntry( p->vValues, Gia_ObjId(p->pGia, pObj), Vec_IntSize(p->vLeaves) + i );
     }
     assert( Vec_IntSize(p->vCutsStart) == nObjs );
     assert( Vec_IntSize(p->vCutsNum)   == nObjs );
@@ -792,8 +818,8 @@ int Sbl_ManComputeCuts( Sbl_Man_t * p )
         if ( Gia_ObjIsCi(pObj) )
             continue;
         assert( Gia_ObjIsLut2(p->pGia, Obj) );
-        assert( ~pObj->Value );
-        Vec_IntPush( p->vRootVars, pObj->Value - Vec_IntSize(p->vLeaves) );
+        assert( Sbl_ManObjValue(p, Obj) >= 0 );
+        Vec_IntPush( p->vRootVars, Sbl_ManObjValue(p, Obj) - Vec_IntSize(p->vLeaves) );
     }
     // create current solution
     Vec_IntClear( p->vPolar );
@@ -804,7 +830,7 @@ int Sbl_ManComputeCuts( Sbl_Man_t * p )
         int Obj = Gia_ObjId(p->pGia, pObj);
         if ( !Gia_ObjIsLut2(p->pGia, Obj) )
             continue;
-        assert( (int)pObj->Value == Vec_IntSize(p->vLeaves) + i );
+        assert( Sbl_ManObjValue(p, Obj) == Vec_IntSize(p->vLeaves) + i );
         // add node
         Vec_IntPush( p->vPolar, i );
         Vec_IntPush( p->vSolInit, i );
@@ -813,26 +839,25 @@ int Sbl_ManComputeCuts( Sbl_Man_t * p )
         vFanins = Gia_ObjLutFanins2( p->pGia, Obj );
         Vec_IntForEachEntry( vFanins, Fanin, k )
         {
-            Gia_Obj_t * pFanin = Gia_ManObj( p->pGia, Fanin );
-            assert( (int)pFanin->Value < Vec_IntSize(p->vLeaves) || Gia_ObjIsLut2(p->pGia, Fanin) );
-//            if ( ~pFanin->Value == 0 )
+            int Value = Sbl_ManObjValue( p, Fanin );
+            assert( Value < Vec_IntSize(p->vLeaves) || Gia_ObjIsLut2(p->pGia, Fanin) );
+//            if ( Value == -1 )
 //                Gia_ManPrintConeMulti( p->pGia, p->vAnds, p->vLeaves, p->vPath );
-            if ( ~pFanin->Value == 0 ) 
+            if ( Value == -1 ) 
                 continue;
-            assert( ~pFanin->Value );
-            if ( (int)pFanin->Value < Vec_IntSize(p->vLeaves) )
+            if ( Value < Vec_IntSize(p->vLeaves) )
             {
-                if ( (int)pFanin->Value < 64 )
-                    CutI1 |= ((word)1 << pFanin->Value);
+                if ( Value < 64 )
+                    CutI1 |= ((word)1 << Value);
                 else
-                    CutI2 |= ((word)1 << (pFanin->Value - 64));
+                    CutI2 |= ((word)1 << (Value - 64));
             }
             else
             {
-                if ( pFanin->Value - Vec_IntSize(p->vLeaves) < 64 )
-                    CutN1 |= ((word)1 << (pFanin->Value - Vec_IntSize(p->vLeaves)));
+                if ( Value - Vec_IntSize(p->vLeaves) < 64 )
+                    CutN1 |= ((word)1 << (Value - Vec_IntSize(p->vLeaves)));
                 else
-                    CutN2 |= ((word)1 << (pFanin->Value - Vec_IntSize(p->vLeaves) - 64));
+                    CutN2 |= ((word)1 << (Value - Vec_IntSize(p->vLeaves) - 64));
             }
         }
         // find the new cut
@@ -847,9 +872,9 @@ int Sbl_ManComputeCuts( Sbl_Man_t * p )
     }
     // clean value
     Gia_ManForEachObjVec( p->vLeaves, p->pGia, pObj, i )
-        pObj->Value = ~0;
+        Vec_IntWriteEntry( p->vValues, Gia_ObjId(p->pGia, pObj), -1 );
     Gia_ManForEachObjVec( p->vAnds, p->pGia, pObj, i )
-        pObj->Value = ~0;
+        Vec_IntWriteEntry( p->vValues, Gia_ObjId(p->pGia, pObj), -1 );
     p->timeCut += Abc_Clock() - clk;
     return Vec_WrdSize(p->vCutsI1);
 }
@@ -964,50 +989,23 @@ int Sbl_ManWindow2( Sbl_Man_t * p, int iPivot )
     return Count;
 }
 
-int Sbl_ManTestSat( Sbl_Man_t * p, int iPivot )
-{
-    int fKeepTrying = 1;
-    abctime clk = Abc_Clock(), clk2;
-    int i, status, Root, Count, StartSol, nConfTotal = 0, nIters = 0;
-    int nEntries = Hsh_VecSize( p->pHash );
-    p->nTried++;
+/**Function*************************************************************
 
-    Sbl_ManClean( p );
+  Synopsis    [Solves the window currently loaded into the manager.]
 
-    // compute one window
-    Count = Sbl_ManWindow2( p, iPivot );
-    if ( Count == 0 )
-    {
-        if ( p->fVeryVerbose )
-        printf( "Obj %d: Window with less than %d nodes does not exist.\n", iPivot, p->nVars );
-        p->nSmallWins++;
-        return 0;
-    }
-    Hsh_VecManAdd( p->pHash, p->vAnds );
-    if ( nEntries == Hsh_VecSize(p->pHash) )
-    {
-        if ( p->fVeryVerbose )
-        printf( "Obj %d: This window was already tried.\n", iPivot );
-        p->nHashWins++;
-        return 0;
-    }
-    if ( p->fVeryVerbose )
-    printf( "\nObj = %6d : Leaf = %2d.  AND = %2d.  Root = %2d.    LUT = %2d.\n", 
-        iPivot, Vec_IntSize(p->vLeaves), Vec_IntSize(p->vAnds), Vec_IntSize(p->vRoots), Vec_IntSize(p->vNodes) ); 
+  Description [Returns 1 if a mapping with fewer LUTs is found. In this 
+  case, the new mapping is in p->vSolBest. The window is not changed.]
+               
+  SideEffects []
 
-    if ( Vec_IntSize(p->vLeaves) > 128 || Vec_IntSize(p->vAnds) > p->nVars )
-    {
-        if ( p->fVeryVerbose )
-        printf( "Obj %d: Encountered window with %d inputs and %d internal nodes.\n", iPivot, Vec_IntSize(p->vLeaves), Vec_IntSize(p->vAnds) );
-        p->nLargeWins++;
-        return 0;
-    }
-    if ( Vec_IntSize(p->vAnds) < 10 )
-    {
-        if ( p->fVeryVerbose )
-        printf( "Skipping.\n" );
-        return 0;
-    }
+  SeeAlso     []
+
+***********************************************************************/
+int Sbl_ManSolveWindow( Sbl_Man_t * p, int * pnConfTotal, int * pnIters )
+{
+    int fKeepTrying = 1;
+    abctime clk = Abc_Clock(), clk2;
+    int i, status, Root, StartSol, nConfTotal = 0, nIters = 0;
 
     // derive cuts
     Sbl_ManComputeCuts( p );
@@ -1147,8 +1145,55 @@ int Sbl_ManTestSat( Sbl_Man_t * p, int iPivot )
         }
     }
 
-    // update solution
-    if ( Vec_IntSize(p->vSolBest) > 0 && Vec_IntSize(p->vSolBest) < Vec_IntSize(p->vSolInit) )
+    *pnConfTotal = nConfTotal;
+    *pnIters = nIters;
+    return Vec_IntSize(p->vSolBest) > 0 && Vec_IntSize(p->vSolBest) < Vec_IntSize(p->vSolInit);
+}
+int Sbl_ManTestSat( Sbl_Man_t * p, int iPivot )
+{
+    int Count, nConfTotal = 0, nIters = 0;
+    int nEntries = Hsh_VecSize( p->pHash );
+    p->nTried++;
+
+    Sbl_ManClean( p );
+
+    // compute one window
+    Count = Sbl_ManWindow2( p, iPivot );
+    if ( Count == 0 )
+    {
+        if ( p->fVeryVerbose )
+        printf( "Obj %d: Window with less than %d nodes does not exist.\n", iPivot, p->nVars );
+        p->nSmallWins++;
+        return 0;
+    }
+    Hsh_VecManAdd( p->pHash, p->vAnds );
+    if ( nEntries == Hsh_VecSize(p->pHash) )
+    {
+        if ( p->fVeryVerbose )
+        printf( "Obj %d: This window was already tried.\n", iPivot );
+        p->nHashWins++;
+        return 0;
+    }
+    if ( p->fVeryVerbose )
+    printf( "\nObj = %6d : Leaf = %2d.  AND = %2d.  Root = %2d.    LUT = %2d.\n", 
+        iPivot, Vec_IntSize(p->vLeaves), Vec_IntSize(p->vAnds), Vec_IntSize(p->vRoots), Vec_IntSize(p->vNodes) ); 
+
+    if ( Vec_IntSize(p->vLeaves) > 128 || Vec_IntSize(p->vAnds) > p->nVars )
+    {
+        if ( p->fVeryVerbose )
+        printf( "Obj %d: Encountered window with %d inputs and %d internal nodes.\n", iPivot, Vec_IntSize(p->vLeaves), Vec_IntSize(p->vAnds) );
+        p->nLargeWins++;
+        return 0;
+    }
+    if ( Vec_IntSize(p->vAnds) < 10 )
+    {
+        if ( p->fVeryVerbose )
+        printf( "Skipping.\n" );
+        return 0;
+    }
+
+    // solve the window and update solution
+    if ( Sbl_ManSolveWindow( p, &nConfTotal, &nIters ) )
     {
         int nDelayCur, nEdgesCur = 0;
         Sbl_ManUpdateMapping( p );
@@ -1187,10 +1232,254 @@ void Sbl_ManPrintRuntime( Sbl_Man_t * p )
     ABC_PRTP( "Other ", p->timeOther,   p->timeTotal );
     ABC_PRTP( "ALL   ", p->timeTotal,   p->timeTotal );
 }
-void Gia_ManLutSat( Gia_Man_t * pGia, int LutSize, int nNumber, int nImproves, int nBTLimit, int DelayMax, int nEdges, int fDelay, int fReverse, int fVerbose, int fVeryVerbose )
+
+/**Function*************************************************************
+
+  Synopsis    [Parallel SAT-based remapping.]
+
+  Description [Windows are selected on the main thread in batches. A 
+  window is added to the batch only if its internal nodes do not overlap 
+  with the internal nodes or the leaves of the windows already in the 
+  batch; otherwise, its pivot is deferred to the next batch. The windows 
+  of a batch are solved by the threads, each owning its own SAT solver, 
+  against the same snapshot of the mapping. Because the windows are 
+  disjoint, the improved mappings are committed without conflicts.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Sbl_Win_t_ Sbl_Win_t;
+struct Sbl_Win_t_
+{
+    int            iPivot;       // pivot node
+    int            nSaved;       // the number of LUTs saved
+    int            nConfs;       // conflicts used
+    int            nIters;       // SAT iterations
+    Vec_Int_t *    vLeaves;      // leaf nodes
+    Vec_Int_t *    vAnds;        // AND-gates
+    Vec_Int_t *    vNodes;       // internal LUTs
+    Vec_Int_t *    vRoots;       // driver nodes
+    Vec_Int_t *    vMapping;     // improved mapping (iObj, nFans, fanins)
+};
+typedef struct Sbl_Job_t_ Sbl_Job_t;
+struct Sbl_Job_t_
+{
+    Sbl_Man_t *    pMan;         // manager with its own SAT solver
+    Vec_Ptr_t *    vWins;        // windows assigned to this thread
+};
+int Sbl_ManSolveJob( void * pArg )
+{
+    Sbl_Job_t * pJob = (Sbl_Job_t *)pArg;
+    Sbl_Man_t * p = pJob->pMan;
+    Sbl_Win_t * pWin; int i;
+    Vec_PtrForEachEntry( Sbl_Win_t *, pJob->vWins, pWin, i )
+    {
+        Sbl_ManClean( p );
+        Vec_IntAppend( p->vLeaves, pWin->vLeaves );
+        Vec_IntAppend( p->vAnds,   pWin->vAnds );
+        Vec_IntAppend( p->vNodes,  pWin->vNodes );
+        Vec_IntAppend( p->vRoots,  pWin->vRoots );
+        Vec_IntClear( pWin->vMapping );
+        pWin->nSaved = 0;
+        p->nTried++;
+        if ( Sbl_ManSolveWindow( p, &pWin->nConfs, &pWin->nIters ) )
+        {
+            pWin->nSaved = Vec_IntSize(p->vSolInit) - Vec_IntSize(p->vSolBest);
+            Sbl_ManSaveMapping( p, pWin->vMapping );
+        }
+        p->timeTotal += Abc_Clock() - p->timeStart;
+    }
+    return 1;
+}
+static inline int Sbl_ManWinOverlaps( Vec_Bit_t * vMarkAnds, Vec_Bit_t * vMarkLeaves, Vec_Int_t * vLeaves, Vec_Int_t * vAnds )
+{
+    int i, iObj;
+    Vec_IntForEachEntry( vAnds, iObj, i )
+        if ( Vec_BitEntry(vMarkAnds, iObj) || Vec_BitEntry(vMarkLeaves, iObj) )
+            return 1;
+    Vec_IntForEachEntry( vLeaves, iObj, i )
+        if ( Vec_BitEntry(vMarkAnds, iObj) )
+            return 1;
+    return 0;
+}
+static inline void Sbl_ManWinMark( Vec_Bit_t * vMarkAnds, Vec_Bit_t * vMarkLeaves, Vec_Int_t * vLeaves, Vec_Int_t * vAnds, int Value )
+{
+    int i, iObj;
+    Vec_IntForEachEntry( vAnds, iObj, i )
+        Vec_BitWriteEntry( vMarkAnds, iObj, Value );
+    Vec_IntForEachEntry( vLeaves, iObj, i )
+        Vec_BitWriteEntry( vMarkLeaves, iObj, Value );
+}
+void Gia_ManLutSatPar( Gia_Man_t * pGia, int LutSize, int nNumber, int nImproves, int nBTLimit, int nProcs, int fReverse, int fVerbose )
+{
+    abctime clk = Abc_Clock(), clkWin = 0;
+    int nJobs  = Abc_MaxInt( 1, nProcs - 1 );
+    int nBatch = 16 * nJobs;
+    Sbl_Job_t * pJobs = ABC_CALLOC( Sbl_Job_t, nJobs );
+    Sbl_Win_t * pWins = ABC_CALLOC( Sbl_Win_t, nBatch );
+    Vec_Ptr_t * vJobs = Vec_PtrAlloc( nJobs );
+    Vec_Bit_t * vMarkAnds   = Vec_BitStart( Gia_ManObjNum(pGia) );
+    Vec_Bit_t * vMarkLeaves = Vec_BitStart( Gia_ManObjNum(pGia) );
+    Vec_Int_t * vPivots = Vec_IntAlloc( Gia_ManObjNum(pGia) );
+    Vec_Int_t * vDefer  = Vec_IntAlloc( nBatch ), * vDeferNew = Vec_IntAlloc( nBatch );
+    Hsh_VecMan_t * pHash = Hsh_VecManStart( 1000 );
+    Vec_Int_t * vRoots, * vNodes, * vLeaves, * vAnds;
+    int i, k, iLut, iNext = 0, nWins, nBatches = 0, nImproveCount = 0, nSaved = 0, nEntries;
+    int nTried = 0, nImproved = 0, nHashWins = 0, nSmallWins = 0, nLargeWins = 0, nRuns = 0, nIterOuts = 0;
+    for ( k = 0; k < nJobs; k++ )
+    {
+        pJobs[k].pMan = Sbl_ManAlloc( pGia, nNumber );
+        pJobs[k].pMan->LutSize  = LutSize;
+        pJobs[k].pMan->nBTLimit = nBTLimit;
+        pJobs[k].pMan->fReverse = fReverse;
+        pJobs[k].vWins = Vec_PtrAlloc( 16 );
+        Vec_PtrPush( vJobs, pJobs + k );
+    }
+    for ( i = 0; i < nBatch; i++ )
+    {
+        pWins[i].vLeaves  = Vec_IntAlloc( 128 );
+        pWins[i].vAnds    = Vec_IntAlloc( 128 );
+        pWins[i].vNodes   = Vec_IntAlloc( 128 );
+        pWins[i].vRoots   = Vec_IntAlloc( 128 );
+        pWins[i].vMapping = Vec_IntAlloc( 128 );
+    }
+    if ( fVerbose )
+    printf( "Parameters: WinSize = %d AIG nodes.  Conf = %d.  Threads = %d.  Batch = %d windows.\n", nNumber, nBTLimit, nProcs, nBatch );
+    Gia_ManComputeOneWinStart( pGia, nNumber, fReverse );
+    Gia_ManForEachLut2( pGia, iLut )
+        Vec_IntPush( vPivots, iLut );
+    while ( iNext < Vec_IntSize(vPivots) || Vec_IntSize(vDefer) > 0 )
+    {
+        abctime clk2 = Abc_Clock();
+        // select the batch of non-overlapping windows (deferred pivots go first)
+        Vec_IntClear( vDeferNew );
+        for ( nWins = 0, i = 0; nWins < nBatch && (i < Vec_IntSize(vDefer) || iNext < Vec_IntSize(vPivots)); )
+        {
+            iLut = i < Vec_IntSize(vDefer) ? Vec_IntEntry(vDefer, i++) : Vec_IntEntry(vPivots, iNext++);
+            if ( !Gia_ObjIsLut2(pGia, iLut) )
+                continue;
+            if ( Gia_ManComputeOneWin( pGia, iLut, &vRoots, &vNodes, &vLeaves, &vAnds ) == 0 )
+            {
+                nTried++;
+                nSmallWins++;
+                continue;
+            }
+            if ( Sbl_ManWinOverlaps( vMarkAnds, vMarkLeaves, vLeaves, vAnds ) )
+            {
+                Vec_IntPush( vDeferNew, iLut );
+                continue;
+            }
+            nTried++;
+            nEntries = Hsh_VecSize( pHash );
+            Hsh_VecManAdd( pHash, vAnds );
+            if ( nEntries == Hsh_VecSize(pHash) )
+            {
+                nHashWins++;
+                continue;
+            }
+            if ( Vec_IntSize(vLeaves) > 128 || Vec_IntSize(vAnds) > nNumber )
+            {
+                nLargeWins++;
+                continue;
+            }
+            if ( Vec_IntSize(vAnds) < 10 )
+                continue;
+            Sbl_ManWinMark( vMarkAnds, vMarkLeaves, vLeaves, vAnds, 1 );
+            pWins[nWins].iPivot = iLut;
+            Vec_IntClear( pWins[nWins].vLeaves );  Vec_IntAppend( pWins[nWins].vLeaves, vLeaves );
+            Vec_IntClear( pWins[nWins].vAnds );    Vec_IntAppend( pWins[nWins].vAnds,   vAnds );
+            Vec_IntClear( pWins[nWins].vNodes );   Vec_IntAppend( pWins[nWins].vNodes,  vNodes );
+            Vec_IntClear( pWins[nWins].vRoots );   Vec_IntAppend( pWins[nWins].vRoots,  vRoots );
+            nWins++;
+        }
+        // the unexamined deferred pivots stay ahead of the new ones
+        for ( ; i < Vec_IntSize(vDefer); i++ )
+            Vec_IntPush( vDeferNew, Vec_IntEntry(vDefer, i) );
+        ABC_SWAP( Vec_Int_t *, vDefer, vDeferNew );
+        clkWin += Abc_Clock() - clk2;
+        if ( nWins == 0 )
+            continue;
+        // solve the windows
+        for ( k = 0; k < nJobs; k++ )
+            Vec_PtrClear( pJobs[k].vWins );
+        for ( i = 0; i < nWins; i++ )
+            Vec_PtrPush( pJobs[i % nJobs].vWins, pWins + i );
+        Util_ProcessThreads( Sbl_ManSolveJob, vJobs, nProcs, 0, 0 );
+        nBatches++;
+        // commit the improvements
+        for ( i = 0; i < nWins; i++ )
+        {
+            Sbl_Win_t * pWin = pWins + i;
+            Sbl_ManWinMark( vMarkAnds, vMarkLeaves, pWin->vLeaves, pWin->vAnds, 0 );
+            if ( pWin->nSaved == 0 || (nImproves && nImproveCount == nImproves) )
+                continue;
+            Sbl_ManApplyMapping( pGia, pWin->vAnds, pWin->vMapping );
+            if ( fVerbose > 1 )
+            printf( "Object %5d : Saved %2d nodes  (Conf =%8d)  Iter =%3d\n", pWin->iPivot, pWin->nSaved, pWin->nConfs, pWin->nIters );
+            nSaved += pWin->nSaved;
+            nImproved++;
+            nImproveCount++;
+        }
+        if ( nImproves && nImproveCount == nImproves )
+            break;
+    }
+    Gia_ManComputeOneWin( pGia, -1, NULL, NULL, NULL, NULL );
+    for ( k = 0; k < nJobs; k++ )
+    {
+        nRuns     += pJobs[k].pMan->nRuns;
+        nIterOuts += pJobs[k].pMan->nIterOuts;
+    }
+    if ( fVerbose )
+    {
+        printf( "Tried = %d. Used = %d. HashWin = %d. SmallWin = %d. LargeWin = %d. IterOut = %d.  SAT runs = %d.\n", 
+            nTried, nImproved, nHashWins, nSmallWins, nLargeWins, nIterOuts, nRuns );
+        printf( "Batches = %d.  Saved LUTs = %d.  ", nBatches, nSaved );
+        Abc_PrintTime( 1, "Windowing", clkWin );
+        for ( k = 0; k < nJobs; k++ )
+        {
+            printf( "Thread %d :  Windows = %6d.  ", k, pJobs[k].pMan->nTried );
+            Abc_PrintTime( 1, "Time", pJobs[k].pMan->timeTotal );
+        }
+        Abc_PrintTime( 1, "Total time", Abc_Clock() - clk );
+    }
+    for ( k = 0; k < nJobs; k++ )
+    {
+        Sbl_ManStop( pJobs[k].pMan );
+        Vec_PtrFree( pJobs[k].vWins );
+    }
+    for ( i = 0; i < nBatch; i++ )
+    {
+        Vec_IntFree( pWins[i].vLeaves );
+        Vec_IntFree( pWins[i].vAnds );
+        Vec_IntFree( pWins[i].vNodes );
+        Vec_IntFree( pWins[i].vRoots );
+        Vec_IntFree( pWins[i].vMapping );
+    }
+    ABC_FREE( pJobs );
+    ABC_FREE( pWins );
+    Vec_PtrFree( vJobs );
+    Vec_BitFree( vMarkAnds );
+    Vec_BitFree( vMarkLeaves );
+    Vec_IntFree( vPivots );
+    Vec_IntFree( vDefer );
+    Vec_IntFree( vDeferNew );
+    Hsh_VecManStop( pHash );
+    Vec_IntFreeP( &pGia->vPacking );
+}
+void Gia_ManLutSat( Gia_Man_t * pGia, int LutSize, int nNumber, int nImproves, int nBTLimit, int DelayMax, int nEdges, int fDelay, int fReverse, int nProcs, int fVerbose, int fVeryVerbose )
 {
     int iLut, nImproveCount = 0;
-    Sbl_Man_t * p   = Sbl_ManAlloc( pGia, nNumber );
+    Sbl_Man_t * p;
+    if ( nProcs > 1 && (fDelay || pGia->vEdge1) )
+        printf( "Delay-oriented and edge-aware remapping is performed on one thread.\n" );
+    else if ( nProcs > 1 )
+    {
+        Gia_ManLutSatPar( pGia, LutSize, nNumber, nImproves, nBTLimit, nProcs, fReverse, fVeryVerbose ? 2 : fVerbose );
+        return;
+    }
+    p = Sbl_ManAlloc( pGia, nNumber );
     p->LutSize      = LutSize;      // LUT size
     p->nBTLimit     = nBTLimit;     // conflicts
     p->DelayMax     = DelayMax;     // external delay
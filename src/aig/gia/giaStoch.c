@@ -31,6 +31,16 @@
 #include <unistd.h>
 #endif
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -170,13 +180,144 @@ int Gia_StochProcess1( void * p )
     return 1;
 }
 
-Vec_Int_t * Gia_StochProcess( Vec_Ptr_t * vGias, char * pScript, int nProcs, int TimeSecs, int fVerbose )
+/**Function*************************************************************
+
+  Synopsis    [Processing on many cores using in-process workers.]
+
+  Description [Each worker thread owns an ABC frame, which is reused for
+  all windows and all iterations. A worker takes the next window from the
+  shared queue as soon as it is done with the previous one. The window is
+  copied into the frame once and the result is taken from the frame
+  without copying. If the script did not reduce the window, the result
+  is NULL and the original window is kept by the caller.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+
+typedef struct StochSynWorker_t_
+{
+    Abc_Frame_t *     pFrame;    // the frame of this worker
+    Vec_Ptr_t *       vGias;     // the windows (shared)
+    Vec_Ptr_t *       vOuts;     // the results (shared)
+    char *            pScript;   // the script to run
+    int *             pNext;     // the next window to process (shared)
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t * pMutex;    // the lock of the queue
+#endif
+} StochSynWorker_t;
+
+Vec_Ptr_t * Gia_StochStartWorkers( int nProcs )
+{
+    Vec_Ptr_t * vFrames = Vec_PtrAlloc( nProcs );
+    int i;
+    // the frames are created before the threads start because command registration is not thread-safe
+    for ( i = 0; i < Abc_MaxInt(1, nProcs-1); i++ )
+        Vec_PtrPush( vFrames, Abc_FrameAllocateWorker() );
+    return vFrames;
+}
+void Gia_StochStopWorkers( Vec_Ptr_t * vFrames )
+{
+    Vec_PtrFreeFunc( vFrames, (void (*)(void *)) Abc_FrameDeallocateWorker );
+}
+Gia_Man_t * Gia_StochProcessFrame( Abc_Frame_t * pFrame, Gia_Man_t * p, char * pScript )
+{
+    Gia_Man_t * pNew;
+    Abc_FrameUpdateGia( pFrame, Gia_ManDup(p) );
+    if ( Cmd_CommandExecute(pFrame, pScript) )
+    {
+        Abc_Print( 1, "Something did not work out with the command \"%s\".\n", pScript );
+        return NULL;
+    }
+    pNew = Abc_FrameGetGia( pFrame );
+    if ( pNew && Gia_ManAndNum(pNew) < Gia_ManAndNum(p) )
+        return pNew;
+    Gia_ManStopP( &pNew );
+    return NULL;
+}
+int Gia_StochProcessWorker( void * p )
+{
+    extern void Dar_LibStop();
+    StochSynWorker_t * pWorker = (StochSynWorker_t *)p;
+    int iWin;
+    while ( 1 )
+    {
+#ifdef ABC_USE_PTHREADS
+        pthread_mutex_lock( pWorker->pMutex );
+#endif
+        iWin = (*pWorker->pNext)++;
+#ifdef ABC_USE_PTHREADS
+        pthread_mutex_unlock( pWorker->pMutex );
+#endif
+        if ( iWin >= Vec_PtrSize(pWorker->vGias) )
+            break;
+        Vec_PtrWriteEntry( pWorker->vOuts, iWin, Gia_StochProcessFrame(pWorker->pFrame, (Gia_Man_t *)Vec_PtrEntry(pWorker->vGias, iWin), pWorker->pScript) );
+    }
+#ifdef ABC_USE_PTHREADS
+    // release the rewriting library started by this thread
+    Dar_LibStop();
+#endif
+    return 1;
+}
+Vec_Int_t * Gia_StochProcessFrames( Vec_Ptr_t * vGias, Vec_Ptr_t * vFrames, char * pScript, int nProcs, int fVerbose )
+{
+    Vec_Int_t * vGains = Vec_IntStart( Vec_PtrSize(vGias) );
+    Vec_Ptr_t * vOuts  = Vec_PtrStart( Vec_PtrSize(vGias) );
+    StochSynWorker_t * pWorkers = ABC_CALLOC( StochSynWorker_t, Vec_PtrSize(vFrames) );
+    Vec_Ptr_t * vData  = Vec_PtrAlloc( Vec_PtrSize(vFrames) ); 
+    Gia_Man_t * pGia, * pNew; int i, iNext = 0;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t Mutex;
+    pthread_mutex_init( &Mutex, NULL );
+#endif
+    assert( Vec_PtrSize(vFrames) == nProcs - 1 );
+    // advance the random number generator in the same way as the other modes
+    Abc_Random(1);
+    for ( i = 0; i < Vec_PtrSize(vGias); i++ )
+        Abc_Random(0);
+    for ( i = 0; i < Vec_PtrSize(vFrames); i++ ) {
+        pWorkers[i].pFrame  = (Abc_Frame_t *)Vec_PtrEntry( vFrames, i );
+        pWorkers[i].vGias   = vGias;
+        pWorkers[i].vOuts   = vOuts;
+        pWorkers[i].pScript = pScript;
+        pWorkers[i].pNext   = &iNext;
+#ifdef ABC_USE_PTHREADS
+        pWorkers[i].pMutex  = &Mutex;
+#endif
+        Vec_PtrPush( vData, pWorkers+i );
+    }
+    if ( fVerbose )
+        printf( "Running concurrent synthesis with %d in-process workers.\n", Vec_PtrSize(vFrames) ), fflush(stdout);
+    Util_ProcessThreads( Gia_StochProcessWorker, vData, nProcs, 0, 0 );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_destroy( &Mutex );
+#endif
+    // replace old AIGs by the improved AIGs
+    Vec_PtrForEachEntry( Gia_Man_t *, vOuts, pNew, i ) {
+        if ( pNew == NULL )
+            continue;
+        pGia = (Gia_Man_t *)Vec_PtrEntry( vGias, i );
+        Vec_IntWriteEntry( vGains, i, Gia_ManAndNum(pGia) - Gia_ManAndNum(pNew) );
+        Gia_ManStop( pGia );
+        Vec_PtrWriteEntry( vGias, i, pNew );
+    }
+    Vec_PtrFree( vOuts );
+    Vec_PtrFree( vData );
+    ABC_FREE( pWorkers );
+    return vGains;
+}
+
+Vec_Int_t * Gia_StochProcess( Vec_Ptr_t * vGias, Vec_Ptr_t * vFrames, char * pScript, int nProcs, int TimeSecs, int fVerbose )
 {
     if ( nProcs <= 2 ) {
         if ( fVerbose )
             printf( "Running non-concurrent synthesis.\n" ), fflush(stdout);            
         return Gia_StochProcessArray( vGias, pScript, TimeSecs, fVerbose );
     }
+    if ( vFrames )
+        return Gia_StochProcessFrames( vGias, vFrames, pScript, nProcs, fVerbose );
     Vec_Int_t * vGains = Vec_IntStartFull( Vec_PtrSize(vGias) );
     StochSynData_t * pData = ABC_CALLOC( StochSynData_t, Vec_PtrSize(vGias) );
     Vec_Ptr_t * vData = Vec_PtrAlloc( Vec_PtrSize(vGias) ); 
@@ -813,7 +954,7 @@ Gia_Man_t * Gia_ManDupDivideOne( Gia_Man_t * p, Vec_Int_t * vCis, Vec_Int_t * vA
     pNew->vMapping = vMapping;
     return pNew;
 }
-Vec_Ptr_t * Gia_ManDupDivide( Gia_Man_t * p, Vec_Wec_t * vCis, Vec_Wec_t * vAnds, Vec_Wec_t * vCos, char * pScript, int nProcs, int TimeOut, int fDelayOpt )
+Vec_Ptr_t * Gia_ManDupDivide( Gia_Man_t * p, Vec_Wec_t * vCis, Vec_Wec_t * vAnds, Vec_Wec_t * vCos, Vec_Ptr_t * vFrames, char * pScript, int nProcs, int TimeOut, int fDelayOpt )
 {
     // compute direct and reverse level
     Vec_Int_t * vLevels[2] = {NULL}; 
@@ -832,7 +973,7 @@ Vec_Ptr_t * Gia_ManDupDivide( Gia_Man_t * p, Vec_Wec_t * vCis, Vec_Wec_t * vAnds
         Vec_PtrPush( vAigs, Gia_ManDupDivideOne(p, Vec_WecEntry(vCis, i), Vec_WecEntry(vAnds, i), Vec_WecEntry(vCos, i), vLevels, p->nLevels) );
     }
     //Gia_ManStochSynthesis( vAigs, pScript );
-    Vec_Int_t * vGains = Gia_StochProcess( vAigs, pScript, nProcs, TimeOut, 0 );
+    Vec_Int_t * vGains = Gia_StochProcess( vAigs, vFrames, pScript, nProcs, TimeOut, 0 );
     Vec_IntFree( vGains );
     Vec_IntFreeP( &vLevels[0] );
     Vec_IntFreeP( &vLevels[1] );
@@ -1076,7 +1217,7 @@ Gia_Man_t * Gia_ManCreateChoicesArray( Vec_Ptr_t * vGias, int fVerbose )
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_ManStochSyn( int nSuppMax, int nMaxSize, int nIters, int TimeOut, int Seed, int fVerbose, char * pScript, int nProcs, int fDelayOpt, int fChoices )
+void Gia_ManStochSyn( int nSuppMax, int nMaxSize, int nIters, int TimeOut, int Seed, int fVerbose, char * pScript, int nProcs, int fDelayOpt, int fChoices, int fThreads )
 {
     abctime nTimeToStop  = TimeOut ? Abc_Clock() + TimeOut * CLOCKS_PER_SEC : 0;
     abctime clkStart     = Abc_Clock();
@@ -1084,13 +1225,15 @@ void Gia_ManStochSyn( int nSuppMax, int nMaxSize, int nIters, int TimeOut, int S
     int nLutEnd, nLutBeg = fMapped ? Gia_ManLutNum(Abc_FrameReadGia(Abc_FrameGetGlobalFrame())) : 0;
     int i, nEnd, nBeg    = Gia_ManAndNum(Abc_FrameReadGia(Abc_FrameGetGlobalFrame()));
     Vec_Ptr_t * vGias    = fChoices ? Vec_PtrAlloc( nIters ) : NULL;
+    Vec_Ptr_t * vFrames  = (nProcs > 2 && fThreads) ? Gia_StochStartWorkers( nProcs ) : NULL;
+    int nWinsAll         = 0;
     Abc_Random(1);
     for ( i = 0; i < 10+Seed; i++ )
         Abc_Random(0);
     if ( fVerbose ) {
         printf( "Running %d iterations of the script \"%s\"", nIters, pScript );
         if ( nProcs > 2 )
-            printf( " using %d concurrent threads.\n", nProcs-1 );
+            printf( " using %d concurrent %s.\n", nProcs-1, vFrames ? "threads" : "processes" );
         else
             printf( " without concurrency.\n" );
         fflush(stdout);
@@ -1103,7 +1246,7 @@ void Gia_ManStochSyn( int nSuppMax, int nMaxSize, int nIters, int TimeOut, int S
             Vec_Wec_t * vAnds = Gia_ManStochNodes( pGia, nMaxSize, Abc_Random(0) & 0x7FFFFFFF );
             Vec_Wec_t * vIns  = Gia_ManStochInputs( pGia, vAnds );
             Vec_Wec_t * vOuts = Gia_ManStochOutputs( pGia, vAnds );
-            Vec_Ptr_t * vAigs = Gia_ManDupDivide( pGia, vIns, vAnds, vOuts, pScript, nProcs, TimeOut, fDelayOpt );
+            Vec_Ptr_t * vAigs = Gia_ManDupDivide( pGia, vIns, vAnds, vOuts, vFrames, pScript, nProcs, TimeOut, fDelayOpt );
             Gia_Man_t * pNew  = Gia_ManDupStitchMap( pGia, vIns, vAnds, vOuts, vAigs );
             int fMapped = Gia_ManHasMapping(pGia) && Gia_ManHasMapping(pNew);
             if ( vGias ) Vec_PtrPush( vGias, Gia_ManDup(pNew) );
@@ -1114,7 +1257,10 @@ void Gia_ManStochSyn( int nSuppMax, int nMaxSize, int nIters, int TimeOut, int S
                                     fMapped ? Gia_ManLutNum(pNew) : Gia_ManAndNum(pNew),
                                     fMapped ? "LUTs" : "ANDs" ); 
             if ( fVerbose )
+            printf( "%8.1f win/sec  ", 1.0*Vec_PtrSize(vAigs)/Abc_MaxInt(1, Abc_Clock() - clk)*CLOCKS_PER_SEC );
+            if ( fVerbose )
             Abc_PrintTime( 0, "Time", Abc_Clock() - clk );
+            nWinsAll += Vec_PtrSize(vAigs);
             Gia_ManStop( pGia );
             Vec_PtrFreeFunc( vAigs, (void (*)(void *)) Gia_ManStop );
             Vec_WecFree( vAnds );
@@ -1136,7 +1282,7 @@ void Gia_ManStochSyn( int nSuppMax, int nMaxSize, int nIters, int TimeOut, int S
             abctime clk        = Abc_Clock();
             Gia_Man_t * pGia   = Gia_ManDup( Abc_FrameReadGia(Abc_FrameGetGlobalFrame()) ); Gia_ManStaticFanoutStart(pGia);
             Vec_Ptr_t * vAigs  = Gia_ManExtractPartitions( pGia, i, nSuppMax, &vIns, &vOuts, &vNodes, fOverlap, fDelayOpt );
-            Vec_Int_t * vGains = Gia_StochProcess( vAigs, pScript, nProcs, TimeOut, 0 );
+            Vec_Int_t * vGains = Gia_StochProcess( vAigs, vFrames, pScript, nProcs, TimeOut, 0 );
             int nPartsInit     = fOverlap ? Gia_ManFilterPartitions( pGia, vIns, vNodes, vOuts, vAigs, vGains, fDelayOpt ) : Vec_PtrSize(vIns);
             Gia_Man_t * pNew   = Gia_ManDupInsertWindows( pGia, vIns, vOuts, vAigs );       Gia_ManStaticFanoutStop(pGia);
             if ( vGias ) Vec_PtrPush( vGias, Gia_ManDup(pNew) );
@@ -1145,7 +1291,10 @@ void Gia_ManStochSyn( int nSuppMax, int nMaxSize, int nIters, int TimeOut, int S
             printf( "Iteration %3d : Using %3d -> %3d partitions. Reducing node count from %6d to %6d.  ", 
                 i, nPartsInit, Vec_PtrSize(vAigs), Gia_ManAndNum(pGia), Gia_ManAndNum(pNew) ); 
             if ( fVerbose )
+            printf( "%8.1f win/sec  ", 1.0*nPartsInit/Abc_MaxInt(1, Abc_Clock() - clk)*CLOCKS_PER_SEC );
+            if ( fVerbose )
             Abc_PrintTime( 0, "Time", Abc_Clock() - clk );
+            nWinsAll += nPartsInit;
             // cleanup
             Gia_ManStop( pGia );
             Vec_PtrFreeFunc( vAigs,  (void (*)(void *)) Gia_ManStop );
@@ -1168,6 +1317,10 @@ void Gia_ManStochSyn( int nSuppMax, int nMaxSize, int nIters, int TimeOut, int S
         fMapped ? nLutBeg - nLutEnd : nBeg - nEnd, fMapped ? "LUTs" : "nodes", 100.0*(nBeg - nEnd)/Abc_MaxInt(nBeg, 1), nIters );
     if ( fVerbose )
     Abc_PrintTime( 0, "Total time", Abc_Clock() - clkStart );
+    if ( fVerbose )
+    printf( "Processed %d windows (%.1f windows/sec).\n", nWinsAll, 1.0*nWinsAll/Abc_MaxInt(1, Abc_Clock() - clkStart)*CLOCKS_PER_SEC );
+    if ( vFrames )
+        Gia_StochStopWorkers( vFrames );
     if ( vGias ) {
         
         Gia_Man_t * pChoices = Gia_ManCreateChoicesArray( vGias, fVerbose );
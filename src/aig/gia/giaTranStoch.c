@@ -284,7 +284,7 @@ Gia_Man_t * Gia_ManTranStoch( Gia_Man_t * pGia, int nRestarts, int nHops, int nS
   if ( !fOriginalOnly ) {
     { // &put; collapse; st; &get;
       pNtk = Gia_ManTranStochPut( pGia );
-      pNtkRes = Abc_NtkCollapse( pNtk, ABC_INFINITY, 0, 1, 0, 0, 0 );
+      pNtkRes = Abc_NtkCollapse( pNtk, ABC_INFINITY, 0, 0, 1, 0, 0, 0 );
       Abc_NtkDelete( pNtk );
       pNtk = pNtkRes;
       pNtkRes = Abc_NtkStrash( pNtk, 0, 1, 0 );
@@ -300,7 +300,7 @@ Gia_Man_t * Gia_ManTranStoch( Gia_Man_t * pGia, int nRestarts, int nHops, int nS
     }
     { // &put; collapse; sop; fx; 
       pNtk = Gia_ManTranStochPut( pGia );
-      pNtkRes = Abc_NtkCollapse( pNtk, ABC_INFINITY, 0, 1, 0, 0, 0 );
+      pNtkRes = Abc_NtkCollapse( pNtk, ABC_INFINITY, 0, 0, 1, 0, 0, 0 );
       Abc_NtkDelete( pNtk );
       pNtk = pNtkRes;
       Abc_NtkToSop( pNtk, -1, ABC_INFINITY );
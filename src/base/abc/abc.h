@@ -601,7 +601,8 @@ extern ABC_DLL int                Abc_NtkCheckUniqueCiNames( Abc_Ntk_t * pNtk );
 extern ABC_DLL int                Abc_NtkCheckUniqueCoNames( Abc_Ntk_t * pNtk );
 extern ABC_DLL int                Abc_NtkCheckUniqueCioNames( Abc_Ntk_t * pNtk );
 /*=== abcCollapse.c ==========================================================*/
-extern ABC_DLL Abc_Ntk_t *        Abc_NtkCollapse( Abc_Ntk_t * pNtk, int fBddSizeMax, int fDualRail, int fReorder, int fReverse, int fDumpOrder, int fVerbose );
+extern ABC_DLL Abc_Ntk_t *        Abc_NtkCollapse( Abc_Ntk_t * pNtk, int fBddSizeMax, int nMemLimitMb, int fDualRail, int fReorder, int fReverse, int fDumpOrder, int fVerbose );
+extern ABC_DLL Abc_Ntk_t *        Abc_NtkCollapsePar( Abc_Ntk_t * pNtk, int fBddSizeMax, int nProcs, int fReorder, int fVerbose );
 extern ABC_DLL Abc_Ntk_t *        Abc_NtkCollapseSat( Abc_Ntk_t * pNtk, int nCubeLim, int nBTLimit, int nCostMax, int fCanon, int fReverse, int fCnfShared, int fVerbose );
 extern ABC_DLL Gia_Man_t *        Abc_NtkClpGia( Abc_Ntk_t * pNtk );
 /*=== abcCut.c ==========================================================*/
@@ -768,6 +769,7 @@ extern ABC_DLL Abc_Ntk_t *        Abc_NtkToNetlistBench( Abc_Ntk_t * pNtk );
 extern ABC_DLL Abc_Ntk_t *        Abc_NtkDeriveFromBdd( void * dd, void * bFunc, char * pNamePo, Vec_Ptr_t * vNamesPi );
 extern ABC_DLL Abc_Ntk_t *        Abc_NtkBddToMuxes( Abc_Ntk_t * pNtk, int fGlobal, int Limit, int fUseAdd );
 extern ABC_DLL void *             Abc_NtkBuildGlobalBdds( Abc_Ntk_t * pNtk, int fBddSizeMax, int fDropInternal, int fReorder, int fReverse, int fVerbose );
+extern ABC_DLL void *             Abc_NtkBuildGlobalBddsGov( Abc_Ntk_t * pNtk, int nBddSizeMax, int nMemLimitMb, int fReorder, int fReverse, int fVerbose );
 extern ABC_DLL void *             Abc_NtkFreeGlobalBdds( Abc_Ntk_t * pNtk, int fFreeMan );
 extern ABC_DLL int                Abc_NtkSizeOfGlobalBdds( Abc_Ntk_t * pNtk );
 /*=== abcNtk.c ==========================================================*/
@@ -834,6 +836,16 @@ extern ABC_DLL Odc_Man_t *        Abc_NtkDontCareAlloc( int nVarsMax, int nLevel
 extern ABC_DLL void               Abc_NtkDontCareClear( Odc_Man_t * p );
 extern ABC_DLL void               Abc_NtkDontCareFree( Odc_Man_t * p );
 extern ABC_DLL int                Abc_NtkDontCareCompute( Odc_Man_t * p, Abc_Obj_t * pNode, Vec_Ptr_t * vLeaves, unsigned * puTruth );
+/*=== abcOrchestration.c ==========================================================*/
+#define ABC_ORCH_RWR          1   // rewrite is allowed
+#define ABC_ORCH_RES          2   // resub is allowed
+#define ABC_ORCH_REF          4   // refactor is allowed
+#define ABC_ORCH_FEAT_NUM     8   // the number of features per object
+#define ABC_ORCH_BIN_VERSION  1   // the version of the binary feature format
+extern ABC_DLL int                Abc_NtkOrchEvalGains( Abc_Ntk_t * pNtk, Vec_Int_t * vMask, Vec_Int_t * vGainRwr, Vec_Int_t * vGainRes, Vec_Int_t * vGainRef, int fUseZeros_rwr, int fUseZeros_ref, int nCutMax, int nStepsMax, int nLevelsOdc, int fUpdateLevel, int nNodeSizeMax, int nConeSizeMax, int fUseDcs, int nProcs );
+extern ABC_DLL int                Abc_NtkOrchFeatures( Abc_Ntk_t * pNtk, Vec_Int_t * vEdges, Vec_Flt_t * vFeats, Vec_Int_t * vGainRwr, Vec_Int_t * vGainRes, Vec_Int_t * vGainRef, int fUseZeros_rwr, int fUseZeros_ref, int nCutMax, int nStepsMax, int nLevelsOdc, int fUpdateLevel, int nNodeSizeMax, int nConeSizeMax, int fUseDcs, int nProcs, int fVerbose );
+extern ABC_DLL int                Abc_NtkOrchApply( Abc_Ntk_t * pNtk, Vec_Int_t * vMask, Vec_Int_t * vDecisions, int fUseZeros_rwr, int fUseZeros_ref, int nCutMax, int nStepsMax, int nLevelsOdc, int fUpdateLevel, int nNodeSizeMax, int nConeSizeMax, int fUseDcs, int nProcs, int fVerbose );
+extern ABC_DLL int                Abc_NtkOrchWriteFeatures( char * pFileName, Vec_Int_t * vEdges, Vec_Flt_t * vFeats );
 /*=== abcPrint.c ==========================================================*/
 extern ABC_DLL float              Abc_NtkMfsTotalSwitching( Abc_Ntk_t * pNtk );
 extern ABC_DLL float              Abc_NtkMfsTotalGlitching( Abc_Ntk_t * pNtk, int nPats, int Prob, int fVerbose );
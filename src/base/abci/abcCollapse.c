@@ -28,6 +28,16 @@
 #include "bdd/extrab/extraBdd.h"
 #endif
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -37,6 +47,9 @@ ABC_NAMESPACE_IMPL_START
 #ifdef ABC_USE_CUDD
 
 extern int Abc_NodeSupport( DdNode * bFunc, Vec_Str_t * vSupport, int nVars );
+extern char * Abc_ConvertBddToSop( Mem_Flex_t * pMan, DdManager * dd, DdNode * bFuncOn, DdNode * bFuncOnDc, int nFanins, int fAllPrimes, Vec_Str_t * vCube, int fMode );
+extern void Gia_ManCollapseDeref( DdManager * dd, Vec_Ptr_t * vFuncs );
+extern void Gia_ObjCollapseDeref( Gia_Man_t * p, DdManager * dd, Vec_Ptr_t * vFuncs, int Id );
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -204,14 +217,19 @@ void Abc_NtkDumpVariableOrder( Abc_Ntk_t * pNtk )
     fprintf( pFile, "\n" );
     fclose( pFile );
 }
-Abc_Ntk_t * Abc_NtkCollapse( Abc_Ntk_t * pNtk, int fBddSizeMax, int fDualRail, int fReorder, int fReverse, int fDumpOrder, int fVerbose )
+Abc_Ntk_t * Abc_NtkCollapse( Abc_Ntk_t * pNtk, int fBddSizeMax, int nMemLimitMb, int fDualRail, int fReorder, int fReverse, int fDumpOrder, int fVerbose )
 {
     Abc_Ntk_t * pNtkNew;
     abctime clk = Abc_Clock();
 
     assert( Abc_NtkIsStrash(pNtk) );
     // compute the global BDDs
-    if ( Abc_NtkBuildGlobalBdds(pNtk, fBddSizeMax, 1, fReorder, fReverse, fVerbose) == NULL )
+    if ( nMemLimitMb > 0 )
+    {
+        if ( Abc_NtkBuildGlobalBddsGov(pNtk, fBddSizeMax, nMemLimitMb, fReorder, fReverse, fVerbose) == NULL )
+            return NULL;
+    }
+    else if ( Abc_NtkBuildGlobalBdds(pNtk, fBddSizeMax, 1, fReorder, fReverse, fVerbose) == NULL )
         return NULL;
     if ( fVerbose )
     {
@@ -247,7 +265,7 @@ Abc_Ntk_t * Abc_NtkCollapse( Abc_Ntk_t * pNtk, int fBddSizeMax, int fDualRail, i
 
 #else
 
-Abc_Ntk_t * Abc_NtkCollapse( Abc_Ntk_t * pNtk, int fBddSizeMax, int fDualRail, int fReorder, int fReverse, int fDumpOrder, int fVerbose )
+Abc_Ntk_t * Abc_NtkCollapse( Abc_Ntk_t * pNtk, int fBddSizeMax, int nMemLimitMb, int fDualRail, int fReorder, int fReverse, int fDumpOrder, int fVerbose )
 {
     return NULL;
 }
@@ -959,6 +977,452 @@ Abc_Ntk_t * Abc_NtkCollapseSat( Abc_Ntk_t * pNtk, int nCubeLim, int nBTLimit, in
 }
 
 
+#ifdef ABC_USE_CUDD
+
+// the live nodes to trigger the first reordering in the multi-threaded collapsing
+#define ABC_CLP_PAR_REORDER  10000
+
+// the outputs of one group collapsed by a thread
+typedef struct Abc_ClpJob_t_ Abc_ClpJob_t;
+struct Abc_ClpJob_t_
+{
+    Gia_Man_t *       pGia;          // the cones of the outputs of the group
+    Vec_Int_t *       vCos;          // the outputs of the group (the COs of the network)
+    Vec_Int_t *       vCis;          // the inputs of the group (the CIs of the network)
+    int               nBddSizeMax;   // the limit on the live BDD nodes
+    int               fReorder;      // enables reordering
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t * pMutex;        // serializes the parts of CUDD using global variables
+#endif
+    Vec_Ptr_t *       vSops;         // the SOPs of the outputs (NULL if the limit is exceeded)
+    Vec_Wec_t *       vSupps;        // the supports of the SOPs (the CIs of the network)
+    int               nNodesPeak;    // the peak number of live nodes
+    int               nReorders;     // the number of reorderings
+};
+
+/**Function*************************************************************
+
+  Synopsis    [Groups the outputs by the overlap of their supports.]
+
+  Description [The outputs driven by internal nodes are considered in the
+  decreasing order of their cone sizes. Each output is added to the group
+  with the largest support overlap, which is not loaded above the average
+  cone size per group. Otherwise, the output starts a new group, or is added
+  to the least loaded group if there are already nGroups groups. Returns
+  the outputs of each group and, in vGroupSupps, the union of their supports.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wec_t * Abc_NtkCollapseParGroups( Gia_Man_t * p, Vec_Wec_t * vSupps, int nGroups, Vec_Wec_t ** pvGroupSupps )
+{
+    Vec_Wec_t * vGroups     = Vec_WecAlloc( nGroups );
+    Vec_Wec_t * vGroupSupps = Vec_WecAlloc( nGroups );
+    Vec_Int_t * vLoads      = Vec_IntAlloc( nGroups );
+    Vec_Int_t * vOrder      = Vec_IntAlloc( Gia_ManCoNum(p) );
+    Vec_Int_t * vCosts      = Vec_IntStart( Gia_ManCoNum(p) );
+    Vec_Int_t * vTemp       = Vec_IntAlloc( 100 );
+    Vec_Int_t * vSupp;
+    Gia_Obj_t * pObj;
+    int i, k, iCo, Id, Cost, nOverlap, iBest, nBest, nBudget;
+    word TotalCost = 0;
+    // collect the outputs driven by internal nodes
+    Gia_ManForEachCo( p, pObj, i )
+    {
+        if ( !Gia_ObjIsAnd(Gia_ObjFanin0(pObj)) )
+            continue;
+        Id = Gia_ObjFaninId0p( p, pObj );
+        Cost = Gia_ManConeSize( p, &Id, 1 );
+        Vec_IntWriteEntry( vCosts, i, Cost );
+        Vec_IntPush( vOrder, i );
+        TotalCost += Cost;
+    }
+    Abc_MergeSortCost2Reverse( Vec_IntArray(vOrder), Vec_IntSize(vOrder), Vec_IntArray(vCosts) );
+    nGroups = Abc_MinInt( nGroups, Vec_IntSize(vOrder) );
+    nBudget = nGroups ? (int)Abc_MinWord( TotalCost / nGroups, ABC_INFINITY ) : 0;
+    // distribute the outputs
+    Vec_IntForEachEntry( vOrder, iCo, i )
+    {
+        vSupp = Vec_WecEntry( vSupps, iCo );
+        Cost  = Vec_IntEntry( vCosts, iCo );
+        iBest = -1, nBest = 0;
+        for ( k = 0; k < Vec_WecSize(vGroups); k++ )
+        {
+            if ( Vec_IntEntry(vLoads, k) + Cost > nBudget )
+                continue;
+            nOverlap = Vec_IntTwoCountCommon( vSupp, Vec_WecEntry(vGroupSupps, k) );
+            if ( nBest < nOverlap )
+                nBest = nOverlap, iBest = k;
+        }
+        if ( iBest == -1 && Vec_WecSize(vGroups) < nGroups )
+        {
+            iBest = Vec_WecSize(vGroups);
+            Vec_WecPushLevel( vGroups );
+            Vec_WecPushLevel( vGroupSupps );
+            Vec_IntPush( vLoads, 0 );
+        }
+        else if ( iBest == -1 )
+            iBest = Vec_IntArgMin( vLoads );
+        Vec_WecPush( vGroups, iBest, iCo );
+        Vec_IntAddToEntry( vLoads, iBest, Cost );
+        Vec_IntTwoMerge2( Vec_WecEntry(vGroupSupps, iBest), vSupp, vTemp );
+        Vec_IntClear( Vec_WecEntry(vGroupSupps, iBest) );
+        Vec_IntAppend( Vec_WecEntry(vGroupSupps, iBest), vTemp );
+    }
+    Vec_IntFree( vLoads );
+    Vec_IntFree( vOrder );
+    Vec_IntFree( vCosts );
+    Vec_IntFree( vTemp );
+    *pvGroupSupps = vGroupSupps;
+    return vGroups;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reorders the variables of the manager.]
+
+  Description [The reordering code of CUDD keeps its data in global
+  variables, so only one thread can reorder at a time.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkCollapseParReorder( Abc_ClpJob_t * pJob, DdManager * dd )
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( pJob->pMutex );
+#endif
+    Cudd_ReduceHeap( dd, CUDD_REORDER_SYMM_SIFT, 1 );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( pJob->pMutex );
+#endif
+    pJob->nReorders++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the BDDs of the outputs of the group.]
+
+  Description [Similar to Gia_ManCollapse() but the reordering is
+  triggered explicitly, when the number of live nodes doubles since
+  the last reordering. Returns NULL if the live nodes exceed the limit
+  or if CUDD runs out of memory.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Abc_NtkCollapseParBuild( Abc_ClpJob_t * pJob, DdManager * dd )
+{
+    Gia_Man_t * p = pJob->pGia;
+    Vec_Ptr_t * vFuncs;
+    DdNode * bFunc0, * bFunc1, * bFunc;
+    Gia_Obj_t * pObj;
+    int i, Id, nLive, nLiveNext = ABC_CLP_PAR_REORDER;
+    Gia_ManCreateRefs( p );
+    vFuncs = Vec_PtrStart( Gia_ManObjNum(p) );
+    Gia_ManForEachCiId( p, Id, i )
+        if ( Gia_ObjRefNumId(p, Id) > 0 )
+            Vec_PtrWriteEntry( vFuncs, Id, Cudd_bddIthVar(dd,i) ), Cudd_Ref(Cudd_bddIthVar(dd,i));
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        bFunc0 = Cudd_NotCond( (DdNode *)Vec_PtrEntry(vFuncs, Gia_ObjFaninId0(pObj, i)), Gia_ObjFaninC0(pObj) );
+        bFunc1 = Cudd_NotCond( (DdNode *)Vec_PtrEntry(vFuncs, Gia_ObjFaninId1(pObj, i)), Gia_ObjFaninC1(pObj) );
+        bFunc  = Cudd_bddAnd( dd, bFunc0, bFunc1 );
+        if ( bFunc == NULL )
+        {
+            Gia_ManCollapseDeref( dd, vFuncs );
+            return NULL;
+        }
+        Cudd_Ref( bFunc );
+        Vec_PtrWriteEntry( vFuncs, i, bFunc );
+        Gia_ObjCollapseDeref( p, dd, vFuncs, Gia_ObjFaninId0(pObj, i) );
+        Gia_ObjCollapseDeref( p, dd, vFuncs, Gia_ObjFaninId1(pObj, i) );
+        nLive = Cudd_ReadKeys(dd) - Cudd_ReadDead(dd);
+        if ( nLive > pJob->nBddSizeMax )
+        {
+            Gia_ManCollapseDeref( dd, vFuncs );
+            return NULL;
+        }
+        if ( pJob->fReorder && nLive > nLiveNext )
+        {
+            Abc_NtkCollapseParReorder( pJob, dd );
+            nLiveNext = Abc_MaxInt( ABC_CLP_PAR_REORDER, 2 * (Cudd_ReadKeys(dd) - Cudd_ReadDead(dd)) );
+        }
+    }
+    Gia_ManForEachCoId( p, Id, i )
+    {
+        pObj = Gia_ManCo( p, i );
+        bFunc0 = Cudd_NotCond( (DdNode *)Vec_PtrEntry(vFuncs, Gia_ObjFaninId0(pObj, Id)), Gia_ObjFaninC0(pObj) );
+        Vec_PtrWriteEntry( vFuncs, Id, bFunc0 ); Cudd_Ref( bFunc0 );
+        Gia_ObjCollapseDeref( p, dd, vFuncs, Gia_ObjFaninId0(pObj, Id) );
+    }
+    // reorder once more for the output BDDs only
+    if ( pJob->fReorder )
+        Abc_NtkCollapseParReorder( pJob, dd );
+    // compact
+    Gia_ManForEachCoId( p, Id, i )
+        Vec_PtrWriteEntry( vFuncs, i, Vec_PtrEntry(vFuncs, Id) );
+    Vec_PtrShrink( vFuncs, Gia_ManCoNum(p) );
+    return vFuncs;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Removes the columns of the SOP not in the support.]
+
+  Description [The SOP is derived for all variables of the manager. 
+  The support is given by the sorted variables.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkCollapseParCompact( char * pSop, int nVars, Vec_Int_t * vSupp )
+{
+    char * pCube, * pOut = pSop, Phase;
+    int k, iVar;
+    Abc_NtkSopForEachCube( pSop, nVars, pCube )
+    {
+        Phase = pCube[nVars + 1];
+        Vec_IntForEachEntry( vSupp, iVar, k )
+            *pOut++ = pCube[iVar];
+        *pOut++ = ' ';
+        *pOut++ = Phase;
+        *pOut++ = '\n';
+    }
+    *pOut = 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collapses one group of outputs.]
+
+  Description [The thread uses its own manager with the inputs of the
+  group as variables. The ISOP of each output is computed in the phase
+  with fewer cubes and expressed using its functional support.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkCollapseParJob( void * pArg )
+{
+    Abc_ClpJob_t * pJob = (Abc_ClpJob_t *)pArg;
+    DdManager * dd;
+    DdNode * bFunc, * bSupp, * bTemp;
+    Vec_Ptr_t * vFuncs;
+    Vec_Int_t * vSupp;
+    Vec_Str_t * vCube;
+    char * pSop;
+    int i, k, iVar;
+    // the initialization of CUDD temporarily replaces the global out-of-memory handler
+    // (the resizing of the computed table is not serialized, which at worst leaves the handler of CUDD)
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( pJob->pMutex );
+#endif
+    dd = Cudd_Init( Vec_IntSize(pJob->vCis), 0, CUDD_UNIQUE_SLOTS, CUDD_CACHE_SLOTS, 0 );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( pJob->pMutex );
+#endif
+    vFuncs = Abc_NtkCollapseParBuild( pJob, dd );
+    pJob->nNodesPeak = Cudd_ReadPeakLiveNodeCount( dd );
+    if ( vFuncs == NULL )
+    {
+        Cudd_Quit( dd );
+        return 1;
+    }
+    // derive the SOPs
+    Cudd_zddVarsFromBddVars( dd, 2 );
+    vCube = Vec_StrAlloc( 100 );
+    pJob->vSops  = Vec_PtrAlloc( Vec_PtrSize(vFuncs) );
+    pJob->vSupps = Vec_WecStart( Vec_PtrSize(vFuncs) );
+    Vec_PtrForEachEntry( DdNode *, vFuncs, bFunc, i )
+    {
+        pSop = Abc_ConvertBddToSop( NULL, dd, bFunc, bFunc, dd->size, 0, vCube, -1 );
+        if ( pSop == NULL )
+        {
+            Vec_PtrFreeFree( pJob->vSops );  pJob->vSops = NULL;
+            break;
+        }
+        Vec_PtrPush( pJob->vSops, pSop );
+        if ( Cudd_IsConstant(bFunc) )
+            continue;
+        vSupp = Vec_WecEntry( pJob->vSupps, i );
+        bSupp = Cudd_Support( dd, bFunc );
+        if ( bSupp == NULL )
+        {
+            Vec_PtrFreeFree( pJob->vSops );  pJob->vSops = NULL;
+            break;
+        }
+        Cudd_Ref( bSupp );
+        for ( bTemp = bSupp; !Cudd_IsConstant(bTemp); bTemp = Cudd_T(bTemp) )
+            Vec_IntPush( vSupp, Cudd_NodeReadIndex(bTemp) );
+        Cudd_RecursiveDeref( dd, bSupp );
+        Vec_IntSort( vSupp, 0 );
+        Abc_NtkCollapseParCompact( pSop, dd->size, vSupp );
+        Vec_IntForEachEntry( vSupp, iVar, k )
+            Vec_IntWriteEntry( vSupp, k, Vec_IntEntry(pJob->vCis, iVar) );
+    }
+    Vec_StrFree( vCube );
+    Gia_ManCollapseDeref( dd, vFuncs );
+    Cudd_Quit( dd );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collapses the network using several threads.]
+
+  Description [The outputs are divided into groups with overlapping 
+  supports, several groups per thread. The BDDs of each group are built
+  in a separate manager and converted into ISOPs by a thread. The SOP
+  network is assembled after all threads have finished, so the result
+  does not depend on the scheduling. The live node limit applies to each
+  manager. If the network has the external don't-cares, the collapsing 
+  is performed by one thread.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Ntk_t * Abc_NtkCollapsePar( Abc_Ntk_t * pNtk, int fBddSizeMax, int nProcs, int fReorder, int fVerbose )
+{
+    Abc_Ntk_t * pNtkNew = NULL;
+    Gia_Man_t * pGia;
+    Vec_Wec_t * vSupps, * vGroups, * vGroupSupps;
+    Vec_Ptr_t * vJobs, * vSops;
+    Vec_Int_t * vSupp;
+    Abc_ClpJob_t * pJob;
+    Abc_Obj_t * pNode, * pNodeNew, * pDriver;
+    int i, k, iCo, iCi, fFailed = 0, nNodesPeak = 0, nReorders = 0;
+    abctime clk = Abc_Clock();
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t Mutex;
+#endif
+    assert( Abc_NtkIsStrash(pNtk) );
+    if ( pNtk->pExdc )
+        return Abc_NtkCollapse( pNtk, fBddSizeMax, 0, 0, fReorder, 0, 0, fVerbose );
+    pGia    = Abc_NtkClpGia( pNtk );
+    vSupps  = Gia_ManCreateCoSupps( pGia, fVerbose );
+    vGroups = Abc_NtkCollapseParGroups( pGia, vSupps, 4 * nProcs, &vGroupSupps );
+    // extract the cones of the groups
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &Mutex, NULL );
+#endif
+    vJobs = Vec_PtrAlloc( Vec_WecSize(vGroups) );
+    for ( i = 0; i < Vec_WecSize(vGroups); i++ )
+    {
+        pJob = ABC_CALLOC( Abc_ClpJob_t, 1 );
+        pJob->vCos        = Vec_WecEntry( vGroups, i );
+        pJob->vCis        = Vec_WecEntry( vGroupSupps, i );
+        pJob->pGia        = Gia_ManDupCones( pGia, Vec_IntArray(pJob->vCos), Vec_IntSize(pJob->vCos), 1 );
+        pJob->nBddSizeMax = fBddSizeMax;
+        pJob->fReorder    = fReorder;
+#ifdef ABC_USE_PTHREADS
+        pJob->pMutex      = &Mutex;
+#endif
+        assert( Gia_ManCiNum(pJob->pGia) == Vec_IntSize(pJob->vCis) );
+        Vec_PtrPush( vJobs, pJob );
+    }
+    Gia_ManStop( pGia );
+    Util_ProcessThreads( Abc_NtkCollapseParJob, vJobs, nProcs, 0, 0 );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_destroy( &Mutex );
+#endif
+    // collect the SOPs
+    vSops = Vec_PtrStart( Abc_NtkCoNum(pNtk) );
+    Vec_PtrForEachEntry( Abc_ClpJob_t *, vJobs, pJob, i )
+    {
+        nNodesPeak = Abc_MaxInt( nNodesPeak, pJob->nNodesPeak );
+        nReorders += pJob->nReorders;
+        fFailed |= (pJob->vSops == NULL);
+        Vec_IntForEachEntry( pJob->vCos, iCo, k )
+        {
+            if ( pJob->vSops == NULL )
+                break;
+            Vec_PtrWriteEntry( vSops, iCo, Vec_PtrEntry(pJob->vSops, k) );
+            Vec_IntClear( Vec_WecEntry(vSupps, iCo) );
+            Vec_IntAppend( Vec_WecEntry(vSupps, iCo), Vec_WecEntry(pJob->vSupps, k) );
+        }
+        Gia_ManStop( pJob->pGia );
+        Vec_PtrFreeP( &pJob->vSops );
+        Vec_WecFreeP( &pJob->vSupps );
+        ABC_FREE( pJob );
+    }
+    if ( fVerbose )
+    {
+        printf( "Groups = %d. Largest group: Inputs = %d. Outputs = %d. Peak live nodes = %d. Reorderings = %d.  ",
+            Vec_WecSize(vGroups), Vec_WecMaxLevelSize(vGroupSupps), Vec_WecMaxLevelSize(vGroups), nNodesPeak, nReorders );
+        ABC_PRT( "Collapsing time", Abc_Clock() - clk );
+    }
+    Vec_PtrFree( vJobs );
+    Vec_WecFree( vGroups );
+    Vec_WecFree( vGroupSupps );
+    if ( fFailed )
+        goto finish;
+    // create the new network
+    pNtkNew = Abc_NtkStartFrom( pNtk, ABC_NTK_LOGIC, ABC_FUNC_SOP );
+    Abc_NtkForEachCo( pNtk, pNode, i )
+    {
+        pDriver = Abc_ObjFanin0(pNode);
+        if ( Abc_ObjIsCi(pDriver) && !strcmp(Abc_ObjName(pNode), Abc_ObjName(pDriver)) )
+        {
+            Abc_ObjAddFanin( pNode->pCopy, pDriver->pCopy );
+            continue;
+        }
+        if ( Abc_ObjIsCi(pDriver) )
+        {
+            pNodeNew = Abc_NtkCreateNode( pNtkNew );
+            Abc_ObjAddFanin( pNodeNew, pDriver->pCopy ); 
+            pNodeNew->pData = Abc_SopRegister( (Mem_Flex_t *)pNtkNew->pManFunc, Abc_ObjFaninC0(pNode) ? "0 1\n" : "1 1\n" );
+            Abc_ObjAddFanin( pNode->pCopy, pNodeNew );
+            continue;
+        }
+        if ( pDriver == Abc_AigConst1(pNtk) )
+        {
+            pNodeNew = Abc_NtkCreateNode( pNtkNew );
+            pNodeNew->pData = Abc_SopRegister( (Mem_Flex_t *)pNtkNew->pManFunc, Abc_ObjFaninC0(pNode) ? " 0\n" : " 1\n" );
+            Abc_ObjAddFanin( pNode->pCopy, pNodeNew );
+            continue;
+        }
+        pNodeNew = Abc_NtkCreateNode( pNtkNew );
+        vSupp = Vec_WecEntry( vSupps, i );
+        Vec_IntForEachEntry( vSupp, iCi, k )
+            Abc_ObjAddFanin( pNodeNew, Abc_NtkCi(pNtkNew, iCi) );
+        pNodeNew->pData = Abc_SopRegister( (Mem_Flex_t *)pNtkNew->pManFunc, (const char*)Vec_PtrEntry( vSops, i ) );
+        Abc_ObjAddFanin( pNode->pCopy, pNodeNew );
+    }
+    if ( !Abc_NtkCheck( pNtkNew ) )
+    {
+        printf( "Abc_NtkCollapsePar: The network check has failed.\n" );
+        Abc_NtkDelete( pNtkNew );
+        pNtkNew = NULL;
+    }
+finish:
+    Vec_PtrFreeFree( vSops );
+    Vec_WecFree( vSupps );
+    return pNtkNew;
+}
+
+#else
+
+Abc_Ntk_t * Abc_NtkCollapsePar( Abc_Ntk_t * pNtk, int fBddSizeMax, int nProcs, int fReorder, int fVerbose )
+{
+    return NULL;
+}
+
+#endif
+
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -719,7 +719,7 @@ int Abc_NtkFromGiaCollapse( Gia_Man_t * pGia )
     //pNtk->pName      = Extra_UtilStrsav(pGia->pName);
     Aig_ManStop( pMan );
     // collapse the network 
-    pNtk = Abc_NtkCollapse( pTemp = pNtk, 10000, 0, 1, 0, 0, 0 );
+    pNtk = Abc_NtkCollapse( pTemp = pNtk, 10000, 0, 0, 1, 0, 0, 0 );
     Abc_NtkDelete( pTemp );
     if ( pNtk == NULL )
         return 0;
@@ -438,6 +438,72 @@ void * Abc_NtkBuildGlobalBdds( Abc_Ntk_t * pNtk, int nBddSizeMax, int fDropInter
     return dd;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Derives global BDDs for the COs within the memory budget.]
+
+  Description [Same as Abc_NtkBuildGlobalBdds() with fDropInternal set,
+  but the construction is controlled by the BDD governor, which schedules
+  reordering depending on the growth of the live nodes. When the memory
+  budget (in megabytes) or the limit on the live nodes are exceeded, the
+  BDDs are built by splitting the problem into cofactors w.r.t. the top
+  variables, which are processed sequentially.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Abc_NtkBuildGlobalBddsGov( Abc_Ntk_t * pNtk, int nBddSizeMax, int nMemLimitMb, int fReorder, int fReverse, int fVerbose )
+{
+    extern Vec_Ptr_t * Gia_ManCollapseGov( Gia_Man_t * p, DdManager * dd, Vec_Ptr_t * vCiFuncs, int nBddLimit, int nLiveMax, int nMemLimitMb, int fReorder, int fVerbose );
+    Vec_Ptr_t * vCiFuncs, * vFuncs;
+    Vec_Att_t * pAttMan;
+    Gia_Man_t * pGia;
+    Abc_Obj_t * pObj;
+    DdManager * dd;
+    int i;
+
+    // remove dangling nodes
+    Abc_AigCleanup( (Abc_Aig_t *)pNtk->pManFunc );
+
+    // start the manager
+    assert( Abc_NtkGlobalBdd(pNtk) == NULL );
+    dd = Cudd_Init( Abc_NtkCiNum(pNtk), 0, CUDD_UNIQUE_SLOTS, CUDD_CACHE_SLOTS, 0 );
+    pAttMan = Vec_AttAlloc( Abc_NtkObjNumMax(pNtk) + 1, dd, (void (*)(void*))Extra_StopManager, NULL, (void (*)(void*,void*))Cudd_RecursiveDeref );
+    Vec_PtrWriteEntry( pNtk->vAttrs, VEC_ATTR_GLOBAL_BDD, pAttMan );
+
+    // construct the BDDs of the COs
+    vCiFuncs = Vec_PtrAlloc( Abc_NtkCiNum(pNtk) );
+    for ( i = 0; i < Abc_NtkCiNum(pNtk); i++ )
+        Vec_PtrPush( vCiFuncs, fReverse ? dd->vars[Abc_NtkCiNum(pNtk) - 1 - i] : dd->vars[i] );
+    pGia = Abc_NtkClpGia( pNtk );
+    vFuncs = Gia_ManCollapseGov( pGia, dd, vCiFuncs, nBddSizeMax, nBddSizeMax, nMemLimitMb, fReorder, fVerbose );
+    Gia_ManStop( pGia );
+    Vec_PtrFree( vCiFuncs );
+    if ( vFuncs == NULL )
+    {
+        if ( fVerbose )
+        printf( "Constructing global BDDs is aborted.\n" );
+        Abc_NtkFreeGlobalBdds( pNtk, 0 );
+        Cudd_Quit( dd ); 
+        return NULL;
+    }
+    Abc_NtkForEachCo( pNtk, pObj, i )
+        Abc_ObjSetGlobalBdd( pObj, Vec_PtrEntry(vFuncs, i) );
+    Vec_PtrFree( vFuncs );
+
+    // reorder one more time
+    if ( fReorder )
+    {
+        Cudd_ReduceHeap( dd, CUDD_REORDER_SYMM_SIFT, 1 );
+        Cudd_AutodynDisable( dd );
+    }
+    if ( fVerbose )
+        Cudd_PrintInfo( dd, stdout );
+    return dd;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Derives the global BDD for one AIG node.]
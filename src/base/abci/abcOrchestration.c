@@ -21,6 +21,7 @@
 #include <stdlib.h>
 #include <time.h>
 #include "base/abc/abc.h"
+#include "base/main/main.h"
 #include "bool/dec/dec.h"
 #include "opt/rwr/rwr.h"
 #include "bool/kit/kit.h"
@@ -31,7 +32,7 @@ ABC_NAMESPACE_IMPL_START
 ////////////////////////////////////////////////////////////////////////
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
-static Cut_Man_t * Abc_NtkStartCutManForRewrite( Abc_Ntk_t * pNtk );
+static Cut_Man_t * Abc_NtkStartCutManForRewrite( Abc_Ntk_t * pNtk, Cut_Params_t * pParams );
 extern void        Abc_NodePrintCuts( Abc_Obj_t * pNode );
 extern void        Abc_ManShowCutCone( Abc_Obj_t * pNode, Vec_Ptr_t * vLeaves );
 
@@ -188,7 +189,7 @@ int Abc_NtkRewrite3( Abc_Ntk_t * pNtk, Vec_Int_t **pGain_rw, int fUpdateLevel, i
     if ( fUpdateLevel )
         Abc_NtkStartReverseLevels( pNtk, 0 );
 clk = Abc_Clock();
-    pManCut = Abc_NtkStartCutManForRewrite( pNtk );
+    pManCut = Abc_NtkStartCutManForRewrite( pNtk, NULL );
 Rwr_ManAddTimeCuts( pManRwr, Abc_Clock() - clk );
     pNtk->pManCut = pManCut;
 
@@ -274,12 +275,16 @@ Rwr_ManAddTimeTotal( pManRwr, Abc_Clock() - clkStart );
     return 1;
 }
 
-Cut_Man_t * Abc_NtkStartCutManForRewrite( Abc_Ntk_t * pNtk )
+Cut_Man_t * Abc_NtkStartCutManForRewrite( Abc_Ntk_t * pNtk, Cut_Params_t * pParams )
 {
-    static Cut_Params_t Params, * pParams = &Params;
+    // the cut manager keeps the pointer to the parameters, so the managers
+    // used by concurrent threads should be given their own parameters
+    static Cut_Params_t Params;
     Cut_Man_t * pManCut;
     Abc_Obj_t * pObj;
     int i;
+    if ( pParams == NULL )
+        pParams = &Params;
     memset( pParams, 0, sizeof(Cut_Params_t) );
     pParams->nVarsMax  = 4;     // the max cut size ("k" of the k-feasible cuts)
     pParams->nKeepMax  = 250;   // the max number of cuts kept at a node
@@ -2720,7 +2725,7 @@ int Abc_NtkOrchSA( Abc_Ntk_t * pNtk, Vec_Int_t **pGain_rwr, Vec_Int_t **pGain_re
             pNode->pNext = (Abc_Obj_t *)pNode->pData;
     }
 clk = Abc_Clock();
-    pManCutRwr = Abc_NtkStartCutManForRewrite( pNtk );
+    pManCutRwr = Abc_NtkStartCutManForRewrite( pNtk, NULL );
 Rwr_ManAddTimeCuts( pManRwr, Abc_Clock() - clk );
     pNtk->pManCut = pManCutRwr;
 
@@ -3228,9 +3233,15 @@ s_ResubTime = Abc_Clock() - clkStart;
 }
 
 // local greedy orchestration
-int Abc_NtkOrchLocal( Abc_Ntk_t * pNtk, int fUseZeros_rwr, int fUseZeros_ref, int fPlaceEnable, int nCutMax, int nStepsMax, int nLevelsOdc, int fUpdateLevel, int fVerbose, int fVeryVerbose, int nNodeSizeMax, int nConeSizeMax, int fUseDcs )
+// with nProcs > 1, the gains of all nodes are first evaluated concurrently on
+// the initial AIG, and the nodes where no operator applied are skipped without
+// re-evaluating them after the earlier updates; as a result, the QoR may differ
+// from that of the single-threaded run (Abc_NtkOchestration*() are serial only)
+int Abc_NtkOrchLocal( Abc_Ntk_t * pNtk, int fUseZeros_rwr, int fUseZeros_ref, int fPlaceEnable, int nCutMax, int nStepsMax, int nLevelsOdc, int fUpdateLevel, int fVerbose, int fVeryVerbose, int nNodeSizeMax, int nConeSizeMax, int fUseDcs, int nProcs )
 {
     ProgressBar * pProgress;
+    // gains precomputed concurrently
+    Vec_Int_t * vGainRwr = NULL, * vGainRes = NULL, * vGainRef = NULL;
     // For resub
     Abc_ManRes_t * pManRes;
     Abc_ManCut_t * pManCutRes;
@@ -3264,6 +3275,15 @@ int Abc_NtkOrchLocal( Abc_Ntk_t * pNtk, int fUseZeros_rwr, int fUseZeros_ref, in
     // cleanup the AIG
     Abc_AigCleanup((Abc_Aig_t *)pNtk->pManFunc);
 
+    // evaluate the nodes concurrently to skip those where no operator applies
+    if ( nProcs > 1 )
+    {
+        vGainRwr = Vec_IntAlloc( 0 );
+        vGainRes = Vec_IntAlloc( 0 );
+        vGainRef = Vec_IntAlloc( 0 );
+        Abc_NtkOrchEvalGains( pNtk, NULL, vGainRwr, vGainRes, vGainRef, fUseZeros_rwr, fUseZeros_ref, nCutMax, nStepsMax, nLevelsOdc, fUpdateLevel, nNodeSizeMax, nConeSizeMax, fUseDcs, nProcs );
+    }
+
     // start the managers resub
     pManCutRes = Abc_NtkManCutStart( nCutMax, 100000, 100000, 100000 );
     pManRes = Abc_ManResubStart( nCutMax, ABC_RS_DIV1_MAX );
@@ -3289,7 +3309,7 @@ int Abc_NtkOrchLocal( Abc_Ntk_t * pNtk, int fUseZeros_rwr, int fUseZeros_ref, in
     }
     // cut manager for rewrite
 clk = Abc_Clock();
-    pManCutRwr = Abc_NtkStartCutManForRewrite( pNtk );
+    pManCutRwr = Abc_NtkStartCutManForRewrite( pNtk, NULL );
 Rwr_ManAddTimeCuts( pManRwr, Abc_Clock() - clk );
     pNtk->pManCut = pManCutRwr;
 
@@ -3334,6 +3354,12 @@ Rwr_ManAddTimeCuts( pManRwr, Abc_Clock() - clk );
         // stop if all nodes have been tried once
         if ( i >= nNodes )
             break;
+        // skip the nodes where no operator applied in the concurrent evaluation
+        if ( vGainRwr && Vec_IntEntry(vGainRwr, i) < 0 && Vec_IntEntry(vGainRes, i) < 0 && Vec_IntEntry(vGainRef, i) < 0 )
+        {
+            ops_null++;
+            continue;
+        }
         
 clk = Abc_Clock();
 
@@ -3478,6 +3504,9 @@ pManRef->timeTotal = Abc_Clock() - clkStart;
     // delete the managers
     // resub
     Abc_ManResubStop( pManRes );
+    Vec_IntFreeP( &vGainRwr );
+    Vec_IntFreeP( &vGainRes );
+    Vec_IntFreeP( &vGainRef );
     Abc_NtkManCutStop( pManCutRes );
     // rewrite
     Rwr_ManStop( pManRwr );
@@ -3583,7 +3612,7 @@ int Abc_NtkOchestration( Abc_Ntk_t * pNtk, Vec_Int_t **pGain_rwr, Vec_Int_t **pG
     
     // cut manager for rewrite
 clk = Abc_Clock();
-    pManCutRwr = Abc_NtkStartCutManForRewrite( pNtk );
+    pManCutRwr = Abc_NtkStartCutManForRewrite( pNtk, NULL );
 Rwr_ManAddTimeCuts( pManRwr, Abc_Clock() - clk );
     pNtk->pManCut = pManCutRwr;
 
@@ -4409,7 +4438,7 @@ int Abc_NtkOchestration3( Abc_Ntk_t * pNtk, Vec_Int_t **pGain_rwr, Vec_Int_t **p
     }
     // cut manager for rewrite
 clk = Abc_Clock();
-    pManCutRwr = Abc_NtkStartCutManForRewrite( pNtk );
+    pManCutRwr = Abc_NtkStartCutManForRewrite( pNtk, NULL );
 Rwr_ManAddTimeCuts( pManRwr, Abc_Clock() - clk );
     pNtk->pManCut = pManCutRwr;
 
@@ -4777,7 +4806,7 @@ int Abc_NtkOchestration2( Abc_Ntk_t * pNtk, Vec_Int_t **pGain_rwr, Vec_Int_t **p
     }
     // cut manager for rewrite
 clk = Abc_Clock();
-    pManCutRwr = Abc_NtkStartCutManForRewrite( pNtk );
+    pManCutRwr = Abc_NtkStartCutManForRewrite( pNtk, NULL );
 Rwr_ManAddTimeCuts( pManRwr, Abc_Clock() - clk );
     pNtk->pManCut = pManCutRwr;
 
@@ -5113,241 +5142,41 @@ s_ResubTime = Abc_Clock() - clkStart;
 // rw rs rf embedding generation for GNN learning
 int Abc_NtkOrchGNN( Abc_Ntk_t * pNtk,  char * edgelistFile, char * featFile, int fUseZeros, int fUseZeros_rwr, int fUseZeros_ref, int fPlaceEnable, int nCutMax, int nStepsMax, int nLevelsOdc, int fUpdateLevel, int fVerbose, int fVeryVerbose, int nNodeSizeMax, int nConeSizeMax, int fUseDcs )
 {
-    ProgressBar * pProgress;
-    // For resub
-    Abc_ManRes_t * pManRes;
-    Abc_ManCut_t * pManCutRes;
-    Odc_Man_t * pManOdc = NULL;
-    Dec_Graph_t * pFFormRes;
-    Dec_Graph_t * pFFormRef_zeros;
-    Vec_Ptr_t * vLeaves;
-    // For rewrite
-    Cut_Man_t * pManCutRwr;
-    Rwr_Man_t * pManRwr;
-    //Dec_Graph_t * pGraph;
-    // For refactor
-    Abc_ManRef_t * pManRef;
-    Abc_ManCut_t * pManCutRef;
-    Dec_Graph_t * pFFormRef;
-    Vec_Ptr_t * vFanins;
-
-    Abc_Obj_t * pNode, * pFanin;
-    int fanin_i;
-    FILE * f_el;
-    FILE * f_feats;
-    //FILE * fpt;
-    abctime clk, clkStart = Abc_Clock();
-    abctime s_ResubTime;
-    int i, nNodes, nGain, nGain_zeros;//, fCompl, RetValue = 1;
-    int rwr_ok = 0;
-    int res_ok = 0;
-    int ref_ok = 0;
-    //int decisionOps = 0;
-    assert( Abc_NtkIsStrash(pNtk) );
-
-    // cleanup the AIG
-    Abc_AigCleanup((Abc_Aig_t *)pNtk->pManFunc);
-
-    // start the managers resub
-    pManCutRes = Abc_NtkManCutStart( nCutMax, 100000, 100000, 100000 );
-    pManRes = Abc_ManResubStart( nCutMax, ABC_RS_DIV1_MAX );
-    if ( nLevelsOdc > 0 )
-    pManOdc = Abc_NtkDontCareAlloc( nCutMax, nLevelsOdc, fVerbose, fVeryVerbose );
-    // start the managers refactor
-    pManCutRef = Abc_NtkManCutStart( nNodeSizeMax, nConeSizeMax, 2, 1000 );
-    pManRef = Abc_NtkManRefStart_1( nNodeSizeMax, nConeSizeMax, fUseDcs, fVerbose );
-    pManRef->vLeaves   = Abc_NtkManCutReadCutLarge( pManCutRef );
-    // start the managers rewrite
-    pManRwr = Rwr_ManStart( 0 );
-    if ( pManRwr == NULL )
+    Vec_Int_t * vEdges = Vec_IntAlloc( 2 * Abc_NtkObjNumMax(pNtk) );
+    Vec_Flt_t * vFeats = Vec_FltAlloc( ABC_ORCH_FEAT_NUM * Abc_NtkObjNumMax(pNtk) );
+    Abc_Obj_t * pNode;
+    FILE * f_el, * f_feats;
+    float * pFeat;
+    int i, k;
+    if ( !Abc_NtkOrchFeatures( pNtk, vEdges, vFeats, NULL, NULL, NULL, fUseZeros, fUseZeros_ref, nCutMax, nStepsMax, nLevelsOdc, fUpdateLevel, nNodeSizeMax, nConeSizeMax, fUseDcs, 1, fVerbose ) )
+    {
+        Vec_IntFree( vEdges );
+        Vec_FltFree( vFeats );
         return 0;
-
-    // compute the reverse levels if level update is requested
-    if ( fUpdateLevel )
-        Abc_NtkStartReverseLevels( pNtk, 0 );
-
-    // 'Resub only'
-    if ( Abc_NtkLatchNum(pNtk) ) {
-        Abc_NtkForEachLatch(pNtk, pNode, i)
-            pNode->pNext = (Abc_Obj_t *)pNode->pData;
     }
-    // cut manager for rewrite
-clk = Abc_Clock();
-    pManCutRwr = Abc_NtkStartCutManForRewrite( pNtk );
-Rwr_ManAddTimeCuts( pManRwr, Abc_Clock() - clk );
-    pNtk->pManCut = pManCutRwr;
-
-    if ( fVeryVerbose )
-        Rwr_ScoresClean( pManRwr );
-
-  // resynthesize each node once
-  // resub
-    pManRes->nNodesBeg = Abc_NtkNodeNum(pNtk);
-  // rewrite
-    pManRwr->nNodesBeg = Abc_NtkNodeNum(pNtk);
-  // refactor
-    pManRef->nNodesBeg = Abc_NtkNodeNum(pNtk);
-
-    nNodes = Abc_NtkObjNumMax(pNtk);
-    //printf("nNodes: %d\n", nNodes);
-    //if (pGain_res) *pGain_res = Vec_IntAlloc(1);
-    //if (pGain_ref) *pGain_ref = Vec_IntAlloc(1);
-    //if (pGain_rwr) *pGain_rwr = Vec_IntAlloc(1);
-
-    pProgress = Extra_ProgressBarStart( stdout, nNodes );
-    //fpt = fopen("GNN_Embedding.csv", "w");
-    f_el = fopen(edgelistFile, "w");
-    f_feats = fopen(featFile, "w");
-
-    Abc_NtkForEachNode( pNtk, pNode, i )
+    f_el = fopen( edgelistFile, "w" );
+    f_feats = fopen( featFile, "w" );
+    if ( f_el == NULL || f_feats == NULL )
     {
-        int iterNode = pNode->Id;
-        Abc_ObjForEachFanin(pNode, pFanin, fanin_i){
-            fprintf(f_el, "%d %d\n", iterNode, Abc_ObjId(pFanin));
-        }
-        //printf("Nodes ID: %d\n", pNode->Id);
-        rwr_ok = 0;
-        ref_ok = 0;
-        res_ok = 0;
-        Extra_ProgressBarUpdate( pProgress, i, NULL );
-        // skip the constant node
-//        if ( Abc_NodeIsConst(pNode) )
-//            continue;
-        // skip persistant nodes
-
-        if ( Abc_NodeIsPersistant(pNode) )
-        {   
-            //fprintf(f_el, "%d %d\n", iterNode, Abc_ObjId(pFanin));
-            fprintf(f_feats, "%d, %d, %d, %d, %d, %d, %d, %d\n", Abc_ObjFaninC0(pNode), Abc_ObjFaninC1(pNode), -1, -1, -1, -1, -1, -1);
-            //fprintf(fpt, "%d, %d, %d, %d, %d, %d, %d, %d, %d,  %d\n", iterNode, Abc_ObjId(pFanin), Abc_ObjFaninC0(pNode), Abc_ObjFaninC1(pNode), -1, -1, -1, -1, -1, -1);
-            continue;
-        } 
-        // skip the nodes with many fanouts
-        if ( Abc_ObjFanoutNum(pNode) > 1000 )
-        {
-            //fprintf(f_el, "%d %d\n", iterNode, Abc_ObjId(pFanin));
-            fprintf(f_feats, "%d, %d, %d, %d, %d, %d, %d, %d\n", Abc_ObjFaninC0(pNode), Abc_ObjFaninC1(pNode), -1, -1, -1, -1, -1, -1);
-            //fprintf(fpt, "%d, %d, %d, %d, %d, %d, %d, %d, %d, %d\n", iterNode, Abc_ObjId(pFanin), Abc_ObjFaninC0(pNode), Abc_ObjFaninC1(pNode), -1, -1, -1, -1, -1, -1);
-            continue;
-        }
-        // stop if all nodes have been tried once
-        if ( i >= nNodes )
-            break;
-        
-clk = Abc_Clock();
-
-//Refactor
-        vFanins = Abc_NodeFindCut( pManCutRef, pNode, fUseDcs );
-pManRef->timeCut += Abc_Clock() - clk;
-clk = Abc_Clock();
-        pFFormRef = Abc_NodeRefactor_1( pManRef, pNode, vFanins, fUpdateLevel, fUseZeros, fUseDcs, fVerbose );
-        pFFormRef_zeros = Abc_NodeRefactor_1( pManRef, pNode, vFanins, fUpdateLevel, fUseZeros_ref, fUseDcs, fVerbose );
-pManRef->timeRes += Abc_Clock() - clk;
-        if (! (pManRef->nLastGain < 0) ) {ref_ok = 1;}
-
-// Resub
-        // compute a reconvergence-driven cut
-        vLeaves = Abc_NodeFindCut( pManCutRes, pNode, 0 );
-//        vLeaves = Abc_CutFactorLarge( pNode, nCutMax );
-pManRes->timeCut += Abc_Clock() - clk;
-        // get the don't-cares
-        if ( pManOdc )
-        {
-clk = Abc_Clock();
-            Abc_NtkDontCareClear( pManOdc );
-            Abc_NtkDontCareCompute( pManOdc, pNode, vLeaves, pManRes->pCareSet );
-pManRes->timeTruth += Abc_Clock() - clk;
-        }
-        // evaluate this cut
-clk = Abc_Clock();
-        pFFormRes = Abc_ManResubEval( pManRes, pNode, vLeaves, nStepsMax, fUpdateLevel, fVerbose );
-//        Vec_PtrFree( vLeaves );
-//        Abc_ManResubCleanup( pManRes );
-pManRes->timeRes += Abc_Clock() - clk;
-        // put nGain in Vector
-        if (! (pManRes->nLastGain < 0) ) {res_ok = 1;}
-
-// Rewrite
-        nGain = Rwr_NodeRewrite( pManRwr, pManCutRwr, pNode, fUpdateLevel, fUseZeros, fPlaceEnable );
-        nGain_zeros = Rwr_NodeRewrite( pManRwr, pManCutRwr, pNode, fUpdateLevel, fUseZeros_rwr, fPlaceEnable );
-        if (! (nGain < 0) ) {rwr_ok = 1;}
-
-        //fprintf(f_el, "%d %d\n", iterNode, Abc_ObjId(pFanin));
-        fprintf(f_feats, "%d, %d, %d, %d, %d, %d, %d, %d\n", Abc_ObjFaninC0(pNode), Abc_ObjFaninC1(pNode), rwr_ok, nGain, res_ok, pManRes->nLastGain, ref_ok, pManRef->nLastGain);
-        //fprintf(fpt, "%d, %d, %d, %d, %d, %d, %d, %d, %d, %d\n", iterNode, Abc_ObjId(pFanin), Abc_ObjFaninC0(pNode), Abc_ObjFaninC1(pNode), rwr_ok, nGain, res_ok, pManRes->nLastGain, ref_ok, pManRef->nLastGain);
-        //printf("Res Ochestration: %d\n", pManRes->nLastGain);
-        //printf("Ref Ochestration: %d\n", pManRef->nLastGain);
-        //printf("Rwr Ochestration: %d\n", nGain);
-
-     //continue; 
-     //}
-     //continue; 
-    }
-    fclose(f_el);
-    fclose(f_feats);
-    //fclose(fpt);
-    
-    
-    Extra_ProgressBarStop( pProgress );
-// Rewrite
-Rwr_ManAddTimeTotal( pManRwr, Abc_Clock() - clkStart );
-    pManRwr->nNodesEnd = Abc_NtkNodeNum(pNtk);
-
-// Resub
-pManRes->timeTotal = Abc_Clock() - clkStart;
-    pManRes->nNodesEnd = Abc_NtkNodeNum(pNtk);
-
-// Refactor
-pManRef->timeTotal = Abc_Clock() - clkStart;
-    pManRef->nNodesEnd = Abc_NtkNodeNum(pNtk);
-
-    // print statistics
-    if ( fVerbose ){
-        Abc_ManResubPrint( pManRes );
-        Rwr_ManPrintStats( pManRwr );
-        Abc_NtkManRefPrintStats_1( pManRef );
-    }
-    if ( fVeryVerbose )
-        Rwr_ScoresReport( pManRwr );
-    // delete the managers
-    // resub
-    Abc_ManResubStop( pManRes );
-    Abc_NtkManCutStop( pManCutRes );
-    // rewrite
-    Rwr_ManStop( pManRwr );
-    Cut_ManStop( pManCutRwr );
-    pNtk->pManCut = NULL;
-    // refactor
-    Abc_NtkManCutStop( pManCutRef );
-    Abc_NtkManRefStop_1( pManRef );
-
-    if ( pManOdc ) Abc_NtkDontCareFree( pManOdc );
-
-    // clean the data field
-    Abc_NtkForEachObj( pNtk, pNode, i )
-        pNode->pData = NULL;
-
-    if ( Abc_NtkLatchNum(pNtk) ) {
-        Abc_NtkForEachLatch(pNtk, pNode, i)
-            pNode->pData = pNode->pNext, pNode->pNext = NULL;
+        printf( "Cannot open the output files.\n" );
+        if ( f_el ) fclose( f_el );
+        if ( f_feats ) fclose( f_feats );
+        Vec_IntFree( vEdges );
+        Vec_FltFree( vFeats );
+        return 0;
     }
-
-    // put the nodes into the DFS order and reassign their IDs
-    Abc_NtkReassignIds( pNtk );
-//    Abc_AigCheckFaninOrder( pNtk->pManFunc );
-
-    // fix the levels
-    if ( fUpdateLevel )
-        Abc_NtkStopReverseLevels( pNtk );
-    else
-        Abc_NtkLevel( pNtk );
-    // check
-    if ( !Abc_NtkCheck( pNtk ) )
+    for ( i = 0; i + 1 < Vec_IntSize(vEdges); i += 2 )
+        fprintf( f_el, "%d %d\n", Vec_IntEntry(vEdges, i), Vec_IntEntry(vEdges, i+1) );
+    Abc_NtkForEachNode( pNtk, pNode, i )
     {
-        printf( "Abc_NtkOchestraction: The network check has failed.\n" );
-        return 0;
+        pFeat = Vec_FltEntryP( vFeats, ABC_ORCH_FEAT_NUM * i );
+        for ( k = 0; k < ABC_ORCH_FEAT_NUM; k++ )
+            fprintf( f_feats, "%d%s", (int)pFeat[k], k == ABC_ORCH_FEAT_NUM-1 ? "\n" : ", " );
     }
-s_ResubTime = Abc_Clock() - clkStart;
+    fclose( f_el );
+    fclose( f_feats );
+    Vec_IntFree( vEdges );
+    Vec_FltFree( vFeats );
     return 1;
 }
 
@@ -5417,7 +5246,7 @@ int Abc_NtkOrchRand( Abc_Ntk_t * pNtk, Vec_Int_t **pGain_rwr, Vec_Int_t **pGain_
     
     // cut manager for rewrite
 clk = Abc_Clock();
-    pManCutRwr = Abc_NtkStartCutManForRewrite( pNtk );
+    pManCutRwr = Abc_NtkStartCutManForRewrite( pNtk, NULL );
 Rwr_ManAddTimeCuts( pManRwr, Abc_Clock() - clk );
     pNtk->pManCut = pManCutRwr;
 
@@ -5665,6 +5494,514 @@ pManRef->timeTotal = Abc_Clock() - clkStart;
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Managers used to evaluate rewrite, resub and refactor.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Abc_OrchMan_t_ Abc_OrchMan_t;
+struct Abc_OrchMan_t_
+{
+    Abc_ManRes_t *   pManRes;      // resub manager
+    Abc_ManCut_t *   pManCutRes;   // resub cut manager
+    Odc_Man_t *      pManOdc;      // don't-care manager
+    Abc_ManRef_t *   pManRef;      // refactor manager
+    Abc_ManCut_t *   pManCutRef;   // refactor cut manager
+    Rwr_Man_t *      pManRwr;      // rewrite manager
+    Cut_Man_t *      pManCutRwr;   // rewrite cut manager
+    Cut_Params_t     ParamsRwr;    // rewrite cut manager parameters
+    Dec_Graph_t *    pFFormRes;    // the last resub structure
+    Dec_Graph_t *    pFFormRef;    // the last refactor structure
+};
+
+Abc_OrchMan_t * Abc_NtkOrchManStart( Abc_Ntk_t * pNtk, int nCutMax, int nLevelsOdc, int nNodeSizeMax, int nConeSizeMax, int fUseDcs, int fVerbose )
+{
+    Abc_OrchMan_t * p;
+    Rwr_Man_t * pManRwr = Rwr_ManStart( 0 );
+    if ( pManRwr == NULL )
+        return NULL;
+    p = ABC_CALLOC( Abc_OrchMan_t, 1 );
+    p->pManRwr    = pManRwr;
+    p->pManCutRes = Abc_NtkManCutStart( nCutMax, 100000, 100000, 100000 );
+    p->pManRes    = Abc_ManResubStart( nCutMax, ABC_RS_DIV1_MAX );
+    if ( nLevelsOdc > 0 )
+        p->pManOdc = Abc_NtkDontCareAlloc( nCutMax, nLevelsOdc, fVerbose, 0 );
+    p->pManCutRef = Abc_NtkManCutStart( nNodeSizeMax, nConeSizeMax, 2, 1000 );
+    p->pManRef    = Abc_NtkManRefStart_1( nNodeSizeMax, nConeSizeMax, fUseDcs, fVerbose );
+    p->pManRef->vLeaves = Abc_NtkManCutReadCutLarge( p->pManCutRef );
+    p->pManCutRwr = Abc_NtkStartCutManForRewrite( pNtk, &p->ParamsRwr );
+    return p;
+}
+void Abc_NtkOrchManStop( Abc_OrchMan_t * p )
+{
+    if ( p->pFFormRes ) Dec_GraphFree( p->pFFormRes );
+    if ( p->pFFormRef ) Dec_GraphFree( p->pFFormRef );
+    Abc_ManResubStop( p->pManRes );
+    Abc_NtkManCutStop( p->pManCutRes );
+    if ( p->pManOdc ) Abc_NtkDontCareFree( p->pManOdc );
+    Abc_NtkManCutStop( p->pManCutRef );
+    Abc_NtkManRefStop_1( p->pManRef );
+    Rwr_ManStop( p->pManRwr );
+    Cut_ManStop( p->pManCutRwr );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Evaluates the gains of the operators for one node.]
+
+  Description [Only the operators in the mask are evaluated (ABC_ORCH_RWR,
+  ABC_ORCH_RES, ABC_ORCH_REF). The gains are returned in the order rewrite,
+  resub, refactor; the gain is -1 if no replacement is found. The structures
+  found by resub and refactor are kept in the manager until the next call,
+  while the rewrite structure is kept in the rewrite manager.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkOrchEvalNode( Abc_OrchMan_t * p, Abc_Obj_t * pNode, int Mask, int fUseZeros_rwr, int fUseZeros_ref, int nStepsMax, int fUpdateLevel, int fUseDcs, int pGains[3] )
+{
+    Vec_Ptr_t * vLeaves, * vFanins;
+    if ( p->pFFormRes ) Dec_GraphFree( p->pFFormRes ), p->pFFormRes = NULL;
+    if ( p->pFFormRef ) Dec_GraphFree( p->pFFormRef ), p->pFFormRef = NULL;
+    pGains[0] = pGains[1] = pGains[2] = -1;
+    if ( Mask & ABC_ORCH_RWR )
+        pGains[0] = Rwr_NodeRewrite( p->pManRwr, p->pManCutRwr, pNode, fUpdateLevel, fUseZeros_rwr, 0 );
+    if ( Mask & ABC_ORCH_RES )
+    {
+        vLeaves = Abc_NodeFindCut( p->pManCutRes, pNode, 0 );
+        if ( p->pManOdc )
+        {
+            Abc_NtkDontCareClear( p->pManOdc );
+            Abc_NtkDontCareCompute( p->pManOdc, pNode, vLeaves, p->pManRes->pCareSet );
+        }
+        p->pFFormRes = Abc_ManResubEval( p->pManRes, pNode, vLeaves, nStepsMax, fUpdateLevel, 0 );
+        pGains[1] = p->pFFormRes ? p->pManRes->nLastGain : -1;
+    }
+    if ( Mask & ABC_ORCH_REF )
+    {
+        vFanins = Abc_NodeFindCut( p->pManCutRef, pNode, fUseDcs );
+        p->pFFormRef = Abc_NodeRefactor_1( p->pManRef, pNode, vFanins, fUpdateLevel, fUseZeros_ref, fUseDcs, 0 );
+        pGains[2] = p->pFFormRef ? p->pManRef->nLastGain : -1;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Evaluates the gains of the operators for a subset of nodes.]
+
+  Description [The job evaluates the nodes whose index modulo the number
+  of jobs is equal to the job index. Evaluation temporarily modifies the
+  network (reference counters, traversal IDs, the data field of the nodes),
+  so in the multi-threaded mode each job works on its own copy of the
+  network, while the gains are written into the arrays indexed by the
+  object IDs of the original network.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Abc_OrchJob_t_ Abc_OrchJob_t;
+struct Abc_OrchJob_t_
+{
+    Abc_Ntk_t *      pNtk;         // the network to evaluate (the original or its copy)
+    Vec_Ptr_t *      vCopies;      // mapping of the original object IDs into the copy (or NULL)
+    Vec_Int_t *      vMask;        // the operators to evaluate for each node (or NULL)
+    Vec_Int_t *      vGains[3];    // gains of rewrite, resub and refactor
+    int              iJob;         // the index of this job
+    int              nJobs;        // the number of jobs
+    int              nNodes;       // the number of objects to evaluate
+    // parameters
+    int              fUseZeros_rwr;
+    int              fUseZeros_ref;
+    int              nCutMax;
+    int              nStepsMax;
+    int              nLevelsOdc;
+    int              fUpdateLevel;
+    int              nNodeSizeMax;
+    int              nConeSizeMax;
+    int              fUseDcs;
+    int              RetValue;     // 1 if the job succeeded
+};
+
+int Abc_NtkOrchEvalJob( void * pArg )
+{
+    Abc_OrchJob_t * pJob = (Abc_OrchJob_t *)pArg;
+    Abc_OrchMan_t * p;
+    Abc_Obj_t * pNode;
+    int i, k, Mask, pGains[3];
+    p = Abc_NtkOrchManStart( pJob->pNtk, pJob->nCutMax, pJob->nLevelsOdc, pJob->nNodeSizeMax, pJob->nConeSizeMax, pJob->fUseDcs, 0 );
+    if ( p == NULL )
+        return 0;
+    pJob->pNtk->pManCut = p->pManCutRwr;
+    for ( i = pJob->iJob; i < pJob->nNodes; i += pJob->nJobs )
+    {
+        pNode = pJob->vCopies ? (Abc_Obj_t *)Vec_PtrEntry(pJob->vCopies, i) : Abc_NtkObj(pJob->pNtk, i);
+        if ( pNode == NULL || !Abc_ObjIsNode(pNode) )
+            continue;
+        if ( Abc_NodeIsPersistant(pNode) || Abc_ObjFanoutNum(pNode) > 1000 )
+            continue;
+        Mask = pJob->vMask ? Vec_IntEntry(pJob->vMask, i) : ABC_ORCH_RWR | ABC_ORCH_RES | ABC_ORCH_REF;
+        if ( Mask == 0 )
+            continue;
+        Abc_NtkOrchEvalNode( p, pNode, Mask, pJob->fUseZeros_rwr, pJob->fUseZeros_ref, pJob->nStepsMax, pJob->fUpdateLevel, pJob->fUseDcs, pGains );
+        for ( k = 0; k < 3; k++ )
+            if ( pJob->vGains[k] )
+                Vec_IntWriteEntry( pJob->vGains[k], i, pGains[k] );
+    }
+    pJob->pNtk->pManCut = NULL;
+    Abc_NtkOrchManStop( p );
+    pJob->RetValue = 1;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Evaluates the gains of the operators for all nodes.]
+
+  Description [The network is not modified. The gain vectors (if given)
+  are resized to the number of objects and contain the gains of rewrite,
+  resub and refactor for each node (-99 for the nodes that are not evaluated,
+  -1 if no replacement is found). The mask (if given) is indexed by the
+  object ID and contains the operators to evaluate. If the number of
+  threads is more than one, the nodes are evaluated concurrently using
+  copies of the network. Returns 0 on failure.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkOrchEvalGains( Abc_Ntk_t * pNtk, Vec_Int_t * vMask, Vec_Int_t * vGainRwr, Vec_Int_t * vGainRes, Vec_Int_t * vGainRef, int fUseZeros_rwr, int fUseZeros_ref, int nCutMax, int nStepsMax, int nLevelsOdc, int fUpdateLevel, int nNodeSizeMax, int nConeSizeMax, int fUseDcs, int nProcs )
+{
+    Abc_OrchJob_t * pJobs;
+    Vec_Ptr_t * vJobs;
+    Abc_Obj_t * pObj;
+    int i, k, nJobs = nProcs > 1 ? Abc_MaxInt(1, nProcs-1) : 1;
+    int nNodes = Abc_NtkObjNumMax(pNtk), RetValue = 1;
+    assert( Abc_NtkIsStrash(pNtk) );
+    if ( vGainRwr ) Vec_IntFill( vGainRwr, nNodes, -99 );
+    if ( vGainRes ) Vec_IntFill( vGainRes, nNodes, -99 );
+    if ( vGainRef ) Vec_IntFill( vGainRef, nNodes, -99 );
+    // create the jobs
+    pJobs = ABC_CALLOC( Abc_OrchJob_t, nJobs );
+    vJobs = Vec_PtrAlloc( nJobs );
+    for ( i = 0; i < nJobs; i++ )
+    {
+        Abc_OrchJob_t * pJob = pJobs + i;
+        pJob->pNtk          = pNtk;
+        pJob->vMask         = vMask;
+        pJob->vGains[0]     = vGainRwr;
+        pJob->vGains[1]     = vGainRes;
+        pJob->vGains[2]     = vGainRef;
+        pJob->iJob          = i;
+        pJob->nJobs         = nJobs;
+        pJob->nNodes        = nNodes;
+        pJob->fUseZeros_rwr = fUseZeros_rwr;
+        pJob->fUseZeros_ref = fUseZeros_ref;
+        pJob->nCutMax       = nCutMax;
+        pJob->nStepsMax     = nStepsMax;
+        pJob->nLevelsOdc    = nLevelsOdc;
+        pJob->fUpdateLevel  = fUpdateLevel;
+        pJob->nNodeSizeMax  = nNodeSizeMax;
+        pJob->nConeSizeMax  = nConeSizeMax;
+        pJob->fUseDcs       = fUseDcs;
+        if ( nProcs > 1 )
+        {
+            // the copy is derived here because duplication uses the copy field of the original
+            pJob->pNtk = Abc_NtkDup( pNtk );
+            pJob->vCopies = Vec_PtrStart( nNodes );
+            Abc_NtkForEachObj( pNtk, pObj, k )
+                if ( pObj->pCopy )
+                    Vec_PtrWriteEntry( pJob->vCopies, k, Abc_ObjRegular(pObj->pCopy) );
+            if ( fUpdateLevel )
+                Abc_NtkStartReverseLevels( pJob->pNtk, 0 );
+        }
+        Vec_PtrPush( vJobs, pJob );
+    }
+    // evaluate the nodes
+    if ( nProcs > 1 )
+    {
+        Abc_FrameReadManDec(); // make sure the shared tables are created before the threads start
+        Util_ProcessThreads( Abc_NtkOrchEvalJob, vJobs, nProcs, 0, 0 );
+    }
+    else
+    {
+        if ( fUpdateLevel )
+            Abc_NtkStartReverseLevels( pNtk, 0 );
+        if ( Abc_NtkLatchNum(pNtk) )
+        {
+            Abc_NtkForEachLatch( pNtk, pObj, i )
+                pObj->pNext = (Abc_Obj_t *)pObj->pData;
+        }
+        Abc_NtkOrchEvalJob( pJobs );
+        Abc_NtkForEachObj( pNtk, pObj, i )
+            pObj->pData = NULL;
+        if ( Abc_NtkLatchNum(pNtk) )
+        {
+            Abc_NtkForEachLatch( pNtk, pObj, i )
+                pObj->pData = pObj->pNext, pObj->pNext = NULL;
+        }
+        if ( fUpdateLevel )
+            Abc_NtkStopReverseLevels( pNtk );
+    }
+    for ( i = 0; i < nJobs; i++ )
+    {
+        RetValue &= pJobs[i].RetValue;
+        if ( pJobs[i].pNtk != pNtk )
+            Abc_NtkDelete( pJobs[i].pNtk );
+        if ( pJobs[i].vCopies )
+            Vec_PtrFree( pJobs[i].vCopies );
+    }
+    Vec_PtrFree( vJobs );
+    ABC_FREE( pJobs );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes node features and operator gains in memory.]
+
+  Description [The network is not modified and the object IDs are preserved,
+  so that the results can be indexed by the object ID. The gain vectors (if
+  given) are resized to the number of objects and contain the gains of
+  rewrite, resub and refactor for each node (-99 for the nodes that are not
+  evaluated, -1 if no replacement is found). The edge vector (if given)
+  contains the pairs (node ID, fanin ID) for each fanin of each node. The
+  feature vector (if given) is a contiguous buffer with ABC_ORCH_FEAT_NUM
+  numbers for each object: two fanin complemented attributes, followed by
+  the flag and the gain of rewrite, resub and refactor; the objects that
+  are not internal nodes have zero features. Returns 0 on failure.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkOrchFeatures( Abc_Ntk_t * pNtk, Vec_Int_t * vEdges, Vec_Flt_t * vFeats, Vec_Int_t * vGainRwr, Vec_Int_t * vGainRes, Vec_Int_t * vGainRef, int fUseZeros_rwr, int fUseZeros_ref, int nCutMax, int nStepsMax, int nLevelsOdc, int fUpdateLevel, int nNodeSizeMax, int nConeSizeMax, int fUseDcs, int nProcs, int fVerbose )
+{
+    Vec_Int_t * vGains[3] = { vGainRwr, vGainRes, vGainRef }, * vTemps[3] = { NULL };
+    Abc_Obj_t * pNode, * pFanin;
+    float * pFeat;
+    int i, k, Gain, RetValue;
+    abctime clkStart = Abc_Clock();
+    assert( Abc_NtkIsStrash(pNtk) );
+    Abc_AigCleanup((Abc_Aig_t *)pNtk->pManFunc);
+    for ( k = 0; k < 3; k++ )
+        if ( vGains[k] == NULL && vFeats )
+            vGains[k] = vTemps[k] = Vec_IntAlloc( 0 );
+    RetValue = Abc_NtkOrchEvalGains( pNtk, NULL, vGains[0], vGains[1], vGains[2], fUseZeros_rwr, fUseZeros_ref, nCutMax, nStepsMax, nLevelsOdc, fUpdateLevel, nNodeSizeMax, nConeSizeMax, fUseDcs, nProcs );
+    if ( vEdges )
+    {
+        Vec_IntClear( vEdges );
+        Abc_NtkForEachNode( pNtk, pNode, i )
+            Abc_ObjForEachFanin( pNode, pFanin, k )
+                Vec_IntPushTwo( vEdges, Abc_ObjId(pNode), Abc_ObjId(pFanin) );
+    }
+    if ( vFeats )
+    {
+        Vec_FltFill( vFeats, ABC_ORCH_FEAT_NUM * Abc_NtkObjNumMax(pNtk), 0 );
+        Abc_NtkForEachNode( pNtk, pNode, i )
+        {
+            pFeat = Vec_FltEntryP( vFeats, ABC_ORCH_FEAT_NUM * i );
+            pFeat[0] = (float)Abc_ObjFaninC0(pNode);
+            pFeat[1] = (float)Abc_ObjFaninC1(pNode);
+            for ( k = 0; k < 3; k++ )
+            {
+                Gain = Vec_IntEntry( vGains[k], i );
+                pFeat[2+2*k] = Gain == -99 ? -1 : (float)(Gain >= 0);
+                pFeat[3+2*k] = Gain == -99 ? -1 : (float)Gain;
+            }
+        }
+    }
+    for ( k = 0; k < 3; k++ )
+        Vec_IntFreeP( &vTemps[k] );
+    if ( fVerbose )
+        Abc_PrintTime( 1, "Orchestration features", Abc_Clock() - clkStart );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Applies the operators selected by the policy.]
+
+  Description [The mask is indexed by the object ID and contains the set
+  of operators (ABC_ORCH_RWR, ABC_ORCH_RES, ABC_ORCH_REF) allowed for the
+  node. Only the allowed operators are evaluated, and the first of them in
+  the order rewrite, resub, refactor that has a positive gain (or zero gain
+  if zero-cost replacements are enabled) is applied. The decision vector
+  (if given) is indexed by the original object ID and contains the applied
+  operator (0 = rewrite, 1 = resub, 2 = refactor, -1 = none). The object IDs
+  are reassigned after the network is updated. If the number of threads is
+  more than one, the allowed operators are first evaluated concurrently on
+  the original network, and the operators that do not apply are skipped
+  when the network is updated. Returns 1 on success, 0 on
+  failure, and -1 if the network may have been corrupted.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkOrchApply( Abc_Ntk_t * pNtk, Vec_Int_t * vMask, Vec_Int_t * vDecisions, int fUseZeros_rwr, int fUseZeros_ref, int nCutMax, int nStepsMax, int nLevelsOdc, int fUpdateLevel, int nNodeSizeMax, int nConeSizeMax, int fUseDcs, int nProcs, int fVerbose )
+{
+    Vec_Int_t * vGains[3] = { NULL };
+    Abc_OrchMan_t * p;
+    Abc_Obj_t * pNode;
+    Dec_Graph_t * pGraph;
+    int i, k, Mask, fCompl, nNodes, pGains[3], RetValue = 1;
+    int nNodesBeg = Abc_NtkNodeNum(pNtk), pCounts[3] = {0};
+    abctime clkStart = Abc_Clock();
+    assert( Abc_NtkIsStrash(pNtk) );
+    Abc_AigCleanup((Abc_Aig_t *)pNtk->pManFunc);
+    nNodes = Abc_NtkObjNumMax(pNtk);
+    assert( Vec_IntSize(vMask) >= nNodes );
+    if ( vDecisions ) Vec_IntFill( vDecisions, nNodes, -1 );
+    if ( nProcs > 1 )
+    {
+        // evaluate the allowed operators concurrently and skip those that do not apply
+        vMask = Vec_IntDup( vMask );
+        for ( k = 0; k < 3; k++ )
+            vGains[k] = Vec_IntAlloc( 0 );
+        Abc_NtkOrchEvalGains( pNtk, vMask, vGains[0], vGains[1], vGains[2], fUseZeros_rwr, fUseZeros_ref, nCutMax, nStepsMax, nLevelsOdc, fUpdateLevel, nNodeSizeMax, nConeSizeMax, fUseDcs, nProcs );
+        for ( i = 0; i < nNodes; i++ )
+            for ( k = 0; k < 3; k++ )
+                if ( Vec_IntEntry(vGains[k], i) < 0 )
+                    Vec_IntWriteEntry( vMask, i, Vec_IntEntry(vMask, i) & ~(1 << k) );
+        for ( k = 0; k < 3; k++ )
+            Vec_IntFree( vGains[k] );
+    }
+    p = Abc_NtkOrchManStart( pNtk, nCutMax, nLevelsOdc, nNodeSizeMax, nConeSizeMax, fUseDcs, fVerbose );
+    if ( p == NULL )
+    {
+        if ( nProcs > 1 )
+            Vec_IntFree( vMask );
+        return 0;
+    }
+    if ( fUpdateLevel )
+        Abc_NtkStartReverseLevels( pNtk, 0 );
+    if ( Abc_NtkLatchNum(pNtk) )
+    {
+        Abc_NtkForEachLatch( pNtk, pNode, i )
+            pNode->pNext = (Abc_Obj_t *)pNode->pData;
+    }
+    pNtk->pManCut = p->pManCutRwr;
+    Abc_NtkForEachNode( pNtk, pNode, i )
+    {
+        if ( i >= nNodes )
+            break;
+        if ( Abc_NodeIsPersistant(pNode) || Abc_ObjFanoutNum(pNode) > 1000 )
+            continue;
+        if ( (Mask = Vec_IntEntry(vMask, i)) == 0 )
+            continue;
+        Abc_NtkOrchEvalNode( p, pNode, Mask, fUseZeros_rwr, fUseZeros_ref, nStepsMax, fUpdateLevel, fUseDcs, pGains );
+        if ( pGains[0] > 0 || (pGains[0] == 0 && fUseZeros_rwr) )
+        {
+            pGraph = (Dec_Graph_t *)Rwr_ManReadDecs(p->pManRwr);
+            fCompl = Rwr_ManReadCompl(p->pManRwr);
+            if ( fCompl ) Dec_GraphComplement( pGraph );
+            Dec_GraphUpdateNetwork( pNode, pGraph, fUpdateLevel, pGains[0] );
+            if ( fCompl ) Dec_GraphComplement( pGraph );
+            if ( vDecisions ) Vec_IntWriteEntry( vDecisions, i, 0 );
+            pCounts[0]++;
+        }
+        else if ( pGains[1] > 0 )
+        {
+            Dec_GraphUpdateNetwork( pNode, p->pFFormRes, fUpdateLevel, pGains[1] );
+            if ( vDecisions ) Vec_IntWriteEntry( vDecisions, i, 1 );
+            pCounts[1]++;
+        }
+        else if ( pGains[2] > 0 || (pGains[2] == 0 && fUseZeros_ref) )
+        {
+            if ( !Dec_GraphUpdateNetwork( pNode, p->pFFormRef, fUpdateLevel, pGains[2] ) )
+            {
+                RetValue = -1;
+                break;
+            }
+            if ( vDecisions ) Vec_IntWriteEntry( vDecisions, i, 2 );
+            pCounts[2]++;
+        }
+    }
+    pNtk->pManCut = NULL;
+    Abc_NtkOrchManStop( p );
+    if ( nProcs > 1 )
+        Vec_IntFree( vMask );
+    Abc_NtkForEachObj( pNtk, pNode, i )
+        pNode->pData = NULL;
+    if ( Abc_NtkLatchNum(pNtk) )
+    {
+        Abc_NtkForEachLatch( pNtk, pNode, i )
+            pNode->pData = pNode->pNext, pNode->pNext = NULL;
+    }
+    if ( RetValue == -1 )
+    {
+        if ( fUpdateLevel )
+            Abc_NtkStopReverseLevels( pNtk );
+        return -1;
+    }
+    Abc_NtkReassignIds( pNtk );
+    if ( fUpdateLevel )
+        Abc_NtkStopReverseLevels( pNtk );
+    else
+        Abc_NtkLevel( pNtk );
+    if ( fVerbose )
+    {
+        printf( "Rewrite = %d.  Resub = %d.  Refactor = %d.  Gain = %d nodes.  ", pCounts[0], pCounts[1], pCounts[2], nNodesBeg - Abc_NtkNodeNum(pNtk) );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clkStart );
+    }
+    if ( !Abc_NtkCheck( pNtk ) )
+    {
+        printf( "Abc_NtkOrchApply: The network check has failed.\n" );
+        return 0;
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the features in a compact binary format.]
+
+  Description [The file contains the header (four 32-bit integers: the
+  format version ABC_ORCH_BIN_VERSION, the number of objects, the number of
+  features per object, the number of edges), followed by the edges as pairs
+  of 32-bit integers and the features as 32-bit floats.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkOrchWriteFeatures( char * pFileName, Vec_Int_t * vEdges, Vec_Flt_t * vFeats )
+{
+    int pHeader[4];
+    FILE * pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open file \"%s\" for writing.\n", pFileName );
+        return 0;
+    }
+    assert( Vec_FltSize(vFeats) % ABC_ORCH_FEAT_NUM == 0 );
+    pHeader[0] = ABC_ORCH_BIN_VERSION;
+    pHeader[1] = Vec_FltSize(vFeats) / ABC_ORCH_FEAT_NUM;
+    pHeader[2] = ABC_ORCH_FEAT_NUM;
+    pHeader[3] = Vec_IntSize(vEdges) / 2;
+    fwrite( pHeader, sizeof(int), 4, pFile );
+    fwrite( Vec_IntArray(vEdges), sizeof(int), Vec_IntSize(vEdges), pFile );
+    fwrite( Vec_FltArray(vFeats), sizeof(float), Vec_FltSize(vFeats), pFile );
+    fclose( pFile );
+    return 1;
+}
+
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -50,6 +50,8 @@ typedef struct MvAlias      Abc_Alias;    // one alias
 /*=== cmd.c ===========================================================*/
 extern void        Cmd_Init( Abc_Frame_t * pAbc );
 extern void        Cmd_End( Abc_Frame_t * pAbc );
+/*=== cmdAlias.c ======================================================*/
+extern void        Cmd_AliasCopy( Abc_Frame_t * pDst, Abc_Frame_t * pSrc );
 /*=== cmdApi.c ========================================================*/
 typedef int (*Cmd_CommandFuncType)(Abc_Frame_t*, int, char**);
 extern int         Cmd_CommandIsDefined( Abc_Frame_t * pAbc, const char * sName );
@@ -58,6 +58,28 @@ void CmdCommandAliasAdd( Abc_Frame_t * pAbc, char * sName, int argc, char ** arg
     assert(!fStatus);  
 }
 
+/**Function********************************************************************
+
+  Synopsis    [Copies the aliases of one frame into another frame.]
+
+  Description [The aliases already defined in the destination frame
+  are not changed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+void Cmd_AliasCopy( Abc_Frame_t * pDst, Abc_Frame_t * pSrc )
+{
+    st__generator * gen;
+    Abc_Alias * pAlias;
+    char * pKey;
+    st__foreach_item( pSrc->tAliases, gen, (const char **)&pKey, (char **)&pAlias )
+        if ( !st__is_member( pDst->tAliases, pKey ) )
+            CmdCommandAliasAdd( pDst, pAlias->sName, pAlias->argc, pAlias->argv );
+}
+
 /**Function********************************************************************
 
   Synopsis    [required]
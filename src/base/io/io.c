@@ -101,6 +101,7 @@ static int IoCommandWriteMMGia  ( Abc_Frame_t * pAbc, int argc, char **argv );
 extern void Abc_FrameCopyLTLDataBase( Abc_Frame_t *pAbc, Abc_Ntk_t * pNtk );
 
 extern int glo_fMapped;
+extern int glo_nProcs;
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -522,6 +523,7 @@ int IoCommandReadBlif( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fCheck;
     int fUseNewParser;
     int fSaveNames;
+    int nProcs;
     int c;
     extern Abc_Ntk_t * Io_ReadBlifAsAig( char * pFileName, int fCheck );
 
@@ -529,11 +531,23 @@ int IoCommandReadBlif( Abc_Frame_t * pAbc, int argc, char ** argv )
     fReadAsAig = 0;
     fUseNewParser = 1;
     fSaveNames = 0;
+    nProcs = 1;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "nmach" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Pnmach" ) ) != EOF )
     {
         switch ( c )
         {
+            case 'P':
+                if ( globalUtilOptind >= argc )
+                {
+                    fprintf( pAbc->Err, "Command line switch \"-P\" should be followed by an integer.\n" );
+                    goto usage;
+                }
+                nProcs = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if ( nProcs <= 0 )
+                    goto usage;
+                break;
             case 'n':
                 fUseNewParser ^= 1;
                 break;
@@ -559,6 +573,8 @@ int IoCommandReadBlif( Abc_Frame_t * pAbc, int argc, char ** argv )
     // read the file using the corresponding file reader
     if ( fReadAsAig )
         pNtk = Io_ReadBlifAsAig( pFileName, fCheck );
+    else if ( fUseNewParser && nProcs > 1 )
+        pNtk = Io_ReadPar( pFileName, IO_FILE_BLIF, nProcs, fCheck );
     else if ( fUseNewParser )
         pNtk = Io_Read( pFileName, IO_FILE_BLIF, fCheck, 0 );
     else
@@ -583,9 +599,10 @@ int IoCommandReadBlif( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: read_blif [-nmach] <file>\n" );
+    fprintf( pAbc->Err, "usage: read_blif [-P num] [-nmach] <file>\n" );
     fprintf( pAbc->Err, "\t         reads the network in binary BLIF format\n" );
     fprintf( pAbc->Err, "\t         (if this command does not work, try \"read\")\n" );
+    fprintf( pAbc->Err, "\t-P num : the number of threads parsing the flat file [default = %d]\n", nProcs );
     fprintf( pAbc->Err, "\t-n     : toggle using old BLIF parser without hierarchy support [default = %s]\n", !fUseNewParser? "yes":"no" );
     fprintf( pAbc->Err, "\t-m     : toggle saving original circuit names into a file [default = %s]\n", fSaveNames? "yes":"no" );
     fprintf( pAbc->Err, "\t-a     : toggle creating AIG while reading the file [default = %s]\n", fReadAsAig? "yes":"no" );
@@ -667,14 +684,27 @@ int IoCommandReadBench( Abc_Frame_t * pAbc, int argc, char ** argv )
     Abc_Ntk_t * pNtk;
     char * pFileName;
     int fCheck;
+    int nProcs;
     int c;
 
     fCheck = 1;
+    nProcs = 1;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "ch" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Pch" ) ) != EOF )
     {
         switch ( c )
         {
+            case 'P':
+                if ( globalUtilOptind >= argc )
+                {
+                    fprintf( pAbc->Err, "Command line switch \"-P\" should be followed by an integer.\n" );
+                    goto usage;
+                }
+                nProcs = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if ( nProcs <= 0 )
+                    goto usage;
+                break;
             case 'c':
                 fCheck ^= 1;
                 break;
@@ -689,7 +719,10 @@ int IoCommandReadBench( Abc_Frame_t * pAbc, int argc, char ** argv )
     // get the input file name
     pFileName = argv[globalUtilOptind];
     // read the file using the corresponding file reader
-    pNtk = Io_Read( pFileName, IO_FILE_BENCH, fCheck, 0 );
+    if ( nProcs > 1 )
+        pNtk = Io_ReadPar( pFileName, IO_FILE_BENCH, nProcs, fCheck );
+    else
+        pNtk = Io_Read( pFileName, IO_FILE_BENCH, fCheck, 0 );
     if ( pNtk == NULL )
         return 1;
     // replace the current network
@@ -698,8 +731,9 @@ int IoCommandReadBench( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: read_bench [-ch] <file>\n" );
+    fprintf( pAbc->Err, "usage: read_bench [-P num] [-ch] <file>\n" );
     fprintf( pAbc->Err, "\t         reads the network in BENCH format\n" );
+    fprintf( pAbc->Err, "\t-P num : the number of threads parsing the file [default = %d]\n", nProcs );
     fprintf( pAbc->Err, "\t-c     : toggle network check after reading [default = %s]\n", fCheck? "yes":"no" );
     fprintf( pAbc->Err, "\t-h     : prints the command summary\n" );
     fprintf( pAbc->Err, "\tfile   : the name of a file to read\n" );
@@ -1654,16 +1688,31 @@ int IoCommandReadVerilog( Abc_Frame_t * pAbc, int argc, char ** argv )
     Abc_Ntk_t * pNtk;
     char * pFileName;
     int fCheck, fBarBufs;
+    int nProcs, fVerbose;
     int c;
+    abctime clk;
 
     fCheck = 1;
     fBarBufs = 0;
+    nProcs = 1;
+    fVerbose = 0;
     glo_fMapped = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "mcbh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Pmcbvh" ) ) != EOF )
     {
         switch ( c )
         {
+            case 'P':
+                if ( globalUtilOptind >= argc )
+                {
+                    fprintf( pAbc->Err, "Command line switch \"-P\" should be followed by an integer.\n" );
+                    goto usage;
+                }
+                nProcs = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if ( nProcs <= 0 )
+                    goto usage;
+                break;
             case 'm':
                 glo_fMapped ^= 1;
                 break;
@@ -1673,6 +1722,9 @@ int IoCommandReadVerilog( Abc_Frame_t * pAbc, int argc, char ** argv )
             case 'b':
                 fBarBufs ^= 1;
                 break;
+            case 'v':
+                fVerbose ^= 1;
+                break;
             case 'h':
                 goto usage;
             default:
@@ -1684,20 +1736,32 @@ int IoCommandReadVerilog( Abc_Frame_t * pAbc, int argc, char ** argv )
     // get the input file name
     pFileName = argv[globalUtilOptind];
     // read the file using the corresponding file reader
+    clk = Abc_Clock();
+    glo_nProcs = nProcs;
     pNtk = Io_Read( pFileName, IO_FILE_VERILOG, fCheck, fBarBufs );
+    glo_nProcs = 1;
     if ( pNtk == NULL )
         return 1;
+    if ( fVerbose )
+    {
+        double MBytes = 1.0 * Extra_FileSize( pFileName ) / (1 << 20);
+        double Secs   = 1.0 * (Abc_Clock() - clk) / CLOCKS_PER_SEC;
+        printf( "Read %.2f MB in %.2f sec (%.2f MB/sec) using %d thread%s.\n", 
+            MBytes, Secs, Secs > 0 ? MBytes / Secs : 0.0, nProcs, nProcs > 1 ? "s" : "" );
+    }
     // replace the current network
     Abc_FrameReplaceCurrentNetwork( pAbc, pNtk );
     Abc_FrameClearVerifStatus( pAbc );
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: read_verilog [-mcbh] <file>\n" );
+    fprintf( pAbc->Err, "usage: read_verilog [-P num] [-mcbvh] <file>\n" );
     fprintf( pAbc->Err, "\t         reads the network in Verilog (IWLS 2002/2005 subset)\n" );
+    fprintf( pAbc->Err, "\t-P num : the number of threads parsing the modules [default = %d]\n", nProcs );
     fprintf( pAbc->Err, "\t-m     : toggle reading mapped Verilog [default = %s]\n", glo_fMapped? "yes":"no" );
     fprintf( pAbc->Err, "\t-c     : toggle network check after reading [default = %s]\n", fCheck? "yes":"no" );
     fprintf( pAbc->Err, "\t-b     : toggle reading barrier buffers [default = %s]\n", fBarBufs? "yes":"no" );
+    fprintf( pAbc->Err, "\t-v     : toggle printing the parsing throughput [default = %s]\n", fVerbose? "yes":"no" );
     fprintf( pAbc->Err, "\t-h     : prints the command summary\n" );
     fprintf( pAbc->Err, "\tfile   : the name of a file to read\n" );
     return 1;
@@ -3518,16 +3582,33 @@ usage:
 int IoCommandWriteEdgelist( Abc_Frame_t * pAbc, int argc, char **argv )
 {
     char * pFileName;
-    int c, fSpecial = 0;
+    int c, fSpecial = 0, fBinary = 0, nShardSize = 0, fVerbose = 0;
 
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "Nh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "SNbvh" ) ) != EOF )
     {
         switch ( c )
         {
+            case 'S':
+                if ( globalUtilOptind >= argc )
+                {
+                    fprintf( pAbc->Err, "Command line switch \"-S\" should be followed by an integer.\n" );
+                    goto usage;
+                }
+                nShardSize = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if ( nShardSize < 0 )
+                    goto usage;
+                break;
             case 'N':
                 fSpecial ^= 1;
                 break;
+            case 'b':
+                fBinary ^= 1;
+                break;
+            case 'v':
+                fVerbose ^= 1;
+                break;
             /*
             case 'a':
                 fUseHie ^= 1;
@@ -3549,17 +3630,22 @@ int IoCommandWriteEdgelist( Abc_Frame_t * pAbc, int argc, char **argv )
     // get the output file name
     pFileName = argv[globalUtilOptind];
     // call the corresponding file writer
-    if ( fSpecial ) // keep original naming
+    if ( fBinary )
+        Io_WriteEdgelistBinary( pAbc->pNtkCur, pFileName, nShardSize, fVerbose );
+    else if ( fSpecial ) // keep original naming
         Io_WriteEdgelist( pAbc->pNtkCur, pFileName, 1, 0, 0, fSpecial); //last option is fName
     else
         Io_WriteEdgelist( pAbc->pNtkCur, pFileName, 1, 0, 0, fSpecial); //last option is fName
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: write_edgelist [-N] <file>\n" );
+    fprintf( pAbc->Err, "usage: write_edgelist [-S num] [-Nbv] <file>\n" );
     fprintf( pAbc->Err, "\t         writes the network into edgelist file\n" );
     fprintf( pAbc->Err, "\t         part of Verilog-2-PyG (PyTorch Geometric). more details https://github.com/ycunxi/Verilog-to-PyG \n" );
+    fprintf( pAbc->Err, "\t-S num : the number of objects in one shard of the binary file (0 = no shards) [default = %d]\n", nShardSize );
     fprintf( pAbc->Err, "\t-N     : toggle keeping original naming of the netlist in edgelist (default=False)\n");  
+    fprintf( pAbc->Err, "\t-b     : toggle writing int32 arrays of edges (COO and CSR) and node features [default = %s]\n", fBinary? "yes": "no" );
+    fprintf( pAbc->Err, "\t-v     : toggle printing verbose information [default = %s]\n", fVerbose? "yes": "no" );
     fprintf( pAbc->Err, "\t-h     : print the help massage\n" );
     fprintf( pAbc->Err, "\tfile   : the name of the file to write (extension .el)\n" );
     return 1;
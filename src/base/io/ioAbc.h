@@ -95,6 +95,8 @@ extern void               Io_ReadBenchInit( Abc_Ntk_t * pNtk, char * pFileName )
 extern Abc_Ntk_t *        Io_ReadEdif( char * pFileName, int fCheck );
 /*=== abcReadEqn.c ============================================================*/
 extern Abc_Ntk_t *        Io_ReadEqn( char * pFileName, int fCheck );
+/*=== abcReadPar.c ============================================================*/
+extern Abc_Ntk_t *        Io_ReadPar( char * pFileName, Io_FileType_t FileType, int nProcs, int fCheck );
 /*=== abcReadPla.c ============================================================*/
 extern Abc_Ntk_t *        Io_ReadPla( char * pFileName, int fZeros, int fBoth, int fOnDc, int fSkipPrepro, int fCheck );
 /*=== abcReadVerilog.c ========================================================*/
@@ -128,6 +130,7 @@ extern void               Io_WriteDotSeq( Abc_Ntk_t * pNtk, Vec_Ptr_t * vNodes,
 extern void               Io_WriteEqn( Abc_Ntk_t * pNtk, char * pFileName );
 /*=== abcWriteEdgelist.c ===========================================================*/
 extern void               Io_WriteEdgelist( Abc_Ntk_t * pNtk, char * pFileName, int fWriteLatches, int fBb2Wb, int fSeq , int fName);
+extern void               Io_WriteEdgelistBinary( Abc_Ntk_t * pNtk, char * pFileName, int nShardSize, int fVerbose );
 /*=== abcWriteGml.c ===========================================================*/
 extern void               Io_WriteGml( Abc_Ntk_t * pNtk, char * pFileName );
 /*=== abcWriteHMetis.c ===========================================================*/
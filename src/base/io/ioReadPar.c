@@ -0,0 +1,1091 @@
+/**CFile****************************************************************
+
+  FileName    [ioReadPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Command processing package.]
+
+  Synopsis    [Reading flat BLIF and BENCH files using several threads.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: ioReadPar.c,v 1.00 2026/10/18 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "ioAbc.h"
+#include "bool/kit/kit.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the smallest chunk of the file given to a thread
+#define IO_PAR_CHUNK_MIN  (1 << 20)
+
+// the types of records
+typedef enum {
+    IO_PAR_INPUT = 0,   // 0:  primary inputs (names)
+    IO_PAR_OUTPUT,      // 1:  primary outputs (names)
+    IO_PAR_LATCH,       // 2:  latch (input name, output name)
+    IO_PAR_NODE,        // 3:  node (fanin names, output name)
+    IO_PAR_MODEL,       // 4:  model (name)
+    IO_PAR_END          // 5:  end of the model
+} Io_ParType_t;
+
+// each record is (type, line, first token, token count, value), where the value
+// is the initial state of the latch or the number of the SOP of the node
+#define IO_PAR_REC  5
+
+typedef struct Io_ParJob_t_ Io_ParJob_t;  // one chunk of the file
+struct Io_ParJob_t_
+{
+    char *               pBuffer;      // the file buffer (shared)
+    int                  iBeg;         // the first character of the chunk
+    int                  iEnd;         // the first character of the next chunk
+    int                  fBench;       // the file is in BENCH format
+    int                  nLines;       // the number of lines in the chunk
+    int                  iLineBase;    // the number of lines before the chunk
+    Vec_Int_t *          vRecs;        // the records
+    Vec_Int_t *          vTokens;      // the offsets of the tokens in the buffer
+    Vec_Int_t *          vHashes;      // the hash keys of the tokens
+    Vec_Ptr_t *          vFuncs;       // the SOPs of the nodes
+    Mem_Flex_t *         pMem;         // the memory for the SOPs
+    Vec_Str_t *          vCube;        // temporary SOP
+    Vec_Int_t *          vCover;       // temporary ISOP
+    int                  fLuts;        // the chunk contains LUTs given by minterms
+    int                  fUnsupp;      // the chunk contains unsupported constructs
+    int                  iLineError;   // the line of the error in the chunk (-1 if none)
+    char                 sError[512];  // the error string
+};
+
+typedef struct Io_ParMan_t_ Io_ParMan_t;  // the reading manager
+struct Io_ParMan_t_
+{
+    char *               pFileName;    // the name of the file
+    char *               pBuffer;      // the file buffer
+    int                  nBuffer;      // the size of the buffer
+    int                  fBench;       // the file is in BENCH format
+    Vec_Ptr_t *          vJobs;        // the chunks
+    Abc_Ntk_t *          pNtk;         // the network under construction
+    int                  fUnsupp;      // the file should be read by the other reader
+    // mapping of names into the drivers
+    int *                pTableObj;    // the IDs of the drivers (-1 if the slot is empty)
+    int *                pTableTok;    // the offsets of the names in the buffer
+    unsigned *           pTableKey;    // the hash keys of the names
+    int                  nTableMask;   // the table size minus one
+    int                  nTableUsed;   // the number of entries
+    Vec_Ptr_t *          vUndriven;    // the names without drivers
+};
+
+static int               Io_ParCharIsSpace( char s ) { return s == ' ' || s == '\t' || s == '\r'; }
+static int               Io_ParCharIsDelim( char s ) { return s == ' ' || s == '\t' || s == '\r' || s == ',' || s == '(' || s == ')' || s == '='; }
+
+static inline int *      Io_ParJobRec( Io_ParJob_t * p, int i )   { return Vec_IntEntryP( p->vRecs, IO_PAR_REC * i );       }
+static inline int        Io_ParJobRecNum( Io_ParJob_t * p )       { return Vec_IntSize( p->vRecs ) / IO_PAR_REC;            }
+static inline char *     Io_ParJobToken( Io_ParJob_t * p, int i ) { return p->pBuffer + Vec_IntEntry( p->vTokens, i );      }
+static inline unsigned   Io_ParJobKey( Io_ParJob_t * p, int i )   { return (unsigned)Vec_IntEntry( p->vHashes, i );         }
+
+#define Io_ParManForEachJob( p, pJob, i )                                               \
+    Vec_PtrForEachEntry( Io_ParJob_t *, p->vJobs, pJob, i )
+#define Io_ParJobForEachRec( pJob, pRec, i )                                            \
+    for ( i = 0; (i < Io_ParJobRecNum(pJob)) && (((pRec) = Io_ParJobRec(pJob, i)), 1); i++ )
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Hashing for character strings.]
+
+  Description [The full key is computed by the threads and stored with
+  the token, so that the table can be resized without rehashing.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static unsigned Io_ParHashString( char * pName )
+{
+    unsigned Key = 0;
+    for ( ; *pName; pName++ )
+        Key = Key * 31 + (unsigned char)*pName;
+    Key ^= Key >> 16;
+    Key *= 0x85EBCA6B;
+    Key ^= Key >> 13;
+    return Key;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the file into the buffer.]
+
+  Description [The buffer is tokenized in place by the threads. For BLIF,
+  the spare .end line is appended, as in the other BLIF readers. Sets
+  *pfLarge and returns NULL if the file does not fit the int offsets.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Io_ParLoadFile( char * pFileName, int fBench, int * pnBuffer, int * pfLarge )
+{
+    FILE * pFile;
+    long nFileSize;
+    char * pContents;
+    int RetValue;
+    *pfLarge = 0;
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+    {
+        printf( "Io_ParLoadFile(): The file is unavailable (absent or open).\n" );
+        return NULL;
+    }
+    fseek( pFile, 0, SEEK_END );
+    nFileSize = ftell( pFile );
+    if ( nFileSize < 0 || nFileSize > 0x7FFFFF00 )
+    {
+        // the chunks are indexed by int, so larger files go to the regular reader
+        fclose( pFile );
+        *pfLarge = 1;
+        return NULL;
+    }
+    if ( nFileSize == 0 )
+    {
+        fclose( pFile );
+        printf( "Io_ParLoadFile(): The file is empty.\n" );
+        return NULL;
+    }
+    pContents = ABC_ALLOC( char, nFileSize + 10 );
+    rewind( pFile );
+    RetValue = fread( pContents, nFileSize, 1, pFile );
+    fclose( pFile );
+    strcpy( pContents + nFileSize, fBench ? "\n" : "\n.end\n" );
+    *pnBuffer = (int)nFileSize + (int)strlen( pContents + nFileSize );
+    return pContents;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds the beginning of the chunk at or after the position.]
+
+  Description [The chunk of a BENCH file begins with any line. The chunk
+  of a BLIF file begins with a directive, which does not continue the
+  previous line, so that the tables are not split between the chunks.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_ParFindChunkStart( char * pBuffer, int nBuffer, int iPos, int fBench )
+{
+    char * pPrev;
+    for ( ; iPos < nBuffer; iPos++ )
+    {
+        if ( pBuffer[iPos-1] != '\n' )
+            continue;
+        if ( fBench )
+            return iPos;
+        if ( pBuffer[iPos] != '.' )
+            continue;
+        for ( pPrev = pBuffer + iPos - 2; pPrev >= pBuffer && Io_ParCharIsSpace(*pPrev); pPrev-- );
+        if ( pPrev < pBuffer || *pPrev != '\\' )
+            return iPos;
+    }
+    return nBuffer;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Splits one line of the chunk into tokens.]
+
+  Description [Appends the offsets of the tokens to vTokens and writes
+  zeros after the tokens. Skips the comments. In BLIF, the backslash at
+  the end of the line continues the line. Returns the beginning of the
+  next line.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Io_ParReadLine( Io_ParJob_t * p, char * pCur, char * pEnd )
+{
+    char * pTemp;
+    int fToken = 0;
+    for ( ; pCur < pEnd; pCur++ )
+    {
+        if ( *pCur == '#' )
+        {
+            while ( pCur < pEnd && *pCur != '\n' )
+                *pCur++ = 0;
+            if ( pCur == pEnd )
+                break;
+        }
+        if ( *pCur == '\n' )
+        {
+            *pCur = 0;
+            p->nLines++;
+            return pCur + 1;
+        }
+        if ( !p->fBench && *pCur == '\\' )
+        {
+            for ( pTemp = pCur + 1; pTemp < pEnd && Io_ParCharIsSpace(*pTemp); pTemp++ );
+            if ( pTemp < pEnd && *pTemp == '\n' )
+            {
+                *pCur = *pTemp = 0;
+                pCur = pTemp;
+                p->nLines++;
+                fToken = 0;
+                continue;
+            }
+        }
+        if ( p->fBench ? Io_ParCharIsDelim(*pCur) : Io_ParCharIsSpace(*pCur) )
+        {
+            *pCur = 0;
+            fToken = 0;
+            continue;
+        }
+        if ( !fToken )
+            Vec_IntPush( p->vTokens, (int)(pCur - p->pBuffer) );
+        fToken = 1;
+    }
+    return pCur;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds one record to the chunk.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Io_ParPushRec( Io_ParJob_t * p, int Type, int iLine, int iToken, int nTokens, int Value )
+{
+    Vec_IntPush( p->vRecs, Type );
+    Vec_IntPush( p->vRecs, iLine );
+    Vec_IntPush( p->vRecs, iToken );
+    Vec_IntPush( p->vRecs, nTokens );
+    Vec_IntPush( p->vRecs, Value );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the SOP of the table of the last node of the chunk.]
+
+  Description [The cubes of the table are the tokens from iStart to
+  iStop. The checks are the same as in the BLIF-MV reader.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_ParFinishTable( Io_ParJob_t * p, int iStart, int iStop )
+{
+    int * pRec = Io_ParJobRec( p, Io_ParJobRecNum(p) - 1 );
+    int i, nFanins = pRec[3] - 1, nTokens = iStop - iStart, Polarity = -1;
+    char * pProduct, * pOutput, * pSop = NULL, c;
+    assert( pRec[0] == IO_PAR_NODE && pRec[4] == Vec_PtrSize(p->vFuncs) );
+    p->iLineError = pRec[1];
+    if ( nTokens == 0 )
+        pSop = Abc_SopCreateConst0( p->pMem );
+    else if ( nTokens == 1 )
+    {
+        pOutput = Io_ParJobToken( p, iStart );
+        c = pOutput[0];
+        if ( (c!='0'&&c!='1'&&c!='x'&&c!='n') || pOutput[1] )
+        {
+            sprintf( p->sError, "Constant table has wrong output value \"%s\".", pOutput );
+            return 0;
+        }
+        pSop = c == '0' ? Abc_SopCreateConst0( p->pMem ) : Abc_SopCreateConst1( p->pMem );
+    }
+    else if ( nTokens % 2 == 1 )
+    {
+        sprintf( p->sError, "Table has odd number of tokens (%d).", nTokens );
+        return 0;
+    }
+    else
+    {
+        Vec_StrClear( p->vCube );
+        for ( i = 0; i < nTokens/2; i++ )
+        {
+            pProduct = Io_ParJobToken( p, iStart + 2*i + 0 );
+            pOutput  = Io_ParJobToken( p, iStart + 2*i + 1 );
+            if ( strlen(pProduct) != (unsigned)nFanins )
+            {
+                sprintf( p->sError, "Cube \"%s\" has size different from the fanin count (%d).", pProduct, nFanins );
+                return 0;
+            }
+            c = pOutput[0];
+            if ( (c!='0'&&c!='1'&&c!='x'&&c!='n') || pOutput[1] )
+            {
+                sprintf( p->sError, "Output value \"%s\" is incorrect.", pOutput );
+                return 0;
+            }
+            if ( Polarity == -1 )
+                Polarity = (c=='1' || c=='x');
+            else if ( Polarity != (c=='1' || c=='x') )
+            {
+                sprintf( p->sError, "Output value \"%s\" differs from the value in the first line of the table (%d).", pOutput, Polarity );
+                return 0;
+            }
+            Vec_StrPrintStr( p->vCube, pProduct );
+            Vec_StrPush( p->vCube, ' ' );
+            Vec_StrPush( p->vCube, c );
+            Vec_StrPush( p->vCube, '\n' );
+        }
+        Vec_StrPush( p->vCube, '\0' );
+        pSop = Abc_SopRegister( p->pMem, Vec_StrArray(p->vCube) );
+    }
+    Vec_PtrPush( p->vFuncs, pSop );
+    p->iLineError = -1;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses one chunk of the BLIF file.]
+
+  Description [The directives remain in vTokens before the tokens of
+  the records. The cubes of the table are kept after the tokens of the
+  node until the next directive. Returns 0 if the chunk has an error.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_ParParseBlif( Io_ParJob_t * p )
+{
+    char * pCur = p->pBuffer + p->iBeg, * pEnd = p->pBuffer + p->iEnd;
+    char * pDir;
+    int iLine, iStart, nTokens, Init, iTable = -1;
+    char * pInit;
+    while ( pCur < pEnd )
+    {
+        iLine   = p->nLines;
+        iStart  = Vec_IntSize( p->vTokens );
+        pCur    = Io_ParReadLine( p, pCur, pEnd );
+        nTokens = Vec_IntSize( p->vTokens ) - iStart;
+        if ( nTokens == 0 )
+            continue;
+        pDir = Io_ParJobToken( p, iStart );
+        if ( pDir[0] != '.' )
+        {
+            // the lines of the table are processed at the next directive
+            if ( iTable == -1 )
+                return (p->fUnsupp = 1);
+            continue;
+        }
+        if ( iTable >= 0 )
+        {
+            // complete the table and move the tokens of this line in its place
+            if ( !Io_ParFinishTable( p, iTable, iStart ) )
+                return 0;
+            memmove( Vec_IntArray(p->vTokens) + iTable, Vec_IntArray(p->vTokens) + iStart, sizeof(int) * nTokens );
+            Vec_IntShrink( p->vTokens, iTable + nTokens );
+            iStart = iTable;
+            iTable = -1;
+        }
+        pDir++;
+        if ( !strcmp(pDir, "names") )
+        {
+            if ( nTokens < 2 )
+            {
+                sprintf( p->sError, "The .names line does not have the output name." );
+                p->iLineError = iLine;
+                return 0;
+            }
+            Io_ParPushRec( p, IO_PAR_NODE, iLine, iStart + 1, nTokens - 1, Vec_PtrSize(p->vFuncs) );
+            iTable = iStart + nTokens;
+        }
+        else if ( !strcmp(pDir, "latch") )
+        {
+            if ( nTokens < 3 )
+            {
+                sprintf( p->sError, "Latch does not have input name and output name." );
+                p->iLineError = iLine;
+                return 0;
+            }
+            // the initial value is the last token of ".latch <in> <out> [<type> <control>] [<init>]";
+            // with four names, the last two are the type and the control without the initial value
+            pInit = nTokens > 3 ? Io_ParJobToken(p, iStart + nTokens - 1) : NULL;
+            if ( pInit && nTokens == 5 && (pInit[0] < '0' || pInit[0] > '9') )
+                pInit = NULL;
+            Init = pInit ? atoi( pInit ) : 2;
+            if ( Init < 0 || Init > 3 || (pInit && (pInit[0] < '0' || pInit[0] > '9')) )
+            {
+                sprintf( p->sError, "Initial state of the latch is incorrect \"%s\".", pInit );
+                p->iLineError = iLine;
+                return 0;
+            }
+            Io_ParPushRec( p, IO_PAR_LATCH, iLine, iStart + 1, 2, Init == 0 ? ABC_INIT_ZERO : (Init == 1 ? ABC_INIT_ONE : ABC_INIT_DC) );
+        }
+        else if ( !strcmp(pDir, "inputs") )
+            Io_ParPushRec( p, IO_PAR_INPUT, iLine, iStart + 1, nTokens - 1, 0 );
+        else if ( !strcmp(pDir, "outputs") )
+            Io_ParPushRec( p, IO_PAR_OUTPUT, iLine, iStart + 1, nTokens - 1, 0 );
+        else if ( !strcmp(pDir, "model") )
+            Io_ParPushRec( p, IO_PAR_MODEL, iLine, iStart + 1, nTokens - 1, 0 );
+        else if ( !strcmp(pDir, "end") )
+            Io_ParPushRec( p, IO_PAR_END, iLine, iStart + 1, 0, 0 );
+        else
+            return (p->fUnsupp = 1);
+    }
+    if ( iTable >= 0 && !Io_ParFinishTable( p, iTable, Vec_IntSize(p->vTokens) ) )
+        return 0;
+    if ( iTable >= 0 )
+        Vec_IntShrink( p->vTokens, iTable );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the SOP of the BENCH gate.]
+
+  Description [The gate types and the error messages are the same as
+  in the BENCH reader. Unlike the BENCH reader, which collapses the
+  minterms of the LUTs using BDDs after reading, the LUTs are given by
+  their ISOPs computed here. The minterms are used only if the ISOP
+  computation exceeds its memory limit.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Io_ParDeriveSopBench( Io_ParJob_t * p, char * pType, char * pString, int nNames )
+{
+    unsigned uTruth[2048];
+    char * pSop;
+    int nDigits, RetValue;
+    if ( pString == NULL )
+    {
+        if ( strcmp(pType, "AND") == 0 || strcmp(pType, "and") == 0 )
+            return Abc_SopCreateAnd( p->pMem, nNames, NULL );
+        if ( strcmp(pType, "OR") == 0 || strcmp(pType, "or") == 0 )
+            return Abc_SopCreateOr( p->pMem, nNames, NULL );
+        if ( strcmp(pType, "NAND") == 0 || strcmp(pType, "nand") == 0 )
+            return Abc_SopCreateNand( p->pMem, nNames );
+        if ( strcmp(pType, "NOR") == 0 || strcmp(pType, "nor") == 0 )
+            return Abc_SopCreateNor( p->pMem, nNames );
+        if ( strcmp(pType, "XOR") == 0 || strcmp(pType, "xor") == 0 )
+            return Abc_SopCreateXor( p->pMem, nNames );
+        if ( strcmp(pType, "NXOR") == 0 || strcmp(pType, "XNOR") == 0 || strcmp(pType, "nxor") == 0 || strcmp(pType, "xnor") == 0 )
+            return Abc_SopCreateNxor( p->pMem, nNames );
+        if ( strncmp(pType, "BUF", 3) == 0 || strcmp(pType, "buf") == 0 )
+            return Abc_SopCreateBuf( p->pMem );
+        if ( strcmp(pType, "NOT") == 0 || strcmp(pType, "not") == 0 )
+            return Abc_SopCreateInv( p->pMem );
+        if ( strncmp(pType, "MUX", 3) == 0 || strcmp(pType, "mux") == 0 )
+            return Abc_SopRegister( p->pMem, "0-1 1\n11- 1\n" );
+        if ( strncmp(pType, "gnd", 3) == 0 )
+            return Abc_SopRegister( p->pMem, " 0\n" );
+        if ( strncmp(pType, "vdd", 3) == 0 )
+            return Abc_SopRegister( p->pMem, " 1\n" );
+        sprintf( p->sError, "Cannot determine gate type \"%s\".", pType );
+        return NULL;
+    }
+    // the LUT is given by the hexadecimal truth table
+    if ( nNames > 15 )
+    {
+        sprintf( p->sError, "Currently cannot read truth tables with more than 15 inputs (%d).", nNames );
+        return NULL;
+    }
+    if ( strncmp( pString, "0x", 2 ) )
+    {
+        sprintf( p->sError, "The LUT signature (%s) does not look like a hexadecimal beginning with \"0x\".", pString );
+        return NULL;
+    }
+    pString += 2;
+    // pad the string with zero's if needed
+    nDigits = Abc_MaxInt( (1 << nNames) / 4, 1 );
+    if ( strlen(pString) < (unsigned)nDigits )
+    {
+        Vec_StrFill( p->vCube, nDigits - strlen(pString), '0' );
+        Vec_StrPrintStr( p->vCube, pString );
+        Vec_StrPush( p->vCube, 0 );
+        pString = Vec_StrArray( p->vCube );
+    }
+    if ( !Extra_ReadHexadecimal( uTruth, pString, nNames ) )
+    {
+        sprintf( p->sError, "Reading hexadecimal number (%s) has failed.", pString );
+        return NULL;
+    }
+    if ( Extra_TruthIsConst0(uTruth, nNames) )
+        return Abc_SopRegister( p->pMem, " 0\n" );
+    if ( Extra_TruthIsConst1(uTruth, nNames) )
+        return Abc_SopRegister( p->pMem, " 1\n" );
+    if ( nNames > 1 )
+    {
+        // the truth tables of less than five variables are replicated in the word
+        for ( nDigits = (1 << nNames); nDigits < 32; nDigits <<= 1 )
+            uTruth[0] = (uTruth[0] & ~(~0U << nDigits)) | (uTruth[0] << nDigits);
+        RetValue = Kit_TruthIsop( uTruth, nNames, p->vCover, 1 );
+        if ( RetValue == -1 )
+        {
+            p->fLuts = 1;
+            return Abc_SopCreateFromTruth( p->pMem, nNames, uTruth );
+        }
+        pSop = Abc_SopCreateFromIsop( p->pMem, nNames, p->vCover );
+        if ( RetValue )
+            Abc_SopComplement( pSop );
+        return pSop;
+    }
+    if ( pString[0] == '2' )
+        return Abc_SopCreateBuf( p->pMem );
+    if ( pString[0] == '1' )
+        return Abc_SopCreateInv( p->pMem );
+    sprintf( p->sError, "Reading truth table (%s) of single-input node has failed.", pString );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses one chunk of the BENCH file.]
+
+  Description [The tokens of the gate are reordered to have the fanins
+  followed by the output, as in BLIF. Constant gates have no fanins.
+  Returns 0 if the chunk has an error.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_ParParseBench( Io_ParJob_t * p )
+{
+    char * pCur = p->pBuffer + p->iBeg, * pEnd = p->pBuffer + p->iEnd;
+    char * pType, * pSop, * pString;
+    int * pTokens, iLine, iStart, nTokens, nNames, iOut, Init;
+    while ( pCur < pEnd )
+    {
+        iLine   = p->nLines;
+        iStart  = Vec_IntSize( p->vTokens );
+        pCur    = Io_ParReadLine( p, pCur, pEnd );
+        nTokens = Vec_IntSize( p->vTokens ) - iStart;
+        if ( nTokens == 0 )
+            continue;
+        p->iLineError = iLine;
+        if ( nTokens == 1 )
+        {
+            sprintf( p->sError, "Wrong input file format." );
+            return 0;
+        }
+        pTokens = Vec_IntArray( p->vTokens ) + iStart;
+        pType   = p->pBuffer + pTokens[0];
+        if ( strncmp( pType, "INPUT", 5 ) == 0 )
+            Io_ParPushRec( p, IO_PAR_INPUT, iLine, iStart + 1, 1, 0 );
+        else if ( strncmp( pType, "OUTPUT", 5 ) == 0 )
+            Io_ParPushRec( p, IO_PAR_OUTPUT, iLine, iStart + 1, 1, 0 );
+        else if ( strncmp( (pType = p->pBuffer + pTokens[1]), "DFF", 3 ) == 0 )
+        {
+            // flops with set/reset/enable are modeled by the constraints
+            if ( nTokens == 6 )
+                return (p->fUnsupp = 1);
+            if ( nTokens < 3 )
+            {
+                sprintf( p->sError, "Flop does not have the input name." );
+                return 0;
+            }
+            Init = pType[3] == '0' ? ABC_INIT_ZERO : (pType[3] == '1' ? ABC_INIT_ONE : ABC_INIT_DC);
+            iOut = pTokens[0];
+            pTokens[1] = pTokens[2];
+            pTokens[2] = iOut;
+            Io_ParPushRec( p, IO_PAR_LATCH, iLine, iStart + 1, 2, Init );
+        }
+        else
+        {
+            // move the output to the end
+            iOut = pTokens[0];
+            memmove( pTokens, pTokens + 1, sizeof(int) * (nTokens - 1) );
+            pTokens[nTokens - 1] = iOut;
+            pString = strcmp(pType, "LUT") == 0 ? p->pBuffer + pTokens[1] : NULL;
+            nNames  = pString ? nTokens - 3 : nTokens - 2;
+            pSop    = Io_ParDeriveSopBench( p, pType, pString, nNames );
+            if ( pSop == NULL )
+                return 0;
+            // constant LUTs have no fanins
+            if ( pString && (Abc_SopIsConst0(pSop) || Abc_SopIsConst1(pSop)) )
+                nNames = 0;
+            Io_ParPushRec( p, IO_PAR_NODE, iLine, iStart + nTokens - 1 - nNames, nNames + 1, Vec_PtrSize(p->vFuncs) );
+            Vec_PtrPush( p->vFuncs, pSop );
+        }
+    }
+    p->iLineError = -1;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses one chunk of the file and hashes the tokens.]
+
+  Description [This is the procedure run by the threads.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_ParJobRun( void * pArg )
+{
+    Io_ParJob_t * p = (Io_ParJob_t *)pArg;
+    int i, iToken;
+    if ( !(p->fBench ? Io_ParParseBench(p) : Io_ParParseBlif(p)) || p->fUnsupp )
+        return 1;
+    Vec_IntGrow( p->vHashes, Vec_IntSize(p->vTokens) );
+    Vec_IntForEachEntry( p->vTokens, iToken, i )
+        Vec_IntPush( p->vHashes, (int)Io_ParHashString(p->pBuffer + iToken) );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Allocates and frees the chunk.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Io_ParJob_t * Io_ParJobAlloc( Io_ParMan_t * pMan, int iBeg, int iEnd )
+{
+    Io_ParJob_t * p;
+    p = ABC_CALLOC( Io_ParJob_t, 1 );
+    p->pBuffer    = pMan->pBuffer;
+    p->iBeg       = iBeg;
+    p->iEnd       = iEnd;
+    p->fBench     = pMan->fBench;
+    p->vRecs      = Vec_IntAlloc( 1000 );
+    p->vTokens    = Vec_IntAlloc( (iEnd - iBeg) / 8 + 100 );
+    p->vHashes    = Vec_IntAlloc( 0 );
+    p->vFuncs     = Vec_PtrAlloc( 1000 );
+    p->pMem       = Mem_FlexStart();
+    p->vCube      = Vec_StrAlloc( 100 );
+    p->vCover     = Vec_IntAlloc( 0 );
+    p->iLineError = -1;
+    return p;
+}
+static void Io_ParJobFree( Io_ParJob_t * p )
+{
+    Vec_IntFree( p->vRecs );
+    Vec_IntFree( p->vTokens );
+    Vec_IntFree( p->vHashes );
+    Vec_PtrFree( p->vFuncs );
+    Mem_FlexStop( p->pMem, 0 );
+    Vec_StrFree( p->vCube );
+    Vec_IntFree( p->vCover );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds the slot of the name in the table.]
+
+  Description [Returns the slot with the name or the empty slot where
+  the name should be added.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_ParTableFind( Io_ParMan_t * p, char * pName, unsigned Key )
+{
+    int i;
+    for ( i = Key & p->nTableMask; p->pTableObj[i] >= 0; i = (i + 1) & p->nTableMask )
+        if ( p->pTableKey[i] == Key && !strcmp(p->pBuffer + p->pTableTok[i], pName) )
+            break;
+    return i;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Resizes the table.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Io_ParTableAlloc( Io_ParMan_t * p, int nSize )
+{
+    int nTableSize = 1 << Abc_Base2Log( 2 * nSize + 16 );
+    p->nTableMask = nTableSize - 1;
+    p->pTableObj  = ABC_FALLOC( int, nTableSize );
+    p->pTableTok  = ABC_ALLOC( int, nTableSize );
+    p->pTableKey  = ABC_ALLOC( unsigned, nTableSize );
+}
+static void Io_ParTableResize( Io_ParMan_t * p )
+{
+    int * pTableObj = p->pTableObj, * pTableTok = p->pTableTok;
+    unsigned * pTableKey = p->pTableKey;
+    int i, k, nTableSize = p->nTableMask + 1;
+    Io_ParTableAlloc( p, nTableSize );
+    for ( i = 0; i < nTableSize; i++ )
+    {
+        if ( pTableObj[i] < 0 )
+            continue;
+        for ( k = pTableKey[i] & p->nTableMask; p->pTableObj[k] >= 0; k = (k + 1) & p->nTableMask );
+        p->pTableObj[k] = pTableObj[i];
+        p->pTableTok[k] = pTableTok[i];
+        p->pTableKey[k] = pTableKey[i];
+    }
+    ABC_FREE( pTableObj );
+    ABC_FREE( pTableTok );
+    ABC_FREE( pTableKey );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the driver of the name to the table.]
+
+  Description [Returns 0 if the name already has a driver.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_ParTableAdd( Io_ParMan_t * p, int iToken, unsigned Key, int ObjId )
+{
+    int i = Io_ParTableFind( p, p->pBuffer + iToken, Key );
+    if ( p->pTableObj[i] >= 0 )
+        return 0;
+    p->pTableObj[i] = ObjId;
+    p->pTableTok[i] = iToken;
+    p->pTableKey[i] = Key;
+    if ( 2 * ++p->nTableUsed > p->nTableMask )
+        Io_ParTableResize( p );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the driver of the name.]
+
+  Description [If the name has no driver, adds the constant driver,
+  as it is done for the non-driven nets of the netlist.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Abc_Obj_t * Io_ParTableDriver( Io_ParMan_t * p, int iToken, unsigned Key )
+{
+    char * pName = p->pBuffer + iToken;
+    Abc_Obj_t * pObj;
+    int i = Io_ParTableFind( p, pName, Key ), fConst1, fSilent;
+    if ( p->pTableObj[i] >= 0 )
+        return Abc_NtkObj( p->pNtk, p->pTableObj[i] );
+    if ( p->fBench )
+    {
+        fConst1 = !strcmp(pName, "vdd") || !strcmp(pName, "2");
+        fSilent = !strcmp(pName, "vdd") || !strcmp(pName, "gnd");
+    }
+    else
+    {
+        fConst1 = !strcmp(pName, "1\'b1") || !strcmp(pName, "$true");
+        fSilent = fConst1 || !strcmp(pName, "1\'b0") || !strcmp(pName, "$false") || !strcmp(pName, "$undef");
+    }
+    pObj = fConst1 ? Abc_NtkCreateNodeConst1( p->pNtk ) : Abc_NtkCreateNodeConst0( p->pNtk );
+    Abc_ObjAssignName( pObj, pName, NULL );
+    Io_ParTableAdd( p, iToken, Key, Abc_ObjId(pObj) );
+    if ( !fSilent )
+        Vec_PtrPush( p->vUndriven, pName );
+    return pObj;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Constructs the logic network from the records of the chunks.]
+
+  Description [The objects are created in the order of the records:
+  the PIs, the POs, the latches, and the nodes. The names are resolved
+  using the hash keys computed by the threads. Returns NULL and sets
+  fUnsupp if the file should be read by the other reader.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Abc_Ntk_t * Io_ParConstruct( Io_ParMan_t * p )
+{
+    Io_ParJob_t * pJob;
+    Abc_Obj_t * pObj, * pLatch, * pTerm;
+    char * pName, * pModel = NULL;
+    int * pRec, i, k, n, iLine = 0, fEnd = 0, nModels = 0, iNode, iCo;
+    int nPis = 0, nPos = 0, nLatches = 0, nNodes = 0;
+    // check the errors and count the objects
+    Io_ParManForEachJob( p, pJob, i )
+    {
+        if ( pJob->iLineError >= 0 )
+        {
+            printf( "%s: Line %d: %s\n", p->pFileName, iLine + pJob->iLineError + 1, pJob->sError );
+            return NULL;
+        }
+        if ( pJob->fUnsupp )
+        {
+            p->fUnsupp = 1;
+            return NULL;
+        }
+        pJob->iLineBase = iLine;
+        iLine += pJob->nLines;
+        Io_ParJobForEachRec( pJob, pRec, k )
+        {
+            if ( fEnd && pRec[0] != IO_PAR_END )
+            {
+                p->fUnsupp = 1;
+                return NULL;
+            }
+            if ( pRec[0] == IO_PAR_INPUT )
+                nPis += pRec[3];
+            else if ( pRec[0] == IO_PAR_OUTPUT )
+                nPos += pRec[3];
+            else if ( pRec[0] == IO_PAR_LATCH )
+                nLatches++;
+            else if ( pRec[0] == IO_PAR_NODE )
+                nNodes++;
+            else if ( pRec[0] == IO_PAR_MODEL && nModels++ == 0 && pRec[3] > 0 )
+                pModel = Io_ParJobToken( pJob, pRec[2] );
+            else if ( pRec[0] == IO_PAR_END )
+                fEnd = 1;
+        }
+    }
+    // start the network with the name manager large enough for all names
+    p->pNtk = Abc_NtkAlloc( ABC_NTK_LOGIC, ABC_FUNC_SOP, 1 );
+    p->pNtk->pName = pModel ? Extra_UtilStrsav( pModel ) : Extra_FileNameGeneric( p->pFileName );
+    p->pNtk->pSpec = Extra_UtilStrsav( p->pFileName );
+    Nm_ManFree( p->pNtk->pManName );
+    p->pNtk->pManName = Nm_ManCreate( nPis + nPos + 3 * nLatches + nNodes + 200 );
+    Io_ParTableAlloc( p, nPis + nLatches + nNodes );
+    // create the PIs
+    Io_ParManForEachJob( p, pJob, i )
+    Io_ParJobForEachRec( pJob, pRec, k )
+    {
+        if ( pRec[0] != IO_PAR_INPUT )
+            continue;
+        for ( n = pRec[2]; n < pRec[2] + pRec[3]; n++ )
+        {
+            pObj = Abc_NtkCreatePi( p->pNtk );
+            Abc_ObjAssignName( pObj, Io_ParJobToken(pJob, n), NULL );
+            if ( !Io_ParTableAdd( p, Vec_IntEntry(pJob->vTokens, n), Io_ParJobKey(pJob, n), Abc_ObjId(pObj) ) )
+            {
+                printf( "%s: Line %d: Primary input \"%s\" is defined more than once.\n", p->pFileName, pJob->iLineBase + pRec[1] + 1, Io_ParJobToken(pJob, n) );
+                return NULL;
+            }
+        }
+    }
+    // create the POs
+    Io_ParManForEachJob( p, pJob, i )
+    Io_ParJobForEachRec( pJob, pRec, k )
+    {
+        if ( pRec[0] != IO_PAR_OUTPUT )
+            continue;
+        for ( n = pRec[2]; n < pRec[2] + pRec[3]; n++ )
+            Abc_ObjAssignName( Abc_NtkCreatePo(p->pNtk), Io_ParJobToken(pJob, n), NULL );
+    }
+    // create the latches
+    Io_ParManForEachJob( p, pJob, i )
+    Io_ParJobForEachRec( pJob, pRec, k )
+    {
+        if ( pRec[0] != IO_PAR_LATCH )
+            continue;
+        pName  = Io_ParJobToken( pJob, pRec[2] + 1 );
+        pTerm  = Abc_NtkCreateBi( p->pNtk );
+        Abc_ObjAssignName( pTerm, Io_ParJobToken(pJob, pRec[2]), NULL );
+        pLatch = Abc_NtkCreateLatch( p->pNtk );
+        pLatch->pData = (void *)(ABC_PTRINT_T)pRec[4];
+        Abc_ObjAssignName( pLatch, pName, "L" );
+        Abc_ObjAddFanin( pLatch, pTerm );
+        pTerm  = Abc_NtkCreateBo( p->pNtk );
+        Abc_ObjAssignName( pTerm, pName, NULL );
+        Abc_ObjAddFanin( pTerm, pLatch );
+        if ( !Io_ParTableAdd( p, Vec_IntEntry(pJob->vTokens, pRec[2] + 1), Io_ParJobKey(pJob, pRec[2] + 1), Abc_ObjId(pTerm) ) )
+        {
+            printf( "%s: Line %d: Signal \"%s\" is defined more than once.\n", p->pFileName, pJob->iLineBase + pRec[1] + 1, pName );
+            return NULL;
+        }
+    }
+    // create the nodes
+    iNode = Abc_NtkObjNumMax( p->pNtk );
+    Io_ParManForEachJob( p, pJob, i )
+    Io_ParJobForEachRec( pJob, pRec, k )
+    {
+        if ( pRec[0] != IO_PAR_NODE )
+            continue;
+        n = pRec[2] + pRec[3] - 1;
+        pObj = Abc_NtkCreateNode( p->pNtk );
+        pObj->pData = Abc_SopRegister( (Mem_Flex_t *)p->pNtk->pManFunc, (char *)Vec_PtrEntry(pJob->vFuncs, pRec[4]) );
+        Abc_ObjAssignName( pObj, Io_ParJobToken(pJob, n), NULL );
+        if ( !Io_ParTableAdd( p, Vec_IntEntry(pJob->vTokens, n), Io_ParJobKey(pJob, n), Abc_ObjId(pObj) ) )
+        {
+            printf( "%s: Line %d: Signal \"%s\" is defined more than once.\n", p->pFileName, pJob->iLineBase + pRec[1] + 1, Io_ParJobToken(pJob, n) );
+            return NULL;
+        }
+    }
+    // connect the nodes
+    Io_ParManForEachJob( p, pJob, i )
+    Io_ParJobForEachRec( pJob, pRec, k )
+    {
+        if ( pRec[0] != IO_PAR_NODE )
+            continue;
+        pObj = Abc_NtkObj( p->pNtk, iNode++ );
+        for ( n = pRec[2]; n < pRec[2] + pRec[3] - 1; n++ )
+            Abc_ObjAddFanin( pObj, Io_ParTableDriver(p, Vec_IntEntry(pJob->vTokens, n), Io_ParJobKey(pJob, n)) );
+    }
+    // connect the POs and the latch inputs
+    iCo = 0;
+    Io_ParManForEachJob( p, pJob, i )
+    Io_ParJobForEachRec( pJob, pRec, k )
+    {
+        if ( pRec[0] != IO_PAR_OUTPUT )
+            continue;
+        for ( n = pRec[2]; n < pRec[2] + pRec[3]; n++ )
+            Abc_ObjAddFanin( Abc_NtkCo(p->pNtk, iCo++), Io_ParTableDriver(p, Vec_IntEntry(pJob->vTokens, n), Io_ParJobKey(pJob, n)) );
+    }
+    Io_ParManForEachJob( p, pJob, i )
+    Io_ParJobForEachRec( pJob, pRec, k )
+        if ( pRec[0] == IO_PAR_LATCH )
+            Abc_ObjAddFanin( Abc_NtkCo(p->pNtk, iCo++), Io_ParTableDriver(p, Vec_IntEntry(pJob->vTokens, pRec[2]), Io_ParJobKey(pJob, pRec[2])) );
+    // print the warning
+    if ( Vec_PtrSize(p->vUndriven) > 0 )
+    {
+        printf( "Warning: Constant-0 drivers added to %d non-driven nets in network \"%s\":\n", Vec_PtrSize(p->vUndriven), p->pNtk->pName );
+        Vec_PtrForEachEntry( char *, p->vUndriven, pName, i )
+        {
+            printf( "%s%s", (i? ", ": ""), pName );
+            if ( i == 3 )
+            {
+                if ( Vec_PtrSize(p->vUndriven) > 3 )
+                    printf( " ..." );
+                break;
+            }
+        }
+        printf( "\n" );
+    }
+    // fix the problem with CO pointing directly to CIs
+    Abc_NtkLogicMakeSimpleCos( p->pNtk, 0 );
+    return p->pNtk;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the flat BLIF or BENCH file using several threads.]
+
+  Description [The file is loaded into memory and cut into chunks at the
+  line boundaries (for BLIF, at the directives). The threads tokenize
+  the chunks in place, recording the offsets of the names and their hash
+  keys in flat arrays, and derive the SOPs of the nodes. The logic
+  network is then constructed directly, without the intermediate netlist,
+  by resolving the names through one hash table. The files with the
+  constructs not supported here (hierarchy, mapped gates, EXDC, timing,
+  flops with set/reset/enable in BENCH), the compressed files, and the
+  files larger than 2GB are read by the regular reader.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Ntk_t * Io_ReadPar( char * pFileName, Io_FileType_t FileType, int nProcs, int fCheck )
+{
+    Io_ParMan_t * p;
+    Io_ParJob_t * pJob;
+    Abc_Ntk_t * pNtk;
+    int i, nJobs, iBeg, iEnd, fUnsupp, fLarge, fLuts = 0;
+    assert( FileType == IO_FILE_BLIF || FileType == IO_FILE_BENCH );
+    if ( !strncmp(pFileName+strlen(pFileName)-3,".gz",3) || !strncmp(pFileName+strlen(pFileName)-4,".bz2",4) )
+        return Io_Read( pFileName, FileType, fCheck, 0 );
+    // load the file
+    p = ABC_CALLOC( Io_ParMan_t, 1 );
+    p->pFileName = pFileName;
+    p->fBench    = (FileType == IO_FILE_BENCH);
+    p->pBuffer   = Io_ParLoadFile( pFileName, p->fBench, &p->nBuffer, &fLarge );
+    if ( p->pBuffer == NULL )
+    {
+        ABC_FREE( p );
+        return fLarge ? Io_Read( pFileName, FileType, fCheck, 0 ) : NULL;
+    }
+    p->vUndriven = Vec_PtrAlloc( 100 );
+    // cut the file into chunks and parse them
+    nJobs = Abc_MaxInt( 1, Abc_MinInt( 4 * nProcs, p->nBuffer / IO_PAR_CHUNK_MIN ) );
+    p->vJobs = Vec_PtrAlloc( nJobs );
+    for ( i = 0, iBeg = 0; i < nJobs && iBeg < p->nBuffer; i++, iBeg = iEnd )
+    {
+        iEnd = i == nJobs - 1 ? p->nBuffer : Io_ParFindChunkStart( p->pBuffer, p->nBuffer, Abc_MaxInt(iBeg + 1, (int)((ABC_INT64_T)p->nBuffer * (i + 1) / nJobs)), p->fBench );
+        Vec_PtrPush( p->vJobs, Io_ParJobAlloc(p, iBeg, iEnd) );
+    }
+    Util_ProcessThreads( Io_ParJobRun, p->vJobs, nProcs, 0, 0 );
+    // construct the network
+    pNtk = Io_ParConstruct( p );
+    if ( pNtk == NULL && p->pNtk )
+        Abc_NtkDelete( p->pNtk );
+    fUnsupp = p->fUnsupp;
+    Io_ParManForEachJob( p, pJob, i )
+    {
+        fLuts |= pJob->fLuts;
+        Io_ParJobFree( pJob );
+    }
+    Vec_PtrFree( p->vJobs );
+    Vec_PtrFree( p->vUndriven );
+    ABC_FREE( p->pTableObj );
+    ABC_FREE( p->pTableTok );
+    ABC_FREE( p->pTableKey );
+    ABC_FREE( p->pBuffer );
+    ABC_FREE( p );
+    if ( fUnsupp )
+        return Io_Read( pFileName, FileType, fCheck, 0 );
+    if ( pNtk == NULL )
+        return NULL;
+    // if LUTs are given by minterms, collapse them into cubes
+    if ( fLuts )
+    {
+        if ( !Abc_NtkToBdd(pNtk) || !Abc_NtkToSop(pNtk, -1, ABC_INFINITY) )
+        {
+            printf( "Io_ReadPar(): Converting LUTs to SOPs has failed.\n" );
+            Abc_NtkDelete( pNtk );
+            return NULL;
+        }
+    }
+    // make sure that everything is okay with the network structure
+    if ( fCheck && !Abc_NtkCheckRead( pNtk ) )
+    {
+        printf( "Io_ReadPar: The network check has failed.\n" );
+        Abc_NtkDelete( pNtk );
+        return NULL;
+    }
+    return pNtk;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
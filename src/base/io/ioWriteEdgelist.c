@@ -41,6 +41,10 @@ static void Io_NtkEdgelistWriteNodeFanins( FILE * pFile, Abc_Obj_t * pNode, int
 static int  Io_NtkEdgelistWriteNode( FILE * pFile, Abc_Obj_t * pNode, int Length, int fName);
 static void Io_NtkEdgelistWriteLatch( FILE * pFile, Abc_Obj_t * pLatch , int fName);
 
+#define IO_EDGELIST_MAGIC    0x4c454241  // "ABEL" in the little-endian byte order
+#define IO_EDGELIST_VERSION  1           // the version of the binary format
+#define IO_EDGELIST_HEADER   16          // the number of integers in the header
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -1243,6 +1247,176 @@ void Io_NtkEdgelistWriteModelIntStruct( FILE * pFile, Abc_Obj_t * pNode, Vec_Int
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Writes one shard of the binary edge list.]
+
+  Description [The shard contains the objects in the range [Beg, End)
+  and the fanin edges of these objects.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_WriteEdgelistBinaryShard( char * pFileName, Vec_Int_t * vRows, Vec_Int_t * vSrc, Vec_Int_t * vDst, Vec_Ptr_t * vFeats, int Beg, int End, int iShard, int nShards )
+{
+    FILE * pFile;
+    Vec_Int_t * vFeat;
+    int i, pHeader[IO_EDGELIST_HEADER] = {0};
+    int EdgeBeg = Vec_IntEntry( vRows, Beg );
+    int EdgeEnd = Vec_IntEntry( vRows, End );
+    pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Io_WriteEdgelistBinary(): Cannot open the output file \"%s\".\n", pFileName );
+        return 0;
+    }
+    pHeader[0] = IO_EDGELIST_MAGIC;
+    pHeader[1] = IO_EDGELIST_VERSION;
+    pHeader[2] = End - Beg;
+    pHeader[3] = EdgeEnd - EdgeBeg;
+    pHeader[4] = Vec_PtrSize(vFeats);
+    pHeader[5] = Beg;
+    pHeader[6] = iShard;
+    pHeader[7] = nShards;
+    pHeader[8] = Vec_IntSize(vRows) - 1;
+    pHeader[9] = Vec_IntSize(vSrc);
+    fwrite( pHeader, sizeof(int), IO_EDGELIST_HEADER, pFile );
+    // the edges in the COO format sorted by the fanout
+    fwrite( Vec_IntArray(vSrc) + EdgeBeg, sizeof(int), EdgeEnd - EdgeBeg, pFile );
+    fwrite( Vec_IntArray(vDst) + EdgeBeg, sizeof(int), EdgeEnd - EdgeBeg, pFile );
+    // the fanin offsets in the CSR format (the fanins are in the first array)
+    for ( i = Beg; i <= End; i++ )
+        Vec_IntAddToEntry( vRows, i, -EdgeBeg );
+    fwrite( Vec_IntArray(vRows) + Beg, sizeof(int), End - Beg + 1, pFile );
+    for ( i = Beg; i <= End; i++ )
+        Vec_IntAddToEntry( vRows, i, EdgeBeg );
+    // the features, one column at a time
+    Vec_PtrForEachEntry( Vec_Int_t *, vFeats, vFeat, i )
+        fwrite( Vec_IntArray(vFeat) + Beg, sizeof(int), End - Beg, pFile );
+    fclose( pFile );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the network as a binary edge list with node features.]
+
+  Description [The objects of the logic network or AIG are numbered 
+  consecutively in the order of their IDs. Each file starts with the 
+  header of IO_EDGELIST_HEADER 32-bit integers (magic number, version,
+  number of objects, number of edges, number of features, first object,
+  shard, number of shards, total objects, total edges), followed by the 
+  32-bit integer arrays: the fanin and fanout objects of the edges (COO,
+  sorted by the fanout), the fanin offsets of the objects (CSR with 
+  one more entry than objects), and the feature columns: object type
+  (Abc_ObjType_t), level, reverse level, fanout count, and the phase
+  (in the AIG, bit k is set if fanin k is complemented). The files can be mapped 
+  using numpy.memmap() with dtype int32. If nShardSize is positive, the 
+  objects are split into shards of this size, written into files with 
+  the shard number appended to the name.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Io_WriteEdgelistBinary( Abc_Ntk_t * pNtk, char * pFileName, int nShardSize, int fVerbose )
+{
+    Vec_Int_t * vMap, * vRows, * vSrc, * vDst, * vFeat;
+    Vec_Int_t * vType, * vLevel, * vLevelR, * vFanout, * vPhase;
+    Vec_Ptr_t * vFeats;
+    Abc_Obj_t * pObj, * pFanin;
+    char * pExt, Suffix[100];
+    int i, k, Phase, nObjs, nShards, RetValue = 1;
+    abctime clk = Abc_Clock();
+    if ( !Abc_NtkIsLogic(pNtk) && !Abc_NtkIsStrash(pNtk) )
+    {
+        printf( "Io_WriteEdgelistBinary(): Expecting a logic network or an AIG.\n" );
+        return;
+    }
+    // number the objects
+    vMap = Vec_IntStartFull( Abc_NtkObjNumMax(pNtk) );
+    nObjs = 0;
+    Abc_NtkForEachObj( pNtk, pObj, i )
+        Vec_IntWriteEntry( vMap, i, nObjs++ );
+    // compute the reverse levels (stored in the levels of the nodes)
+    vLevelR = Vec_IntAlloc( nObjs );
+    Abc_NtkLevelReverse( pNtk );
+    Abc_NtkForEachObj( pNtk, pObj, i )
+    {
+        int LevelR = Abc_ObjIsNode(pObj) ? (int)pObj->Level : 0;
+        if ( Abc_ObjIsCi(pObj) || Abc_ObjType(pObj) == ABC_OBJ_CONST1 )
+            Abc_ObjForEachFanout( pObj, pFanin, k )
+                if ( Abc_ObjIsNode(pFanin) )
+                    LevelR = Abc_MaxInt( LevelR, (int)pFanin->Level );
+        Vec_IntPush( vLevelR, LevelR );
+    }
+    Abc_NtkLevel( pNtk );
+    // collect the edges and the features in one pass
+    vRows   = Vec_IntAlloc( nObjs + 1 );
+    vSrc    = Vec_IntAlloc( 2 * nObjs );
+    vDst    = Vec_IntAlloc( 2 * nObjs );
+    vType   = Vec_IntAlloc( nObjs );
+    vLevel  = Vec_IntAlloc( nObjs );
+    vFanout = Vec_IntAlloc( nObjs );
+    vPhase  = Vec_IntAlloc( nObjs );
+    Abc_NtkForEachObj( pNtk, pObj, i )
+    {
+        Vec_IntPush( vRows, Vec_IntSize(vSrc) );
+        Phase = 0;
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+        {
+            Vec_IntPush( vSrc, Vec_IntEntry(vMap, Abc_ObjId(pFanin)) );
+            Vec_IntPush( vDst, Vec_IntEntry(vMap, i) );
+            if ( k < 2 && Abc_ObjFaninC(pObj, k) )
+                Phase |= 1 << k;
+        }
+        Vec_IntPush( vType,   Abc_ObjType(pObj) );
+        Vec_IntPush( vLevel,  Abc_ObjLevel(pObj) );
+        Vec_IntPush( vFanout, Abc_ObjFanoutNum(pObj) );
+        Vec_IntPush( vPhase,  Phase );
+    }
+    Vec_IntPush( vRows, Vec_IntSize(vSrc) );
+    vFeats = Vec_PtrAlloc( 5 );
+    Vec_PtrPush( vFeats, vType );
+    Vec_PtrPush( vFeats, vLevel );
+    Vec_PtrPush( vFeats, vLevelR );
+    Vec_PtrPush( vFeats, vFanout );
+    Vec_PtrPush( vFeats, vPhase );
+    // write the shards
+    if ( nShardSize <= 0 || nShardSize >= nObjs )
+        nShardSize = Abc_MaxInt( nObjs, 1 );
+    nShards = (nObjs + nShardSize - 1) / nShardSize;
+    if ( nShards <= 1 )
+        RetValue = Io_WriteEdgelistBinaryShard( pFileName, vRows, vSrc, vDst, vFeats, 0, nObjs, 0, 1 );
+    else
+    {
+        pExt = strrchr( pFileName, '.' );
+        for ( i = 0; RetValue && i < nShards; i++ )
+        {
+            snprintf( Suffix, 100, "_%d%s", i, pExt ? pExt : "" );
+            RetValue = Io_WriteEdgelistBinaryShard( Extra_FileNameGenericAppend(pFileName, Suffix), vRows, vSrc, vDst, vFeats, 
+                i * nShardSize, Abc_MinInt(nObjs, (i + 1) * nShardSize), i, nShards );
+        }
+    }
+    if ( fVerbose && RetValue )
+    {
+        printf( "Written %d objects, %d edges, and %d features into %d file%s.  ", 
+            nObjs, Vec_IntSize(vSrc), Vec_PtrSize(vFeats), nShards, nShards > 1 ? "s" : "" );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    Vec_PtrForEachEntry( Vec_Int_t *, vFeats, vFeat, i )
+        Vec_IntFree( vFeat );
+    Vec_PtrFree( vFeats );
+    Vec_IntFree( vRows );
+    Vec_IntFree( vSrc );
+    Vec_IntFree( vDst );
+    Vec_IntFree( vMap );
+}
+
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -266,6 +266,75 @@ void Abc_FrameDeallocate( Abc_Frame_t * p )
     s_GlobalFrame = NULL;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Allocates a frame for running scripts in a worker thread.]
+
+  Description [The frame has its own command table, aliases and current
+  networks, while the libraries are shared with the global frame.
+  The frame is in batch mode and does not update the command history.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Frame_t * Abc_FrameAllocateWorker()
+{
+    extern void Abc_Init( Abc_Frame_t * pAbc );
+    Abc_Frame_t * p = Abc_FrameAllocate();
+    p->fBatchMode = 1;
+    Cmd_Init( p );
+    Abc_Init( p );
+    if ( s_GlobalFrame )
+        Cmd_AliasCopy( p, s_GlobalFrame );
+    p->iStartHistory = Vec_PtrSize( p->aHistory );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Deallocates the frame of a worker thread.]
+
+  Description [Unlike Abc_FrameDeallocate(), does not touch the global
+  frame and the global managers.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_FrameDeallocateWorker( Abc_Frame_t * p )
+{
+    assert( p != s_GlobalFrame );
+    p->iStartHistory = Vec_PtrSize( p->aHistory );
+    Cmd_End( p );
+    Gia_ManStopP( &p->pGia );
+    Gia_ManStopP( &p->pGia2 );
+    Gia_ManStopP( &p->pGiaBest );
+    Gia_ManStopP( &p->pGiaBest2 );
+    Gia_ManStopP( &p->pGiaSaved );
+    if ( p->vAbcObjIds)  Vec_IntFree( p->vAbcObjIds );
+    if ( p->vCexVec   )  Vec_PtrFreeFree( p->vCexVec );
+    if ( p->vPoEquivs )  Vec_VecFree( (Vec_Vec_t *)p->vPoEquivs );
+    if ( p->vStatuses )  Vec_IntFree( p->vStatuses );
+    if ( p->pManDec   )  Dec_ManStop( (Dec_Man_t *)p->pManDec );
+    if ( p->vStore    )  Vec_PtrFree( p->vStore );
+    if ( p->pNtkBackup)  Abc_NtkDelete( p->pNtkBackup );
+    if ( p->vPlugInComBinPairs ) 
+    {
+        char * pTemp;
+        int i;
+        Vec_PtrForEachEntry( char *, p->vPlugInComBinPairs, pTemp, i )
+            ABC_FREE( pTemp );
+        Vec_PtrFree( p->vPlugInComBinPairs );
+    }
+    Abc_FrameDeleteAllNetworks( p );
+    ABC_FREE( p->pCex2 );
+    ABC_FREE( p->pCex );
+    ABC_FREE( p );
+}
+
 
 /**Function*************************************************************
 
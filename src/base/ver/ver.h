@@ -51,6 +51,7 @@ struct Ver_Man_t_
     int             fMapped;       // mapped verilog
     int             fUseMemMan;    // allocate memory manager in the networks
     int             fCheck;        // checks network for currectness
+    int             nProcs;        // the number of threads parsing the modules
     // input file stream
     char *          pFileName;
     Ver_Stream_t *  pReader;
@@ -60,7 +61,7 @@ struct Ver_Man_t_
     Abc_Des_t *     pDesign;
     st__table *      tName2Suffix;
     // error handling
-    FILE *          Output;
+    FILE *          Output;        // (NULL if the error is printed by the caller)
     int             fTopLevel;
     int             fError;
     char            sError[2000];
@@ -85,16 +86,22 @@ struct Ver_Man_t_
 ////////////////////////////////////////////////////////////////////////
 
 /*=== verCore.c ========================================================*/
+extern Ver_Man_t *    Ver_ParseStart( char * pFileName, Abc_Des_t * pGateLib, Ver_Stream_t * pReader );
+extern void           Ver_ParseStop( Ver_Man_t * p );
 extern Abc_Des_t *    Ver_ParseFile( char * pFileName, Abc_Des_t * pGateLib, int fCheck, int fUseMemMan );
+extern int            Ver_ParseModules( Ver_Man_t * pMan );
 extern void           Ver_ParsePrintErrorMessage( Ver_Man_t * p );
 /*=== verFormula.c ========================================================*/
 extern void *         Ver_FormulaParser( char * pFormula, void * pMan, Vec_Ptr_t * vNames, Vec_Ptr_t * vStackFn, Vec_Int_t * vStackOp, char * pErrorMessage );
 extern void *         Ver_FormulaReduction( char * pFormula, void * pMan, Vec_Ptr_t * vNames, char * pErrorMessage );
+/*=== verPar.c ========================================================*/
+extern int            Ver_ParseModulesPar( Ver_Man_t * pMan );
 /*=== verParse.c ========================================================*/
 extern int            Ver_ParseSkipComments( Ver_Man_t * p );
 extern char *         Ver_ParseGetName( Ver_Man_t * p );
 /*=== verStream.c ========================================================*/
 extern Ver_Stream_t * Ver_StreamAlloc( char * pFileName );
+extern Ver_Stream_t * Ver_StreamAllocRange( char * pFileName, iword iBeg, iword iEnd, int nLineBeg );
 extern void           Ver_StreamFree( Ver_Stream_t * p );
 extern char *         Ver_StreamGetFileName( Ver_Stream_t * p );
 extern int            Ver_StreamGetFileSize( Ver_Stream_t * p );
@@ -51,8 +51,6 @@ typedef enum {
     VER_GATE_NOT
 } Ver_GateType_t;
 
-static Ver_Man_t * Ver_ParseStart( char * pFileName, Abc_Des_t * pGateLib );
-static void Ver_ParseStop( Ver_Man_t * p );
 static void Ver_ParseFreeData( Ver_Man_t * p );
 static void Ver_ParseInternal( Ver_Man_t * p );
 static int  Ver_ParseModule( Ver_Man_t * p );
@@ -78,6 +76,7 @@ static inline int Ver_NtkIsDefined( Abc_Ntk_t * pNtkBox )  { assert( pNtkBox->pN
 static inline int Ver_ObjIsConnected( Abc_Obj_t * pObj )   { assert( Abc_ObjIsBox(pObj) ); return Abc_ObjFaninNum(pObj) || Abc_ObjFanoutNum(pObj); }
 
 int glo_fMapped = 0; // this is bad!
+int glo_nProcs  = 1; // the number of threads parsing the modules
 
 typedef struct Ver_Bundle_t_    Ver_Bundle_t;
 struct Ver_Bundle_t_
@@ -101,18 +100,15 @@ struct Ver_Bundle_t_
   SeeAlso     []
 
 ***********************************************************************/
-Ver_Man_t * Ver_ParseStart( char * pFileName, Abc_Des_t * pGateLib )
+Ver_Man_t * Ver_ParseStart( char * pFileName, Abc_Des_t * pGateLib, Ver_Stream_t * pReader )
 {
     Ver_Man_t * p;
+    if ( pReader == NULL )
+        return NULL;
     p = ABC_ALLOC( Ver_Man_t, 1 );
     memset( p, 0, sizeof(Ver_Man_t) );
     p->pFileName = pFileName;
-    p->pReader   = Ver_StreamAlloc( pFileName );
-    if ( p->pReader == NULL )
-    {
-        ABC_FREE( p );
-        return NULL;
-    }
+    p->pReader   = pReader;
     p->Output    = stdout;
     p->vNames    = Vec_PtrAlloc( 100 );
     p->vStackFn  = Vec_PtrAlloc( 100 );
@@ -167,10 +163,11 @@ Abc_Des_t * Ver_ParseFile( char * pFileName, Abc_Des_t * pGateLib, int fCheck, i
     Ver_Man_t * p;
     Abc_Des_t * pDesign;
     // start the parser
-    p = Ver_ParseStart( pFileName, pGateLib );
+    p = Ver_ParseStart( pFileName, pGateLib, Ver_StreamAlloc(pFileName) );
     p->fMapped    = glo_fMapped;
     p->fCheck     = fCheck;
     p->fUseMemMan = fUseMemMan;
+    p->nProcs     = glo_nProcs;
     if ( glo_fMapped )
     {
         Hop_ManStop((Hop_Man_t *)p->pDesign->pManFunc);
@@ -200,29 +197,15 @@ Abc_Des_t * Ver_ParseFile( char * pFileName, Abc_Des_t * pGateLib, int fCheck, i
 void Ver_ParseInternal( Ver_Man_t * pMan )
 {
     Abc_Ntk_t * pNtk;
-    char * pToken;
-    int i;
-
-    // preparse the modeles
-    pMan->pProgress = Extra_ProgressBarStart( stdout, Ver_StreamGetFileSize(pMan->pReader) );
-    while ( 1 )
-    {
-        // get the next token
-        pToken = Ver_ParseGetName( pMan );
-        if ( pToken == NULL )
-            break;
-        if ( strcmp( pToken, "module" ) )
-        {
-            sprintf( pMan->sError, "Cannot read \"module\" directive." );
-            Ver_ParsePrintErrorMessage( pMan );
-            return;
-        }
-        // parse the module
-        if ( !Ver_ParseModule(pMan) )
-            return;
-    }
-    Extra_ProgressBarStop( pMan->pProgress );
-    pMan->pProgress = NULL;
+    int i, RetValue = -1;
+
+    // parse the modules
+    if ( pMan->nProcs > 1 )
+        RetValue = Ver_ParseModulesPar( pMan );
+    if ( RetValue == -1 )
+        RetValue = Ver_ParseModules( pMan );
+    if ( RetValue == 0 )
+        return;
 
     // process defined and undefined boxes
     if ( !Ver_ParseAttachBoxes( pMan ) )
@@ -244,6 +227,44 @@ void Ver_ParseInternal( Ver_Man_t * pMan )
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Parses the modules of the file.]
+
+  Description [Returns 0 if there was an error.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Ver_ParseModules( Ver_Man_t * pMan )
+{
+    char * pToken;
+    // preparse the modeles (the progress is not shown by the parallel jobs)
+    if ( pMan->Output )
+        pMan->pProgress = Extra_ProgressBarStart( stdout, Ver_StreamGetFileSize(pMan->pReader) );
+    while ( 1 )
+    {
+        // get the next token
+        pToken = Ver_ParseGetName( pMan );
+        if ( pToken == NULL )
+            break;
+        if ( strcmp( pToken, "module" ) )
+        {
+            sprintf( pMan->sError, "Cannot read \"module\" directive." );
+            Ver_ParsePrintErrorMessage( pMan );
+            return 0;
+        }
+        // parse the module
+        if ( !Ver_ParseModule(pMan) )
+            return 0;
+    }
+    Extra_ProgressBarStop( pMan->pProgress );
+    pMan->pProgress = NULL;
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    [File parser.]
@@ -278,7 +299,9 @@ void Ver_ParseFreeData( Ver_Man_t * p )
 void Ver_ParsePrintErrorMessage( Ver_Man_t * p )
 {
     p->fError = 1;
-    if ( p->fTopLevel ) // the line number is not given
+    if ( p->Output == NULL ) // the message is printed by the caller
+        ;
+    else if ( p->fTopLevel ) // the line number is not given
         fprintf( p->Output, "%s: %s\n", p->pFileName, p->sError );
     else // print the error message with the line number
         fprintf( p->Output, "%s (line %d): %s\n", 
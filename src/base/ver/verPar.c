@@ -0,0 +1,393 @@
+/**CFile****************************************************************
+
+  FileName    [verPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Verilog parser.]
+
+  Synopsis    [Parses the modules of the file in parallel.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: verPar.c,v 1.00 2026/10/18 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "ver.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define VER_PAR_CHUNK  (1<<20)   // the size of the chunk read by the prescan
+
+typedef struct Ver_ParJob_t_ Ver_ParJob_t;
+struct Ver_ParJob_t_
+{
+    Ver_Man_t *      pMan;          // the parser of the range of the file
+    int              RetValue;      // the result of parsing
+};
+
+static inline int Ver_ParNtkIsParsed( Abc_Ntk_t * pNtk )  { return Abc_NtkPiNum(pNtk) || Abc_NtkPoNum(pNtk); }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the file offsets following the modules.]
+
+  Description [Finds keywords "endmodule" outside of comments, strings,
+  and escaped names. Saves the offset of the character following each
+  keyword and the line number of this character.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Ver_ParCollectBounds( char * pFileName, Vec_Wrd_t * vBounds, Vec_Int_t * vLines )
+{
+    // the states: 0 = code, 1 = line comment, 2 = block comment, 3 = escaped name, 4 = string
+    unsigned char pIdent[256];
+    FILE * pFile;
+    char * pBuffer, Word[16];
+    int c, Prev = 0, State = 0, nWord = 0, nLines = 1;
+    size_t k, nRead;
+    iword iPos = 0;
+    for ( c = 0; c < 256; c++ )
+        pIdent[c] = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c == '$';
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return 0;
+    pBuffer = ABC_ALLOC( char, VER_PAR_CHUNK );
+    while ( (nRead = fread( pBuffer, 1, VER_PAR_CHUNK, pFile )) > 0 )
+    {
+        for ( k = 0; k < nRead; k++ )
+        {
+            c = (unsigned char)pBuffer[k];
+            if ( State == 0 && pIdent[c] ) // the most frequent case
+            {
+                if ( nWord < 15 )
+                    Word[nWord] = c;
+                nWord++;
+                Prev = c;
+                continue;
+            }
+            if ( c == '\n' )
+                nLines++;
+            if ( State == 1 )
+            {
+                if ( c == '\n' )
+                    State = 0;
+            }
+            else if ( State == 2 )
+            {
+                if ( Prev == '*' && c == '/' )
+                    State = 0, c = 0;
+            }
+            else if ( State == 3 )
+            {
+                if ( c == ' ' || c == '\t' || c == '\r' || c == '\n' )
+                    State = 0;
+            }
+            else if ( State == 4 )
+            {
+                if ( c == '\"' || c == '\n' )
+                    State = 0;
+            }
+            else
+            {
+                if ( nWord == 9 && !strncmp( Word, "endmodule", 9 ) )
+                {
+                    Vec_WrdPush( vBounds, iPos + k );
+                    Vec_IntPush( vLines, nLines - (c == '\n') );
+                }
+                nWord = 0;
+                if ( Prev == '/' && c == '/' )
+                    State = 1;
+                else if ( Prev == '/' && c == '*' )
+                    State = 2, c = 0;
+                else if ( c == '\\' )
+                    State = 3;
+                else if ( c == '\"' )
+                    State = 4;
+            }
+            Prev = c;
+        }
+        iPos += nRead;
+    }
+    if ( nWord == 9 && !strncmp( Word, "endmodule", 9 ) )
+    {
+        Vec_WrdPush( vBounds, iPos );
+        Vec_IntPush( vLines, nLines );
+    }
+    ABC_FREE( pBuffer );
+    fclose( pFile );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses one range of the file.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Ver_ParJobSolve( void * pArg )
+{
+    Ver_ParJob_t * pJob = (Ver_ParJob_t *)pArg;
+    pJob->RetValue = Ver_ParseModules( pJob->pMan );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Deletes the jobs.]
+
+  Description [The networks remaining in the designs of the jobs
+  are deleted too.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Ver_ParJobsFree( Vec_Ptr_t * vJobs )
+{
+    Ver_ParJob_t * pJob;
+    int i;
+    Vec_PtrForEachEntry( Ver_ParJob_t *, vJobs, pJob, i )
+    {
+        if ( pJob->pMan->pDesign )
+            Abc_DesFree( pJob->pMan->pDesign, NULL );
+        pJob->pMan->pDesign = NULL;
+        Ver_ParseStop( pJob->pMan );
+        ABC_FREE( pJob );
+    }
+    Vec_PtrFree( vJobs );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks if the same module is defined by two jobs.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Ver_ParJobsHaveDuplicates( Vec_Ptr_t * vJobs )
+{
+    st__table * tNames;
+    Ver_ParJob_t * pJob;
+    Abc_Ntk_t * pNtk;
+    int i, k, RetValue = 0;
+    tNames = st__init_table( (st__compare_func_type)strcmp, (st__hash_func_type)st__strhash );
+    Vec_PtrForEachEntry( Ver_ParJob_t *, vJobs, pJob, i )
+    {
+        Vec_PtrForEachEntry( Abc_Ntk_t *, pJob->pMan->pDesign->vModules, pNtk, k )
+            if ( Ver_ParNtkIsParsed(pNtk) && st__insert( tNames, pNtk->pName, NULL ) )
+                RetValue = 1;
+    }
+    st__free_table( tNames );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Moves the modules parsed by the jobs into the design.]
+
+  Description [The modules are added in the order of the file, so that
+  the resulting design is the same as the one produced by the serial
+  parser. A module instantiated before its definition is represented
+  by a placeholder (a network without inputs and outputs), which is
+  replaced by the parsed module.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Ver_ParJobsMerge( Abc_Des_t * pDes, Vec_Ptr_t * vJobs )
+{
+    Vec_Ptr_t * vPlaces;
+    Ver_ParJob_t * pJob;
+    Abc_Des_t * pDesJob;
+    Abc_Ntk_t * pNtk, * pNtkOld;
+    Abc_Obj_t * pObj;
+    int i, k, n;
+    vPlaces = Vec_PtrAlloc( 100 );
+    Vec_PtrForEachEntry( Ver_ParJob_t *, vJobs, pJob, i )
+    {
+        pDesJob = pJob->pMan->pDesign;
+        Vec_PtrForEachEntry( Abc_Ntk_t *, pDesJob->vModules, pNtk, k )
+        {
+            // transfer the local functions into the manager of the design
+            if ( pNtk->ntkFunc == ABC_FUNC_AIG )
+            {
+                assert( pNtk->pManFunc == pDesJob->pManFunc );
+                Abc_NtkForEachNode( pNtk, pObj, n )
+                    pObj->pData = Hop_Transfer( (Hop_Man_t *)pDesJob->pManFunc, (Hop_Man_t *)pDes->pManFunc, (Hop_Obj_t *)pObj->pData, Abc_ObjFaninNum(pObj) );
+                pNtk->pManFunc = pDes->pManFunc;
+            }
+            pNtkOld = Abc_DesFindModelByName( pDes, pNtk->pName );
+            if ( pNtkOld == NULL )
+            {
+                pNtk->Id = 0;
+                Abc_DesAddModel( pDes, pNtk );
+            }
+            else if ( !Ver_ParNtkIsParsed(pNtk) )
+                Vec_PtrPush( vPlaces, pNtk );
+            else
+            {
+                // replace the placeholder by the parsed module
+                assert( !Ver_ParNtkIsParsed(pNtkOld) );
+                st__delete( pDes->tModules, (const char **)&pNtkOld->pName, NULL );
+                st__insert( pDes->tModules, (char *)pNtk->pName, (char *)pNtk );
+                Vec_PtrWriteEntry( pDes->vModules, pNtkOld->Id, pNtk );
+                pNtk->Id = pNtkOld->Id;
+                pNtk->pDesign = pDes;
+                Vec_PtrPush( vPlaces, pNtkOld );
+            }
+        }
+        Vec_PtrClear( pDesJob->vModules );
+    }
+    // point the boxes to the modules of the design
+    Vec_PtrForEachEntry( Abc_Ntk_t *, pDes->vModules, pNtk, i )
+        Abc_NtkForEachBlackbox( pNtk, pObj, k )
+            if ( pObj->pData )
+                pObj->pData = Abc_DesFindModelByName( pDes, ((Abc_Ntk_t *)pObj->pData)->pName );
+    // delete the placeholders
+    Vec_PtrForEachEntry( Abc_Ntk_t *, vPlaces, pNtk, i )
+    {
+        pNtk->pDesign = NULL;
+        Abc_NtkDelete( pNtk );
+    }
+    Vec_PtrFree( vPlaces );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses the modules of the file in parallel.]
+
+  Description [Splits the file into ranges of complete modules, parses
+  the ranges by separate parsers using pMan->nProcs threads, and merges
+  the results into the design of pMan. Returns 1 if the parsing succeeded,
+  0 if there was an error, and -1 if the file should be parsed serially
+  (for example, when it has only one module).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Ver_ParseModulesPar( Ver_Man_t * pMan )
+{
+    Vec_Wrd_t * vBounds;
+    Vec_Int_t * vLines;
+    Vec_Ptr_t * vJobs;
+    Ver_ParJob_t * pJob;
+    Ver_Stream_t * pReader = NULL;
+    iword iBeg, iEnd, nFileSize, nJobSize;
+    int i, nJobs, LineBeg;
+    assert( Vec_PtrSize(pMan->pDesign->vModules) == 0 );
+    // find the ends of the modules
+    vBounds = Vec_WrdAlloc( 100 );
+    vLines  = Vec_IntAlloc( 100 );
+    if ( !Ver_ParCollectBounds( pMan->pFileName, vBounds, vLines ) || Vec_WrdSize(vBounds) < 2 )
+    {
+        Vec_WrdFree( vBounds );
+        Vec_IntFree( vLines );
+        return -1;
+    }
+    // group the modules into jobs of similar size (two jobs per thread)
+    nFileSize = Ver_StreamGetFileSize( pMan->pReader );
+    nJobs     = Abc_MinInt( 2 * pMan->nProcs, Vec_WrdSize(vBounds) );
+    nJobSize  = nFileSize / nJobs;
+    vJobs     = Vec_PtrAlloc( nJobs );
+    iBeg = 0; LineBeg = 1;
+    for ( i = 0; i <= Vec_WrdSize(vBounds); i++ )
+    {
+        // the last job extends to the end of the file
+        iEnd = i < Vec_WrdSize(vBounds) - 1 ? Vec_WrdEntry(vBounds, i) : -1;
+        if ( iEnd != -1 && iEnd - iBeg < nJobSize )
+            continue;
+        pReader = Ver_StreamAllocRange( pMan->pFileName, iBeg, iEnd, LineBeg );
+        if ( pReader == NULL )
+            break;
+        pJob = ABC_CALLOC( Ver_ParJob_t, 1 );
+        pJob->pMan = Ver_ParseStart( pMan->pFileName, pMan->pDesign->pLibrary, pReader );
+        pJob->pMan->fMapped    = pMan->fMapped;
+        pJob->pMan->fCheck     = pMan->fCheck;
+        pJob->pMan->fUseMemMan = pMan->fUseMemMan;
+        pJob->pMan->Output     = NULL;
+        if ( pMan->fMapped )
+        {
+            Hop_ManStop( (Hop_Man_t *)pJob->pMan->pDesign->pManFunc );
+            pJob->pMan->pDesign->pManFunc = NULL;
+        }
+        Vec_PtrPush( vJobs, pJob );
+        if ( iEnd == -1 )
+            break;
+        iBeg    = iEnd;
+        LineBeg = Vec_IntEntry( vLines, i );
+    }
+    Vec_WrdFree( vBounds );
+    Vec_IntFree( vLines );
+    if ( pReader == NULL )
+    {
+        Ver_ParJobsFree( vJobs );
+        return -1;
+    }
+    // parse the jobs
+    Util_ProcessThreads( Ver_ParJobSolve, vJobs, pMan->nProcs, 0, 0 );
+    // report the first error in the file
+    Vec_PtrForEachEntry( Ver_ParJob_t *, vJobs, pJob, i )
+    {
+        if ( pJob->RetValue )
+            continue;
+        if ( pJob->pMan->fError )
+        {
+            pJob->pMan->Output = pMan->Output;
+            Ver_ParsePrintErrorMessage( pJob->pMan );
+        }
+        Ver_ParJobsFree( vJobs );
+        Abc_DesFree( pMan->pDesign, NULL );
+        pMan->pDesign = NULL;
+        pMan->fError = 1;
+        return 0;
+    }
+    // a module defined twice is reported by the serial parser
+    if ( Ver_ParJobsHaveDuplicates( vJobs ) )
+    {
+        Ver_ParJobsFree( vJobs );
+        return -1;
+    }
+    Ver_ParJobsMerge( pMan->pDesign, vJobs );
+    Ver_ParJobsFree( vJobs );
+    return 1;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
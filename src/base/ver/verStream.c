@@ -30,6 +30,7 @@ ABC_NAMESPACE_IMPL_START
 #define VER_BUFFER_SIZE        1048576    // 1M  - size of the data chunk stored in memory
 #define VER_OFFSET_SIZE          65536    // 64K - load new data when less than this is left
 #define VER_WORD_SIZE            65536    // 64K - the largest token that can be returned
+#define VER_CHARSET_NUM              8    // the number of lists of delimiters with cached tables
 
 #define VER_MINIMUM(a,b)       (((a) < (b))? (a) : (b))
 
@@ -50,12 +51,47 @@ struct Ver_Stream_t_
     // tokens given to the user
     char             pChars[VER_WORD_SIZE+5]; // temporary storage for a word (plus end-of-string and two parentheses)
     int              nChars;        // the total number of characters in the word
+    // lookup tables for the lists of delimiters
+    char *           pCharSets[VER_CHARSET_NUM];        // the lists of chars (string constants)
+    unsigned char    pCharTables[VER_CHARSET_NUM][256]; // the tables marking the chars in the lists
+    int              nCharSets;     // the number of lists seen so far
     // status of the parser
     int              fStop;         // this flag goes high when the end of file is reached
 };
 
 static void Ver_StreamReload( Ver_Stream_t * p );
 
+// returns the table marking the chars in the given list; the lists are string
+// constants in the parser, so the tables are looked up by the pointer
+static inline unsigned char * Ver_StreamCharTable( Ver_Stream_t * p, char * pChars )
+{
+    unsigned char * pTable;
+    int i;
+    for ( i = 0; i < VER_CHARSET_NUM; i++ )
+        if ( p->pCharSets[i] == pChars )
+            return p->pCharTables[i];
+    i = p->nCharSets++ % VER_CHARSET_NUM;
+    p->pCharSets[i] = pChars;
+    pTable = p->pCharTables[i];
+    memset( pTable, 0, 256 );
+    for ( ; *pChars; pChars++ )
+        pTable[(unsigned char)*pChars] = 1;
+    return pTable;
+}
+// returns the first char from the list starting at the current position 
+// (or the end of the data) while counting the lines
+static inline char * Ver_StreamFindChars( Ver_Stream_t * p, char * pCharsToStop )
+{
+    unsigned char * pTable = Ver_StreamCharTable( p, pCharsToStop );
+    char * pChar;
+    for ( pChar = p->pBufferCur; !pTable[(unsigned char)*pChar]; pChar++ )
+        if ( *pChar == '\n' )
+            p->nLineCounter++;
+        else if ( *pChar == 0 && pChar == p->pBufferEnd )
+            break;
+    return pChar;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -72,6 +108,24 @@ static void Ver_StreamReload( Ver_Stream_t * p );
 
 ***********************************************************************/
 Ver_Stream_t * Ver_StreamAlloc( char * pFileName )
+{
+    return Ver_StreamAllocRange( pFileName, 0, -1, 1 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the file reader for the given part of the file.]
+
+  Description [The reader sees the chars from iBeg to iEnd (or to the 
+  end of the file if iEnd is -1) as the complete file. The line numbers 
+  start from nLineBeg, which is the line of the file containing iBeg.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Ver_Stream_t * Ver_StreamAllocRange( char * pFileName, iword iBeg, iword iEnd, int nLineBeg )
 {
     Ver_Stream_t * p;
     FILE * pFile;
@@ -90,9 +144,14 @@ Ver_Stream_t * Ver_StreamAlloc( char * pFileName )
     p->pFileName   = pFileName;
     p->pFile       = pFile;
     // get the file size, in bytes
-    fseek( pFile, 0, SEEK_END );  
-    p->nFileSize = ftell( pFile );  
-    rewind( pFile ); 
+    if ( iEnd == -1 )
+    {
+        fseek( pFile, 0, SEEK_END );  
+        iEnd = ftell( pFile );  
+    }
+    assert( 0 <= iBeg && iBeg <= iEnd );
+    p->nFileSize = iEnd - iBeg;
+    fseek( pFile, iBeg, SEEK_SET ); 
     // allocate the buffer
     p->pBuffer = ABC_ALLOC( char, VER_BUFFER_SIZE+1 );
     p->nBufferSize = VER_BUFFER_SIZE;
@@ -105,8 +164,10 @@ Ver_Stream_t * Ver_StreamAlloc( char * pFileName )
     // set the ponters to the end and the stopping point
     p->pBufferEnd  = p->pBuffer + nCharsToRead;
     p->pBufferStop = (p->nFileRead == p->nFileSize)? p->pBufferEnd : p->pBuffer + VER_BUFFER_SIZE - VER_OFFSET_SIZE;
+    // terminate the data by zero, which is not in any list of chars
+    *p->pBufferEnd = 0;
     // start the arrays
-    p->nLineCounter = 1; // 1-based line counting
+    p->nLineCounter = nLineBeg; // 1-based line counting
     return p;
 }
 
@@ -141,6 +202,7 @@ void Ver_StreamReload( Ver_Stream_t * p )
     // set the ponters to the end and the stopping point
     p->pBufferEnd  = p->pBuffer + nCharsUsed + nCharsToRead;
     p->pBufferStop = (p->nFileRead == p->nFileSize)? p->pBufferEnd : p->pBuffer + VER_BUFFER_SIZE - VER_OFFSET_SIZE;
+    *p->pBufferEnd = 0;
 }
 
 /**Function*************************************************************
@@ -303,27 +365,22 @@ char Ver_StreamPopChar( Ver_Stream_t * p )
 ***********************************************************************/
 void Ver_StreamSkipChars( Ver_Stream_t * p, char * pCharsToSkip )
 {
-    char * pChar, * pTemp;
+    unsigned char * pTable;
+    char * pChar;
     assert( !p->fStop );
     assert( pCharsToSkip != NULL );
     // check if the new data should to be loaded
     if ( p->pBufferCur > p->pBufferStop )
         Ver_StreamReload( p );
-    // skip the symbols
-    for ( pChar = p->pBufferCur; pChar < p->pBufferEnd; pChar++ )
-    {
-        // skip symbols as long as they are in the list
-        for ( pTemp = pCharsToSkip; *pTemp; pTemp++ )
-            if ( *pChar == *pTemp )
-                break;
-        if ( *pTemp == 0 ) // pChar is not found in the list
-        {
-            p->pBufferCur = pChar;
-            return;
-        }
-        // count the lines
-        if ( *pChar == '\n' )
+    // skip symbols as long as they are in the list (zero at the end is not)
+    pTable = Ver_StreamCharTable( p, pCharsToSkip );
+    for ( pChar = p->pBufferCur; pTable[(unsigned char)*pChar]; pChar++ )
+        if ( *pChar == '\n' ) // count the lines
             p->nLineCounter++;
+    if ( pChar < p->pBufferEnd ) // pChar is not found in the list
+    {
+        p->pBufferCur = pChar;
+        return;
     }
     // the file is finished or the last part continued 
     // through VER_OFFSET_SIZE chars till the end of the buffer
@@ -348,27 +405,16 @@ void Ver_StreamSkipChars( Ver_Stream_t * p, char * pCharsToSkip )
 ***********************************************************************/
 void Ver_StreamSkipToChars( Ver_Stream_t * p, char * pCharsToStop )
 {
-    char * pChar, * pTemp;
+    char * pChar;
     assert( !p->fStop );
     assert( pCharsToStop != NULL );
     // check if the new data should to be loaded
     if ( p->pBufferCur > p->pBufferStop )
         Ver_StreamReload( p );
-    // skip the symbols
-    for ( pChar = p->pBufferCur; pChar < p->pBufferEnd; pChar++ )
+    // skip symbols as long as they are NOT in the list
+    pChar = Ver_StreamFindChars( p, pCharsToStop );
+    if ( pChar < p->pBufferEnd ) // the symbol is found - move position and return
     {
-        // skip symbols as long as they are NOT in the list
-        for ( pTemp = pCharsToStop; *pTemp; pTemp++ )
-            if ( *pChar == *pTemp )
-                break;
-        if ( *pTemp == 0 ) // pChar is not found in the list
-        {
-            // count the lines
-            if ( *pChar == '\n' )
-                p->nLineCounter++;
-            continue;
-        }
-        // the symbol is found - move position and return
         p->pBufferCur = pChar;
         return;
     }
@@ -396,37 +442,26 @@ void Ver_StreamSkipToChars( Ver_Stream_t * p, char * pCharsToStop )
 ***********************************************************************/
 char * Ver_StreamGetWord( Ver_Stream_t * p, char * pCharsToStop )
 {
-    char * pChar, * pTemp;
+    char * pChar;
     if ( p->fStop )
         return NULL;
     assert( pCharsToStop != NULL );
     // check if the new data should to be loaded
     if ( p->pBufferCur > p->pBufferStop )
         Ver_StreamReload( p );
-    // skip the symbols
-    p->nChars = 0;
-    for ( pChar = p->pBufferCur; pChar < p->pBufferEnd; pChar++ )
+    // skip symbols as long as they are NOT in the list
+    pChar = Ver_StreamFindChars( p, pCharsToStop );
+    p->nChars = pChar - p->pBufferCur;
+    if ( p->nChars >= VER_WORD_SIZE )
+    {
+        printf( "Ver_StreamGetWord(): The buffer size is exceeded.\n" );
+        return NULL;
+    }
+    memcpy( p->pChars, p->pBufferCur, (size_t)p->nChars );
+    p->pChars[p->nChars] = 0;
+    if ( pChar < p->pBufferEnd ) // the symbol is found - move the position, return the word
     {
-        // skip symbols as long as they are NOT in the list
-        for ( pTemp = pCharsToStop; *pTemp; pTemp++ )
-            if ( *pChar == *pTemp )
-                break;
-        if ( *pTemp == 0 ) // pChar is not found in the list
-        {
-            p->pChars[p->nChars++] = *pChar;
-            if ( p->nChars == VER_WORD_SIZE )
-            {
-                printf( "Ver_StreamGetWord(): The buffer size is exceeded.\n" );
-                return NULL;
-            }
-            // count the lines
-            if ( *pChar == '\n' )
-                p->nLineCounter++;
-            continue;
-        }
-        // the symbol is found - move the position, set the word end, return the word
         p->pBufferCur = pChar;
-        p->pChars[p->nChars] = 0;
         return p->pChars;
     }
     // the file is finished or the last part continued 
@@ -434,7 +469,6 @@ char * Ver_StreamGetWord( Ver_Stream_t * p, char * pCharsToStop )
     if ( p->pBufferStop == p->pBufferEnd ) // end of file
     {
         p->fStop = 1;
-        p->pChars[p->nChars] = 0;
         return p->pChars;
     }
     printf( "Ver_StreamGetWord() failed to parse the file \"%s\".\n", p->pFileName );
@@ -198,6 +198,7 @@ struct Wlc_Par_t_
     int                    fUseBmc3;           // Run BMC3 in parallel 
     int                    fShrinkAbs;         // Shrink Abs with BMC
     int                    fShrinkScratch;     // Restart pdr from scratch after shrinking
+    int                    nProcs;             // the number of threads
     int                    fVerbose;           // verbose output
     int                    fPdrVerbose;        // verbose output
     int                    RunId;              // id in this run 
@@ -224,8 +225,12 @@ struct Wlc_BstPar_t_
     int                    fDecMuxes;
     int                    fSaveFfNames;
     int                    fBlastNew;
+    int                    fShareOps;
+    int                    fCone;
+    int                    nProcs;
     int                    fVerbose;
     Vec_Int_t *            vBoxIds;
+    volatile int *         pfStop;     // if this flag gets set, blasting stops and returns NULL
 };
 
 static inline void Wlc_BstParDefault( Wlc_BstPar_t * pPar )
@@ -244,6 +249,9 @@ static inline void Wlc_BstParDefault( Wlc_BstPar_t * pPar )
     pPar->fCreateMiter =  0;
     pPar->fCreateWordMiter =  0;
     pPar->fDecMuxes    =  0;
+    pPar->fShareOps    =  0;
+    pPar->fCone        =  0;
+    pPar->nProcs       =  1;
     pPar->fVerbose     =  0;
 }
 
@@ -258,8 +266,12 @@ struct Wla_Man_t_
     Abc_Cex_t * pCex;
     Gia_Man_t * pGia;
     Vec_Bit_t * vUnmark;
+    Gia_Man_t * pGiaOrig;
+    Vec_Int_t * vRefine;
     void      * pPdrPars;
     void      * pThread;
+    void      * pThreadBlast;
+    void      * pThreadRefine;
 
     int iCexFrame;
     int fNewAbs;
@@ -40,6 +40,11 @@ extern int           IPdr_ManReduceClauses( Pdr_Man_t * p, Vec_Vec_t * vClauses
 extern void          IPdr_ManPrintClauses( Vec_Vec_t * vClauses, int kStart, int nRegs );
 extern void          Wla_ManJoinThread( Wla_Man_t * pWla, int RunId );
 extern void          Wla_ManConcurrentBmc3( Wla_Man_t * pWla, Aig_Man_t * pAig, Abc_Cex_t ** ppCex );
+extern void          Wla_ManConcurrentBitBlast( Wla_Man_t * pWla );
+extern void          Wla_ManJoinBitBlast( Wla_Man_t * pWla );
+extern void          Wla_ManStopBitBlast( Wla_Man_t * pWla );
+extern void          Wla_ManConcurrentRefine( Wla_Man_t * pWla );
+extern void          Wla_ManJoinRefine( Wla_Man_t * pWla );
 extern int           Wla_CallBackToStop( int RunId );
 extern int           Wla_GetGlobalRunId();
 
@@ -558,9 +563,8 @@ Wlc_Ntk_t * Wlc_NtkIntroduceChoices( Wlc_Ntk_t * pNtk, Vec_Int_t * vBlacks, Vec_
     return pNew;
 }
 
-static Abc_Cex_t * Wlc_NtkCexIsReal( Wlc_Ntk_t * pOrig, Abc_Cex_t * pCex ) 
+static Abc_Cex_t * Wlc_NtkCexIsReal( Gia_Man_t * pGiaOrig, Abc_Cex_t * pCex ) 
 {
-    Gia_Man_t * pGiaOrig = Wlc_NtkBitBlast( pOrig, NULL );
     int f, i;
     Gia_Obj_t * pObj, * pObjRi;
     Abc_Cex_t * pCexReal = Abc_CexAlloc( Gia_ManRegNum(pGiaOrig), Gia_ManPiNum(pGiaOrig), pCex->iFrame + 1 );
@@ -586,7 +590,6 @@ static Abc_Cex_t * Wlc_NtkCexIsReal( Wlc_Ntk_t * pOrig, Abc_Cex_t * pCex )
         {
             if (pObj->Value==1) {
                 Abc_Print( 1, "CEX is real on the original model.\n" );
-                Gia_ManStop(pGiaOrig);
                 pCexReal->iFrame = f;
                 pCexReal->iPo = i;
                 return pCexReal;
@@ -595,7 +598,6 @@ static Abc_Cex_t * Wlc_NtkCexIsReal( Wlc_Ntk_t * pOrig, Abc_Cex_t * pCex )
     }
 
     // Abc_Print( 1, "CEX is spurious.\n" );
-    Gia_ManStop(pGiaOrig);
     Abc_CexFree(pCexReal);
     return NULL;
 }
@@ -1431,6 +1433,14 @@ Aig_Man_t * Wla_ManBitBlast( Wla_Man_t * pWla, Wlc_Ntk_t * pAbs )
     return pAig;
 }
 
+Gia_Man_t * Wla_ManBitBlastOrig( Wla_Man_t * pWla )
+{
+    Wla_ManJoinBitBlast( pWla );
+    if ( pWla->pGiaOrig == NULL )
+        pWla->pGiaOrig = Wlc_NtkBitBlast( pWla->p, NULL );
+    return pWla->pGiaOrig;
+}
+
 int Wla_ManCheckCombUnsat( Wla_Man_t * pWla, Aig_Man_t * pAig )
 {
     Pdr_Man_t * pPdr;
@@ -1487,6 +1497,7 @@ int Wla_ManSolveInt( Wla_Man_t * pWla, Aig_Man_t * pAig )
     Pdr_Par_t * pPdrPars = (Pdr_Par_t *)pWla->pPdrPars;
     Abc_Cex_t * pBmcCex = NULL;
     Abc_Cex_t * pCexReal = NULL;
+    Gia_Man_t * pGiaOrig = NULL;
     int RetValue = -1;
     int RunId = Wla_GetGlobalRunId();
 
@@ -1555,10 +1566,15 @@ int Wla_ManSolveInt( Wla_Man_t * pWla, Aig_Man_t * pAig )
         return RetValue;
     }
 
-    // verify CEX
-    pCexReal = Wlc_NtkCexIsReal( pWla->p, pWla->pCex );
+    // verify CEX while the refinement is computed, assuming the CEX is spurious
+    pGiaOrig = Wla_ManBitBlastOrig( pWla );
+    if ( pWla->pPars->nProcs > 1 && !pWla->fNewAbs && (pWla->pPars->fHybrid || !pWla->pPars->fProofRefine) )
+        Wla_ManConcurrentRefine( pWla );
+    pCexReal = Wlc_NtkCexIsReal( pGiaOrig, pWla->pCex );
+    Wla_ManJoinRefine( pWla );
     if ( pCexReal )
     {
+        Vec_IntFreeP( &pWla->vRefine );
         Abc_CexFree( pWla->pCex );
         pWla->pCex = pCexReal; 
         return 0;
@@ -1567,6 +1583,14 @@ int Wla_ManSolveInt( Wla_Man_t * pWla, Aig_Man_t * pAig )
     return -1;
 }
 
+void Wla_ManRefineCex( Wla_Man_t * pWla )
+{
+    abctime clk = Abc_Clock();
+    assert( pWla->vRefine == NULL );
+    pWla->vRefine = Wlc_NtkAbsRefinement( pWla->p, pWla->pGia, pWla->pCex, pWla->vBlacks );
+    pWla->tCbr += Abc_Clock() - clk;
+}
+
 void Wla_ManRefine( Wla_Man_t * pWla )
 {
     abctime clk;
@@ -1578,6 +1602,7 @@ void Wla_ManRefine( Wla_Man_t * pWla )
         if ( pWla->pCex )
             Abc_CexFree( pWla->pCex );
         pWla->pCex = NULL;
+        Vec_IntFreeP( &pWla->vRefine );
         Gia_ManStop( pWla->pGia ); pWla->pGia = NULL;
         return;
     }
@@ -1585,9 +1610,10 @@ void Wla_ManRefine( Wla_Man_t * pWla )
     // perform refinement
     if ( pWla->pPars->fHybrid || !pWla->pPars->fProofRefine )
     {
-        clk = Abc_Clock();
-        vRefine = Wlc_NtkAbsRefinement( pWla->p, pWla->pGia, pWla->pCex, pWla->vBlacks );
-        pWla->tCbr += Abc_Clock() - clk;
+        if ( pWla->vRefine == NULL )
+            Wla_ManRefineCex( pWla );
+        vRefine = pWla->vRefine;
+        pWla->vRefine = NULL;
     }
     else // proof-based only
     {
@@ -1686,6 +1712,9 @@ Wla_Man_t * Wla_ManStart( Wlc_Ntk_t * pNtk, Wlc_Par_t * pPars )
 
 void Wla_ManStop( Wla_Man_t * p )
 {
+    Wla_ManStopBitBlast( p );
+    if ( p->pGiaOrig )  Gia_ManStop( p->pGiaOrig );
+    if ( p->vRefine )   Vec_IntFree( p->vRefine );
     if ( p->vBlacks )   Vec_IntFree( p->vBlacks );
     if ( p->vSignals )  Vec_IntFree( p->vSignals );
     if ( p->pGia )      Gia_ManStop( p->pGia );
@@ -1704,6 +1733,10 @@ int Wla_ManSolve( Wla_Man_t * pWla, Wlc_Par_t * pPars )
 
     int RetValue = -1;
 
+    // bit-blast the original network while the first abstractions are solved
+    if ( pPars->nProcs > 1 )
+        Wla_ManConcurrentBitBlast( pWla );
+
     // perform refinement iterations
     for ( pWla->nIters = 1; pWla->nIters < pPars->nIterMax; ++pWla->nIters )
     {
@@ -1391,6 +1391,288 @@ void Wlc_NtkDumpMulties( Wlc_Ntk_t * p, Gia_Man_t * pNew )
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Marks the objects in the cone of influence of the outputs.]
+
+  Description [Only the outputs selected by the parameters are considered,
+  unless a miter is created. The combinational inputs are always marked, 
+  so that the AIG has the same inputs as without the cone restriction.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Bit_t * Wlc_BlastCollectCone( Wlc_Ntk_t * p, Wlc_BstPar_t * pPar )
+{
+    Vec_Bit_t * vCone = Vec_BitStart( Wlc_NtkObjNumMax(p) );
+    Vec_Int_t * vStack = Vec_IntAlloc( 100 );
+    int fAllOuts = pPar->iOutput < 0 || pPar->fCreateMiter || pPar->fCreateWordMiter;
+    Wlc_Obj_t * pObj;
+    int i, k, iObj, iFanin, nCone = 0;
+    Wlc_NtkForEachCi( p, pObj, i )
+        Vec_BitWriteEntry( vCone, Wlc_ObjId(p, pObj), 1 );
+    Wlc_NtkForEachCo( p, pObj, i )
+        if ( fAllOuts || (i >= pPar->iOutput && i < pPar->iOutput + pPar->nOutputRange) )
+            Vec_IntPush( vStack, Wlc_ObjId(p, pObj) );
+    while ( Vec_IntSize(vStack) > 0 )
+    {
+        iObj = Vec_IntPop( vStack );
+        if ( Vec_BitEntry(vCone, iObj) )
+            continue;
+        Vec_BitWriteEntry( vCone, iObj, 1 );
+        Wlc_ObjForEachFanin( Wlc_NtkObj(p, iObj), iFanin, k )
+            if ( iFanin && !Vec_BitEntry(vCone, iFanin) )
+                Vec_IntPush( vStack, iFanin );
+    }
+    Vec_IntFree( vStack );
+    if ( pPar->fVerbose )
+    {
+        Wlc_NtkForEachObj( p, pObj, i )
+            nCone += Vec_BitEntry( vCone, i );
+        printf( "The cone of influence of the outputs contains %d out of %d objects.\n", nCone, Wlc_NtkObjNum(p) );
+    }
+    return vCone;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Bit-blasts one arithmetic operator.]
+
+  Description [The operators handled here (multipliers, dividers, etc)
+  depend only on the fanin bits and the parameters. This allows for
+  blasting them once into a separate AIG and copying this AIG for 
+  each operator instance with the same type, ranges, and signedness.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Wlc_BlastIsArithOp( int Type )
+{
+    return Type == WLC_OBJ_ARI_MULTI  || Type == WLC_OBJ_ARI_DIVIDE || Type == WLC_OBJ_ARI_REM || Type == WLC_OBJ_ARI_MODULUS || 
+           Type == WLC_OBJ_ARI_POWER  || Type == WLC_OBJ_ARI_SQRT   || Type == WLC_OBJ_ARI_SQUARE;
+}
+void Wlc_BlastArithOp( Gia_Man_t * pNew, int Type, int nRange, int * pFans0, int nRange0, int * pFans1, int nRange1, int fSigned, int fSigned0, int fSigned1, 
+                       Wlc_BstPar_t * pPar, Vec_Int_t * vTemp0, Vec_Int_t * vTemp1, Vec_Int_t * vTemp2, Vec_Int_t * vRes )
+{
+    Vec_IntClear( vRes );
+    if ( Type == WLC_OBJ_ARI_MULTI )
+    {
+        int nRangeMax = Abc_MaxInt(nRange0, nRange1);
+        int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRangeMax, fSigned );
+        int * pArg1 = Wlc_VecLoadFanins( vTemp1, pFans1, nRange1, nRangeMax, fSigned );
+        if ( Wlc_NtkCountConstBits(pArg0, nRangeMax) < Wlc_NtkCountConstBits(pArg1, nRangeMax) ) {
+            ABC_SWAP( int *, pArg0, pArg1 );
+            ABC_SWAP( int, nRange0, nRange1 );
+        }
+        if ( pPar->fBooth )
+            Wlc_BlastBooth( pNew, pArg0, pArg1, nRange0, nRange1, vRes, fSigned, pPar->fCla, NULL, pPar->fVerbose );
+        else if ( pPar->fCla )
+            Wlc_BlastMultiplier3( pNew, pArg0, pArg1, nRange0, nRange1, vRes, fSigned, pPar->fCla, NULL, pPar->fVerbose );
+        else
+            Wlc_BlastMultiplier( pNew, pArg0, pArg1, nRangeMax, nRangeMax, vTemp2, vRes, fSigned );
+            //Wlc_BlastMultiplierC( pNew, pArg0, pArg1, nRangeMax, nRangeMax, vTemp2, vRes, fSigned );
+        if ( nRange > Vec_IntSize(vRes) )
+            Vec_IntFillExtra( vRes, nRange, fSigned ? Vec_IntEntryLast(vRes) : 0 );
+        else
+            Vec_IntShrink( vRes, nRange );
+        assert( Vec_IntSize(vRes) == nRange );
+    }
+    else if ( Type == WLC_OBJ_ARI_DIVIDE || Type == WLC_OBJ_ARI_REM || Type == WLC_OBJ_ARI_MODULUS )
+    {
+        int nRangeMax = Abc_MaxInt( nRange, Abc_MaxInt(nRange0, nRange1) );
+        int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRangeMax, fSigned );
+        int * pArg1 = Wlc_VecLoadFanins( vTemp1, pFans1, nRange1, nRangeMax, fSigned );
+        if ( fSigned )
+            Wlc_BlastDividerSigned( pNew, pArg0, nRangeMax, pArg1, nRangeMax, Type == WLC_OBJ_ARI_DIVIDE, vRes, pPar->fNonRest );
+        else
+            Wlc_BlastDividerTop( pNew, pArg0, nRangeMax, pArg1, nRangeMax, Type == WLC_OBJ_ARI_DIVIDE, vRes, pPar->fNonRest );
+        Vec_IntShrink( vRes, nRange );
+        if ( !pPar->fDivBy0 )
+            Wlc_BlastZeroCondition( pNew, pFans1, nRange1, vRes );
+    }
+    else if ( Type == WLC_OBJ_ARI_POWER )
+    {
+        int nRangeMax = Abc_MaxInt(nRange0, nRange);
+        int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRangeMax, fSigned0 );
+        int * pArg1 = Wlc_VecLoadFanins( vTemp1, pFans1, nRange1, nRange1, fSigned1 );
+        Wlc_BlastPower( pNew, pArg0, nRangeMax, pArg1, nRange1, vTemp2, vRes );
+        Vec_IntShrink( vRes, nRange );
+    }
+    else if ( Type == WLC_OBJ_ARI_SQRT )
+    {
+        int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRange0 + (nRange0 & 1), 0 );
+        nRange0 += (nRange0 & 1);
+        if ( pPar->fNonRest )
+            Wlc_BlastSqrtNR( pNew, pArg0, nRange0, vTemp2, vRes );
+        else
+            Wlc_BlastSqrt( pNew, pArg0, nRange0, vTemp2, vRes );
+        if ( nRange > Vec_IntSize(vRes) )
+            Vec_IntFillExtra( vRes, nRange, 0 );
+        else
+            Vec_IntShrink( vRes, nRange );
+    }
+    else if ( Type == WLC_OBJ_ARI_SQUARE )
+    {
+        int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRange0, 0 );
+        Wlc_BlastSquare( pNew, pArg0, nRange0, vTemp2, vRes );
+        if ( nRange > Vec_IntSize(vRes) )
+            Vec_IntFillExtra( vRes, nRange, 0 );
+        else
+            Vec_IntShrink( vRes, nRange );
+    }
+    else assert( 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Bit-blasts the arithmetic operators once for each signature.]
+
+  Description [The signature of an operator is its type, the ranges of 
+  the output and the fanins, and the signedness. The operators whose 
+  fanins are constants are not considered, because they are simplified 
+  during blasting. If nProcs is more than one, the AIGs of different 
+  signatures are derived concurrently. Otherwise, only the signatures 
+  shared by several operators are blasted. Returns the signatures and
+  sets the array mapping the object IDs into the signatures.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Wlc_BstOp_t_ Wlc_BstOp_t;
+struct Wlc_BstOp_t_
+{
+    int              Sign[7];       // type, ranges, and signedness
+    int              nUses;         // the number of operators
+    Wlc_BstPar_t *   pPar;          // the blasting parameters
+    Gia_Man_t *      pGia;          // the AIG of the operator
+};
+int Wlc_BlastArithOpDerive( void * pArg )
+{
+    Wlc_BstOp_t * pOp = (Wlc_BstOp_t *)pArg;
+    Vec_Int_t * vTemp0 = Vec_IntAlloc( 1000 );
+    Vec_Int_t * vTemp1 = Vec_IntAlloc( 1000 );
+    Vec_Int_t * vTemp2 = Vec_IntAlloc( 1000 );
+    Vec_Int_t * vRes   = Vec_IntAlloc( 1000 );
+    Vec_Int_t * vFans  = Vec_IntAlloc( 1000 );
+    Gia_Man_t * pNew, * pTemp;
+    int i, iLit, nRange0 = pOp->Sign[2], nRange1 = Abc_MaxInt( pOp->Sign[3], 0 );
+    pNew = Gia_ManStart( 1000 );
+    pNew->fGiaSimple = pOp->pPar->fGiaSimple;
+    if ( !pNew->fGiaSimple )
+        Gia_ManHashAlloc( pNew );
+    for ( i = 0; i < nRange0 + nRange1; i++ )
+        Vec_IntPush( vFans, Gia_ManAppendCi(pNew) );
+    Wlc_BlastArithOp( pNew, pOp->Sign[0], pOp->Sign[1], Vec_IntArray(vFans), pOp->Sign[2], Vec_IntArray(vFans) + nRange0, pOp->Sign[3], 
+        pOp->Sign[4], pOp->Sign[5], pOp->Sign[6], pOp->pPar, vTemp0, vTemp1, vTemp2, vRes );
+    Vec_IntForEachEntry( vRes, iLit, i )
+        Gia_ManAppendCo( pNew, iLit );
+    pOp->pGia = Gia_ManCleanup( pTemp = pNew );
+    Gia_ManStop( pTemp );
+    Vec_IntFree( vTemp0 );
+    Vec_IntFree( vTemp1 );
+    Vec_IntFree( vTemp2 );
+    Vec_IntFree( vRes );
+    Vec_IntFree( vFans );
+    return 1;
+}
+Vec_Ptr_t * Wlc_BlastArithOpsDerive( Wlc_Ntk_t * p, Wlc_BstPar_t * pPar, Vec_Bit_t * vCone, Vec_Ptr_t ** pvObj2Op )
+{
+    Vec_Ptr_t * vOps = Vec_PtrAlloc( 100 );
+    Vec_Ptr_t * vObj2Op = Vec_PtrStart( Wlc_NtkObjNumMax(p) );
+    Vec_Ptr_t * vJobs;
+    Wlc_BstOp_t * pOp = NULL;
+    Wlc_Obj_t * pObj;
+    int i, k, Sign[7], nOpers = 0;
+    abctime clk = Abc_Clock();
+    Wlc_NtkForEachObj( p, pObj, i )
+    {
+        if ( !Wlc_BlastIsArithOp(pObj->Type) )
+            continue;
+        if ( vCone && !Vec_BitEntry(vCone, i) )
+            continue;
+        if ( Wlc_ObjFanin0(p, pObj)->Type == WLC_OBJ_CONST || (Wlc_ObjFaninNum(pObj) > 1 && Wlc_ObjFanin1(p, pObj)->Type == WLC_OBJ_CONST) )
+            continue;
+        Sign[0] = pObj->Type;
+        Sign[1] = Wlc_ObjRange( pObj );
+        Sign[2] = Wlc_ObjRange( Wlc_ObjFanin0(p, pObj) );
+        Sign[3] = Wlc_ObjFaninNum(pObj) > 1 ? Wlc_ObjRange( Wlc_ObjFanin1(p, pObj) ) : -1;
+        Sign[4] = Wlc_ObjFaninNum(pObj) > 1 ? Wlc_ObjIsSignedFanin01(p, pObj) : 0;
+        Sign[5] = Wlc_ObjIsSignedFanin0(p, pObj);
+        Sign[6] = Wlc_ObjFaninNum(pObj) > 1 ? Wlc_ObjIsSignedFanin1(p, pObj) : 0;
+        Vec_PtrForEachEntry( Wlc_BstOp_t *, vOps, pOp, k )
+            if ( !memcmp(pOp->Sign, Sign, sizeof(int) * 7) )
+                break;
+        if ( k == Vec_PtrSize(vOps) )
+        {
+            pOp = ABC_CALLOC( Wlc_BstOp_t, 1 );
+            memcpy( pOp->Sign, Sign, sizeof(int) * 7 );
+            pOp->pPar = pPar;
+            Vec_PtrPush( vOps, pOp );
+        }
+        pOp->nUses++;
+        Vec_PtrWriteEntry( vObj2Op, i, pOp );
+        nOpers++;
+    }
+    // blast the operators
+    vJobs = Vec_PtrAlloc( Vec_PtrSize(vOps) );
+    Vec_PtrForEachEntry( Wlc_BstOp_t *, vOps, pOp, k )
+        if ( pPar->nProcs > 1 || pOp->nUses > 1 )
+            Vec_PtrPush( vJobs, pOp );
+    Util_ProcessThreads( Wlc_BlastArithOpDerive, vJobs, pPar->nProcs, 0, 0 );
+    if ( pPar->fVerbose )
+    {
+        printf( "Derived %d AIGs for %d arithmetic operators with %d signatures using %d thread%s.  ", 
+            Vec_PtrSize(vJobs), nOpers, Vec_PtrSize(vOps), pPar->nProcs, pPar->nProcs > 1 ? "s" : "" );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    Vec_PtrFree( vJobs );
+    *pvObj2Op = vObj2Op;
+    return vOps;
+}
+void Wlc_BlastArithOpsFree( Vec_Ptr_t * vOps, Vec_Ptr_t * vObj2Op )
+{
+    Wlc_BstOp_t * pOp;
+    int i;
+    Vec_PtrForEachEntry( Wlc_BstOp_t *, vOps, pOp, i )
+    {
+        Gia_ManStopP( &pOp->pGia );
+        ABC_FREE( pOp );
+    }
+    Vec_PtrFree( vOps );
+    Vec_PtrFree( vObj2Op );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Copies the AIG of the operator for the given fanin bits.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Wlc_BlastArithOpCopy( Gia_Man_t * pNew, Gia_Man_t * pOp, int * pFans0, int nRange0, int * pFans1, Vec_Int_t * vRes )
+{
+    Gia_Obj_t * pObj;
+    int i;
+    Gia_ManConst0(pOp)->Value = 0;
+    Gia_ManForEachCi( pOp, pObj, i )
+        pObj->Value = i < nRange0 ? pFans0[i] : pFans1[i - nRange0];
+    Gia_ManForEachAnd( pOp, pObj, i )
+        pObj->Value = Gia_ManHashAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+    Vec_IntClear( vRes );
+    Gia_ManForEachCo( pOp, pObj, i )
+        Vec_IntPush( vRes, Gia_ObjFanin0Copy(pObj) );
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -1420,6 +1702,11 @@ Gia_Man_t * Wlc_NtkBitBlast( Wlc_Ntk_t * p, Wlc_BstPar_t * pParIn )
     int i, k, b, iFanin, iLit, nAndPrev, * pFans0, * pFans1, * pFans2, * pFans3;
     int nFFins = 0, nFFouts = 0, curPi = 0, curPo = 0, nFf2Regs = 0;
     int nBitCis = 0, nBitCos = 0, fAdded = 0;
+    Vec_Ptr_t * vOps = NULL, * vObj2Op = NULL;
+    Vec_Bit_t * vCone = NULL;
+    Wlc_BstOp_t * pOp;
+    int nCopies = 0, fStopped = 0;
+    abctime clk, clkCopy = 0, clkTotal = Abc_Clock();
     Wlc_BstPar_t Par, * pPar = &Par;
     Wlc_BstParDefault( pPar );
     pPar = pParIn ? pParIn : pPar;
@@ -1534,6 +1821,14 @@ Gia_Man_t * Wlc_NtkBitBlast( Wlc_Ntk_t * p, Wlc_BstPar_t * pParIn )
     }
     //printf( "Init state: %s\n", p->pInits );
 
+    // skip the logic outside of the cone of influence of the outputs
+    if ( pPar->fCone && pPar->vBoxIds == NULL && Vec_IntSize(&p->vFfs2) == 0 && !pPar->fAddOutputs )
+        vCone = Wlc_BlastCollectCone( p, pPar );
+
+    // blast the arithmetic operators shared by several objects
+    if ( (pPar->nProcs > 1 || pPar->fShareOps) && pPar->vBoxIds == NULL )
+        vOps = Wlc_BlastArithOpsDerive( p, pPar, vCone, &vObj2Op );
+
     // blast in the topological order
     Wlc_NtkForEachObj( p, pObj, i )
     {
@@ -1552,7 +1847,14 @@ Gia_Man_t * Wlc_NtkBitBlast( Wlc_Ntk_t * p, Wlc_BstPar_t * pParIn )
         pFans3  = pObj->Type != WLC_OBJ_FF && Wlc_ObjFaninNum(pObj) > 3 ? Vec_IntEntryP( vBits, Wlc_ObjCopy(p, Wlc_ObjFaninId(pObj,3)) ) : NULL;
         Vec_IntClear( vRes );
         assert( nRange > 0 );
-        if ( pPar->vBoxIds && pObj->Mark )
+        // after the stop request, the remaining logic is replaced by constants
+        if ( pPar->pfStop && *pPar->pfStop && pPar->vBoxIds == NULL )
+            fStopped = 1;
+        if ( vCone && !Vec_BitEntry(vCone, i) )
+            Vec_IntFill( vRes, nRange, 0 );
+        else if ( fStopped && !Wlc_ObjIsCi(pObj) && pObj->Type != WLC_OBJ_FF )
+            Vec_IntFill( vRes, nRange, 0 );
+        else if ( pPar->vBoxIds && pObj->Mark )
         {
             If_Box_t * pBox;
             char Buffer[100];
@@ -2026,54 +2328,33 @@ Gia_Man_t * Wlc_NtkBitBlast( Wlc_Ntk_t * p, Wlc_BstPar_t * pParIn )
             for ( j = 0; j < nRange; j++ )
                 Vec_IntPush( vRes, Gia_ManHashMux(pNew, ModeIn, pArg0[j], pArg1[j]) ); 
         }
-        else if ( pObj->Type == WLC_OBJ_ARI_MULTI )
+        else if ( pObj->Type == WLC_OBJ_ARI_MULTI && fUseOldMultiplierBlasting )
+        {
+            int nRangeMax = Abc_MaxInt( nRange, Abc_MaxInt(nRange0, nRange1) );
+            int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRangeMax, Wlc_ObjIsSignedFanin01(p, pObj) );
+            int * pArg1 = Wlc_VecLoadFanins( vTemp1, pFans1, nRange1, nRangeMax, Wlc_ObjIsSignedFanin01(p, pObj) );
+            Wlc_BlastMultiplier2( pNew, pArg0, pArg1, nRange, vTemp2, vRes );
+            Vec_IntShrink( vRes, nRange );
+        }
+        else if ( Wlc_BlastIsArithOp(pObj->Type) )
         {
-            if ( fUseOldMultiplierBlasting )
+            // copy the shared AIG unless the fanins have constant bits
+            pOp = vObj2Op ? (Wlc_BstOp_t *)Vec_PtrEntry( vObj2Op, i ) : NULL;
+            if ( pOp && pOp->pGia && !Wlc_NtkCountConstBits(pFans0, nRange0) && (nRange1 == -1 || !Wlc_NtkCountConstBits(pFans1, nRange1)) )
             {
-                int nRangeMax = Abc_MaxInt( nRange, Abc_MaxInt(nRange0, nRange1) );
-                int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRangeMax, Wlc_ObjIsSignedFanin01(p, pObj) );
-                int * pArg1 = Wlc_VecLoadFanins( vTemp1, pFans1, nRange1, nRangeMax, Wlc_ObjIsSignedFanin01(p, pObj) );
-                Wlc_BlastMultiplier2( pNew, pArg0, pArg1, nRange, vTemp2, vRes );
-                Vec_IntShrink( vRes, nRange );
+                clk = Abc_Clock();
+                Wlc_BlastArithOpCopy( pNew, pOp->pGia, pFans0, nRange0, pFans1, vRes );
+                clkCopy += Abc_Clock() - clk;
+                nCopies++;
             }
             else
             {
-                int fSigned = Wlc_ObjIsSignedFanin01(p, pObj);
-                int nRangeMax = Abc_MaxInt(nRange0, nRange1);
-                int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRangeMax, fSigned );
-                int * pArg1 = Wlc_VecLoadFanins( vTemp1, pFans1, nRange1, nRangeMax, fSigned );
-                if ( Wlc_NtkCountConstBits(pArg0, nRangeMax) < Wlc_NtkCountConstBits(pArg1, nRangeMax) ) {
-                    ABC_SWAP( int *, pArg0, pArg1 );
-                    ABC_SWAP( int, nRange0, nRange1 );
-                }
-                if ( pPar->fBooth )
-                    Wlc_BlastBooth( pNew, pArg0, pArg1, nRange0, nRange1, vRes, fSigned, pPar->fCla, NULL, pParIn->fVerbose );
-                else if ( pPar->fCla )
-                    Wlc_BlastMultiplier3( pNew, pArg0, pArg1, nRange0, nRange1, vRes, Wlc_ObjIsSignedFanin01(p, pObj), pPar->fCla, NULL, pParIn->fVerbose );
-                else
-                    Wlc_BlastMultiplier( pNew, pArg0, pArg1, nRangeMax, nRangeMax, vTemp2, vRes, fSigned );
-                    //Wlc_BlastMultiplierC( pNew, pArg0, pArg1, nRangeMax, nRangeMax, vTemp2, vRes, fSigned );
-                if ( nRange > Vec_IntSize(vRes) )
-                    Vec_IntFillExtra( vRes, nRange, fSigned ? Vec_IntEntryLast(vRes) : 0 );
-                else
-                    Vec_IntShrink( vRes, nRange );
-                assert( Vec_IntSize(vRes) == nRange );
+                int fSigned  = Wlc_ObjFaninNum(pObj) > 1 ? Wlc_ObjIsSignedFanin01(p, pObj) : 0;
+                int fSigned0 = Wlc_ObjIsSignedFanin0(p, pObj);
+                int fSigned1 = Wlc_ObjFaninNum(pObj) > 1 ? Wlc_ObjIsSignedFanin1(p, pObj) : 0;
+                Wlc_BlastArithOp( pNew, pObj->Type, nRange, pFans0, nRange0, pFans1, nRange1, fSigned, fSigned0, fSigned1, pPar, vTemp0, vTemp1, vTemp2, vRes );
             }
         }
-        else if ( pObj->Type == WLC_OBJ_ARI_DIVIDE || pObj->Type == WLC_OBJ_ARI_REM || pObj->Type == WLC_OBJ_ARI_MODULUS )
-        {
-            int nRangeMax = Abc_MaxInt( nRange, Abc_MaxInt(nRange0, nRange1) );
-            int fSigned = Wlc_ObjIsSignedFanin01(p, pObj);
-            int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRangeMax, fSigned );
-            int * pArg1 = Wlc_VecLoadFanins( vTemp1, pFans1, nRange1, nRangeMax, fSigned );
-            if ( fSigned )
-                Wlc_BlastDividerSigned( pNew, pArg0, nRangeMax, pArg1, nRangeMax, pObj->Type == WLC_OBJ_ARI_DIVIDE, vRes, pPar->fNonRest );
-            else
-                Wlc_BlastDividerTop( pNew, pArg0, nRangeMax, pArg1, nRangeMax, pObj->Type == WLC_OBJ_ARI_DIVIDE, vRes, pPar->fNonRest );
-            Vec_IntShrink( vRes, nRange );
-            if ( !pPar->fDivBy0 )
-                Wlc_BlastZeroCondition( pNew, pFans1, nRange1, vRes );
-        }
         else if ( pObj->Type == WLC_OBJ_ARI_MINUS )
         {
             int nRangeMax = Abc_MaxInt( nRange0, nRange );
@@ -2081,36 +2362,6 @@ Gia_Man_t * Wlc_NtkBitBlast( Wlc_Ntk_t * p, Wlc_BstPar_t * pParIn )
             Wlc_BlastMinus( pNew, pArg0, nRangeMax, vRes );
             Vec_IntShrink( vRes, nRange );
         }
-        else if ( pObj->Type == WLC_OBJ_ARI_POWER )
-        {
-            int nRangeMax = Abc_MaxInt(nRange0, nRange);
-            int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRangeMax, Wlc_ObjIsSignedFanin0(p, pObj) );
-            int * pArg1 = Wlc_VecLoadFanins( vTemp1, pFans1, nRange1, nRange1, Wlc_ObjIsSignedFanin1(p, pObj) );
-            Wlc_BlastPower( pNew, pArg0, nRangeMax, pArg1, nRange1, vTemp2, vRes );
-            Vec_IntShrink( vRes, nRange );
-        }
-        else if ( pObj->Type == WLC_OBJ_ARI_SQRT )
-        {
-            int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRange0 + (nRange0 & 1), 0 );
-            nRange0 += (nRange0 & 1);
-            if ( pPar->fNonRest )
-                Wlc_BlastSqrtNR( pNew, pArg0, nRange0, vTemp2, vRes );
-            else
-                Wlc_BlastSqrt( pNew, pArg0, nRange0, vTemp2, vRes );
-            if ( nRange > Vec_IntSize(vRes) )
-                Vec_IntFillExtra( vRes, nRange, 0 );
-            else
-                Vec_IntShrink( vRes, nRange );
-        }
-        else if ( pObj->Type == WLC_OBJ_ARI_SQUARE )
-        {
-            int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRange0, 0 );
-            Wlc_BlastSquare( pNew, pArg0, nRange0, vTemp2, vRes );
-            if ( nRange > Vec_IntSize(vRes) )
-                Vec_IntFillExtra( vRes, nRange, 0 );
-            else
-                Vec_IntShrink( vRes, nRange );
-        }
         else if ( pObj->Type == WLC_OBJ_DEC )
         {
             int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRange0, 0 );
@@ -2149,6 +2400,19 @@ Gia_Man_t * Wlc_NtkBitBlast( Wlc_Ntk_t * p, Wlc_BstPar_t * pParIn )
     Vec_IntFree( vTemp1 );
     Vec_IntFree( vTemp2 );
     Vec_IntFree( vRes );
+    if ( pPar->fVerbose )
+    {
+        if ( vOps )
+        {
+            printf( "Copied the shared AIGs for %d operators.  ", nCopies );
+            Abc_PrintTime( 1, "Time", clkCopy );
+        }
+        printf( "Bit-blasted the network into %d AND nodes.  ", Gia_ManAndNum(pNew) );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
+    }
+    if ( vOps )
+        Wlc_BlastArithOpsFree( vOps, vObj2Op );
+    Vec_BitFreeP( &vCone );
     // create flop boxes
     Wlc_NtkForEachFf2( p, pObj, i )
     {
@@ -2754,6 +3018,8 @@ Gia_Man_t * Wlc_NtkBitBlast( Wlc_Ntk_t * p, Wlc_BstPar_t * pParIn )
 //        pAbc->vMiniLutObjs = Gia_ManDeriveBoxMapping( pNew );        
 //    }
     //Wlc_NtkDumpMulties( p, pNew );
+    if ( fStopped )
+        Gia_ManStopP( &pNew );
     return pNew;
 }
 
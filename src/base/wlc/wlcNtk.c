@@ -134,6 +134,7 @@ void Wlc_ManSetDefaultParams( Wlc_Par_t * pPars )
     pPars->fUseBmc3      =            0;   // Run BMC3 in parallel
     pPars->fShrinkAbs    =            0;   // Shrink Abs with BMC
     pPars->fShrinkScratch=            0;   // Restart pdr from scratch after shrinking
+    pPars->nProcs        =            1;   // the number of threads
     pPars->fVerbose      =            0;   // verbose output`
     pPars->fPdrVerbose   =            0;   // show verbose PDR output
 }
@@ -41,6 +41,7 @@ ABC_NAMESPACE_IMPL_START
 extern Abc_Ntk_t *   Abc_NtkFromAigPhase( Aig_Man_t * pAig );
 extern int           Abc_NtkDarBmc3( Abc_Ntk_t * pAbcNtk, Saig_ParBmc_t * pBmcPars, int fOrDecomp );
 extern int           Wla_ManShrinkAbs( Wla_Man_t * pWla, int nFrames, int RunId );
+extern void          Wla_ManRefineCex( Wla_Man_t * pWla );
 
 static volatile int  g_nRunIds = 0;             // the number of the last prover instance
 int Wla_CallBackToStop( int RunId ) { assert( RunId <= g_nRunIds ); return RunId < g_nRunIds; }
@@ -50,6 +51,11 @@ int Wla_GetGlobalRunId() { return g_nRunIds; }
 
 void Wla_ManJoinThread( Wla_Man_t * pWla, int RunId ) {}
 void Wla_ManConcurrentBmc3( Wla_Man_t * pWla, Aig_Man_t * pAig, Abc_Cex_t ** ppCex ) {}
+void Wla_ManConcurrentBitBlast( Wla_Man_t * pWla ) {}
+void Wla_ManJoinBitBlast( Wla_Man_t * pWla ) {}
+void Wla_ManStopBitBlast( Wla_Man_t * pWla ) {}
+void Wla_ManConcurrentRefine( Wla_Man_t * pWla ) {}
+void Wla_ManJoinRefine( Wla_Man_t * pWla ) {}
 
 #else // pthreads are used
 
@@ -63,6 +69,15 @@ typedef struct Bmc3_ThData_t_
     int          fVerbose;
 } Bmc3_ThData_t;
 
+// information given to the bit-blasting thread
+typedef struct Blast_ThData_t_
+{
+    pthread_t    Thread;
+    Wlc_Ntk_t *  pNtk;
+    Gia_Man_t *  pGia;
+    volatile int fStop;
+} Blast_ThData_t;
+
 // mutext to control access to shared variables
 extern pthread_mutex_t g_mutex;
 
@@ -162,6 +177,133 @@ void Wla_ManConcurrentBmc3( Wla_Man_t * pWla, Aig_Man_t * pAig, Abc_Cex_t ** ppC
     assert( status == 0 );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Bit-blasts the original network in a separate thread.]
+
+  Description [The bit-blasted original network is only needed to check
+  whether a counter-example of the abstraction is real. It is derived once
+  while the first abstractions are created and solved. The bit-blaster
+  updates the copies of the network it works on, so the thread gets its
+  own copy of the original network, which borrows the name manager.
+  The blaster names the CIs and COs, so the thread is only started if
+  all of them have names; otherwise, Wlc_ObjName() would write into its
+  static buffer, shared with the main thread. If the abstraction is 
+  proved before the first counter-example, the thread is stopped.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Wla_BitBlastThread( void * pArg )
+{
+    Blast_ThData_t * pData = (Blast_ThData_t *)pArg;
+    Wlc_BstPar_t Par, * pPar = &Par;
+    Wlc_BstParDefault( pPar );
+    pPar->pfStop = &pData->fStop;
+    pData->pGia = Wlc_NtkBitBlast( pData->pNtk, pPar );
+    pData->pNtk->pManName = NULL;
+    Wlc_NtkFree( pData->pNtk );
+    pData->pNtk = NULL;
+    pthread_exit( NULL );
+    assert(0);
+    return NULL;
+}
+void Wla_ManConcurrentBitBlast( Wla_Man_t * pWla )
+{
+    Wlc_Ntk_t * p = pWla->p, * pNtk;
+    Wlc_Obj_t * pObj;
+    Blast_ThData_t * pData;
+    int i, status, fNamed = 1;
+    assert( pWla->pThreadBlast == NULL && pWla->pGiaOrig == NULL );
+    if ( Vec_IntSize(&p->vFfs2) > 0 || (p->vTables && Vec_PtrSize(p->vTables) > 0) || !Wlc_NtkHasNameId(p) )
+        return;
+    pNtk = Wlc_NtkDupDfsSimple( p );
+    Wlc_NtkCleanNameId( pNtk );
+    for ( i = 0; i < p->nObjsAlloc; i++ )
+        if ( Wlc_ObjCopy(p, i) > 0 && i < Vec_IntSize(&p->vNameIds) && Wlc_ObjNameId(p, i) )
+            Wlc_ObjSetNameId( pNtk, Wlc_ObjCopy(p, i), Wlc_ObjNameId(p, i) );
+    pNtk->pManName = p->pManName;
+    // without the names of the CIs and COs (including the flops), the bit-blaster
+    // would use the name buffer shared with the main thread
+    Wlc_NtkForEachCi( pNtk, pObj, i )
+        fNamed &= Wlc_ObjNameId(pNtk, Wlc_ObjId(pNtk, pObj)) > 0;
+    Wlc_NtkForEachCo( pNtk, pObj, i )
+        fNamed &= Wlc_ObjNameId(pNtk, Wlc_ObjId(pNtk, pObj)) > 0;
+    if ( !fNamed )
+    {
+        pNtk->pManName = NULL;
+        Wlc_NtkFree( pNtk );
+        return;
+    }
+
+    pData = ABC_CALLOC( Blast_ThData_t, 1 );
+    pData->pNtk = pNtk;
+    pWla->pThreadBlast = (void *)pData;
+    status = pthread_create( &pData->Thread, NULL, Wla_BitBlastThread, pData );
+    assert( status == 0 );
+}
+void Wla_ManJoinBitBlast( Wla_Man_t * pWla )
+{
+    Blast_ThData_t * pData = (Blast_ThData_t *)pWla->pThreadBlast;
+    int status;
+    if ( pData == NULL )
+        return;
+    status = pthread_join( pData->Thread, NULL );
+    assert( status == 0 );
+    assert( pWla->pGiaOrig == NULL );
+    pWla->pGiaOrig = pData->pGia;
+    ABC_FREE( pData );
+    pWla->pThreadBlast = NULL;
+}
+void Wla_ManStopBitBlast( Wla_Man_t * pWla )
+{
+    Blast_ThData_t * pData = (Blast_ThData_t *)pWla->pThreadBlast;
+    if ( pData == NULL )
+        return;
+    pData->fStop = 1;
+    Wla_ManJoinBitBlast( pWla );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Refines the abstraction in a separate thread.]
+
+  Description [Performs CEX-based refinement speculatively, while the 
+  main thread checks whether the counter-example is real.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Wla_RefineThread( void * pArg )
+{
+    Wla_ManRefineCex( (Wla_Man_t *)pArg );
+    pthread_exit( NULL );
+    assert(0);
+    return NULL;
+}
+void Wla_ManConcurrentRefine( Wla_Man_t * pWla )
+{
+    int status;
+    assert( pWla->pThreadRefine == NULL && pWla->vRefine == NULL );
+    pWla->pThreadRefine = (void *)ABC_CALLOC( pthread_t, 1 );
+    status = pthread_create( (pthread_t *)pWla->pThreadRefine, NULL, Wla_RefineThread, pWla );
+    assert( status == 0 );
+}
+void Wla_ManJoinRefine( Wla_Man_t * pWla )
+{
+    int status;
+    if ( pWla->pThreadRefine == NULL )
+        return;
+    status = pthread_join( *(pthread_t *)(pWla->pThreadRefine), NULL );
+    assert( status == 0 );
+    ABC_FREE( pWla->pThreadRefine );
+    pWla->pThreadRefine = NULL;
+}
+
 #endif // pthreads are used
 
 ////////////////////////////////////////////////////////////////////////
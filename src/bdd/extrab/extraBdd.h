@@ -141,6 +141,14 @@ extern int          Extra_bddNodePathsUnderCutArray( DdManager * dd, DdNode ** p
 /* find the profile of a DD (the number of edges crossing each level) */
 extern int          Extra_ProfileWidth( DdManager * dd, DdNode * F, int * Profile, int CutLevel );
 
+/*=== extraBddGov.c ==========================================================*/
+
+typedef struct Extra_BddGov_t_  Extra_BddGov_t;
+extern Extra_BddGov_t * Extra_BddGovStart( DdManager * dd, int nMemLimitMb, int nLiveMax, int fReorder, int fVerbose );
+extern int         Extra_BddGovCheck( Extra_BddGov_t * p );
+extern int         Extra_BddGovIsOut( Extra_BddGov_t * p );
+extern void        Extra_BddGovStop( Extra_BddGov_t * p );
+
 /*=== extraBddImage.c ================================================================*/
 
 typedef struct Extra_ImageTree_t_  Extra_ImageTree_t;
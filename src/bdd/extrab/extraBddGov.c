@@ -0,0 +1,289 @@
+/**CFile****************************************************************
+
+  FileName    [extraBddGov.c]
+
+  PackageName [extra]
+
+  Synopsis    [Governor of memory and reordering during BDD construction.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: extraBddGov.c,v 1.00 2026/10/18 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "extraBdd.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+/*---------------------------------------------------------------------------*/
+/* Constant declarations                                                     */
+/*---------------------------------------------------------------------------*/
+
+#define EXTRA_GOV_FIRST       4096  // live nodes to trigger the first reordering
+#define EXTRA_GOV_GROWTH         2  // the default growth factor between reorderings
+#define EXTRA_GOV_GROWTH_MAX    16  // the largest growth factor between reorderings
+
+/*---------------------------------------------------------------------------*/
+/* Stucture declarations                                                     */
+/*---------------------------------------------------------------------------*/
+
+struct Extra_BddGov_t_
+{
+    DdManager *     dd;             // the manager
+    unsigned long   nMemLimit;      // the memory budget in bytes (0 = no limit)
+    unsigned long   nMemLimitOld;   // the hard memory limit before the governor started
+    unsigned long   nMemBase;       // the memory used by the manager when the governor started
+    unsigned        nCacheHard;     // the hard cache limit before the governor started
+    unsigned        nLiveMax;       // the limit on the live nodes (0 = no limit)
+    int             fReorder;       // enables reordering
+    int             fVerbose;       // enables verbose output
+    unsigned        nLiveLast;      // live nodes after the last reordering
+    unsigned        nLiveNext;      // live nodes to trigger the next reordering
+    int             nGrowth;        // the current growth factor between reorderings
+    int             nReorders;      // the number of reorderings seen so far
+    int             nReordersGov;   // the number of reorderings started by the governor
+    int             nOverflows;     // the number of times the budget was exceeded
+    abctime         timeReorder;    // the runtime of the reorderings
+};
+
+/*---------------------------------------------------------------------------*/
+/* Type declarations                                                         */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/* Variable declarations                                                     */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/* Macro declarations                                                        */
+/*---------------------------------------------------------------------------*/
+
+/**AutomaticStart*************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/* Static function prototypes                                                */
+/*---------------------------------------------------------------------------*/
+
+static void extraBddGovSchedule( Extra_BddGov_t * p, unsigned nLiveBefore );
+
+/**AutomaticEnd***************************************************************/
+
+
+/*---------------------------------------------------------------------------*/
+/* Definition of exported functions                                          */
+/*---------------------------------------------------------------------------*/
+
+/**Function********************************************************************
+
+  Synopsis    [Starts the governor of the BDD manager.]
+
+  Description [The governor sets the hard memory limit of the manager to
+  the budget (in megabytes, including the tables of the manager), freezes
+  the size of the computed table, and takes over the scheduling of
+  dynamic reordering (symmetric sifting) from the fixed thresholds of
+  CUDD. The manager should be empty or contain only the referenced BDDs.
+  If nMemLimitMb or nLiveMax are 0, the corresponding limit is not used.]
+
+  SideEffects [Enables dynamic reordering if fReorder is set.]
+
+  SeeAlso     [Extra_BddGovCheck Extra_BddGovStop]
+
+******************************************************************************/
+Extra_BddGov_t *
+Extra_BddGovStart(
+  DdManager * dd,
+  int nMemLimitMb,
+  int nLiveMax,
+  int fReorder,
+  int fVerbose)
+{
+    Extra_BddGov_t * p;
+    p = ABC_CALLOC( Extra_BddGov_t, 1 );
+    p->dd           = dd;
+    p->nMemLimit    = (unsigned long)nMemLimitMb << 20;
+    p->nMemLimitOld = Cudd_ReadMaxMemory( dd );
+    p->nMemBase     = Cudd_ReadMemoryInUse( dd );
+    p->nCacheHard   = Cudd_ReadMaxCacheHard( dd );
+    p->nLiveMax     = (unsigned)nLiveMax;
+    p->fReorder     = fReorder;
+    p->fVerbose     = fVerbose;
+    p->nGrowth      = EXTRA_GOV_GROWTH;
+    p->nLiveLast    = Cudd_ReadKeys(dd) - Cudd_ReadDead(dd);
+    p->nLiveNext    = Abc_MaxInt( EXTRA_GOV_FIRST, p->nGrowth * p->nLiveLast );
+    p->nReorders    = Cudd_ReadReorderings( dd );
+    if ( p->nMemLimit )
+    {
+        // the computed table is not allowed to grow beyond its current size
+        Cudd_SetMaxMemory( dd, p->nMemLimit );
+        Cudd_SetMaxCacheHard( dd, Cudd_ReadCacheSlots(dd) );
+    }
+    if ( fReorder )
+    {
+        // CUDD reorders inside the operators only if a single operator blows up
+        Cudd_AutodynEnable( dd, CUDD_REORDER_SYMM_SIFT );
+        Cudd_SetNextReordering( dd, 4 * p->nLiveNext );
+    }
+    return p;
+
+} /* end of Extra_BddGovStart */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Checks the resources used by the manager.]
+
+  Description [Should be called between the operators, when all BDDs
+  to be kept are referenced. Reorders the variables if the number of
+  live nodes has grown enough since the last reordering, or if the live
+  nodes take more than a half of the memory budget left after the tables
+  of the manager. Returns 1 if the live nodes exceed the limit or take
+  more than 90% of this memory after reordering; in this case,
+  the caller should give up the current problem or split it into smaller
+  ones. Returns 0 otherwise.]
+
+  SideEffects [May reorder the variables.]
+
+  SeeAlso     [Extra_BddGovStart Extra_BddGovStop]
+
+******************************************************************************/
+int
+Extra_BddGovCheck(
+  Extra_BddGov_t * p)
+{
+    DdManager * dd = p->dd;
+    unsigned nLive = Cudd_ReadKeys(dd) - Cudd_ReadDead(dd);
+    unsigned long nMemLive = (unsigned long)nLive * sizeof(DdNode);
+    unsigned long nMemNodes = p->nMemLimit > p->nMemBase ? p->nMemLimit - p->nMemBase : 0;
+    int fMemHigh = p->nMemLimit && nMemLive > nMemNodes / 2;
+    // account for the reorderings started by CUDD itself
+    if ( p->nReorders != Cudd_ReadReorderings(dd) )
+    {
+        p->nReorders = Cudd_ReadReorderings(dd);
+        extraBddGovSchedule( p, 0 );
+    }
+    if ( p->fReorder && nLive > p->nLiveLast + p->nLiveLast / 4 && (nLive >= p->nLiveNext || fMemHigh) )
+    {
+        abctime clk = Abc_Clock();
+        Cudd_ReduceHeap( dd, CUDD_REORDER_SYMM_SIFT, 1 );
+        p->timeReorder += Abc_Clock() - clk;
+        p->nReorders = Cudd_ReadReorderings(dd);
+        p->nReordersGov++;
+        extraBddGovSchedule( p, nLive );
+        nLive = Cudd_ReadKeys(dd) - Cudd_ReadDead(dd);
+        nMemLive = (unsigned long)nLive * sizeof(DdNode);
+    }
+    if ( (p->nLiveMax && nLive > p->nLiveMax) || (p->nMemLimit && nMemLive > nMemNodes / 10 * 9) )
+    {
+        p->nOverflows++;
+        return 1;
+    }
+    return 0;
+
+} /* end of Extra_BddGovCheck */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Returns 1 if the last failure of an operator was due to the limits.]
+
+  Description [Clears the error code of the manager.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+int
+Extra_BddGovIsOut(
+  Extra_BddGov_t * p)
+{
+    Cudd_ErrorType Error = Cudd_ReadErrorCode( p->dd );
+    Cudd_ClearErrorCode( p->dd );
+    if ( Error == CUDD_MAX_MEM_EXCEEDED || Error == CUDD_TOO_MANY_NODES || Error == CUDD_MEMORY_OUT )
+    {
+        p->nOverflows++;
+        return 1;
+    }
+    return 0;
+
+} /* end of Extra_BddGovIsOut */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Stops the governor.]
+
+  Description [Restores the hard limits of the manager. Dynamic
+  reordering remains in the state set by the governor.]
+
+  SideEffects []
+
+  SeeAlso     [Extra_BddGovStart]
+
+******************************************************************************/
+void
+Extra_BddGovStop(
+  Extra_BddGov_t * p)
+{
+    if ( p->fVerbose )
+    {
+        printf( "BDD governor: Reorders = %d (governor %d). Overflows = %d. Peak live = %d. Memory = %.2f MB.  ",
+            Cudd_ReadReorderings(p->dd), p->nReordersGov, p->nOverflows,
+            Cudd_ReadPeakLiveNodeCount(p->dd), 1.0 * Cudd_ReadMemoryInUse(p->dd) / (1 << 20) );
+        ABC_PRT( "Reordering time", p->timeReorder );
+    }
+    Cudd_SetMaxMemory( p->dd, p->nMemLimitOld );
+    Cudd_SetMaxCacheHard( p->dd, p->nCacheHard );
+    ABC_FREE( p );
+
+} /* end of Extra_BddGovStop */
+
+
+/*---------------------------------------------------------------------------*/
+/* Definition of static functions                                            */
+/*---------------------------------------------------------------------------*/
+
+/**Function********************************************************************
+
+  Synopsis    [Schedules the next reordering.]
+
+  Description [If the reordering did not reduce the live nodes by at
+  least 10%, the BDDs are likely to be large in any order, so the
+  growth factor before the next reordering is doubled. Otherwise, the
+  default factor is restored. If the number of live nodes before the
+  reordering is not known (nLiveBefore is 0), the factor is not changed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+static void
+extraBddGovSchedule(
+  Extra_BddGov_t * p,
+  unsigned nLiveBefore)
+{
+    DdManager * dd = p->dd;
+    unsigned nLive = Cudd_ReadKeys(dd) - Cudd_ReadDead(dd);
+    if ( nLiveBefore && 10.0 * nLive > 9.0 * nLiveBefore )
+        p->nGrowth = Abc_MinInt( 2 * p->nGrowth, EXTRA_GOV_GROWTH_MAX );
+    else if ( nLiveBefore )
+        p->nGrowth = EXTRA_GOV_GROWTH;
+    p->nLiveLast = nLive;
+    p->nLiveNext = Abc_MaxInt( EXTRA_GOV_FIRST, p->nGrowth * nLive );
+    if ( p->fReorder )
+        Cudd_SetNextReordering( dd, 4 * p->nLiveNext );
+    if ( p->fVerbose )
+        printf( "BDD governor: Reordering %d: Live nodes %d -> %d. Memory = %.2f MB. Next reordering at %d live nodes.\n",
+            Cudd_ReadReorderings(dd), nLiveBefore, nLive, 1.0 * Cudd_ReadMemoryInUse(dd) / (1 << 20), p->nLiveNext );
+
+} /* end of extraBddGovSchedule */
+
+
+ABC_NAMESPACE_IMPL_END
@@ -50,6 +50,7 @@ struct Gia_ParLlb_t_
     int         nVolumeMax;    // the largest volume
     int         nVolumeMin;    // the smallest volume
     int         nPartValue;    // partitioning value
+    int         nProcs;        // the number of threads for image computation
     int         fBackward;     // enable backward reachability
     int         fReorder;      // enable dynamic variable reordering
     int         fIndConstr;    // extract inductive constraints
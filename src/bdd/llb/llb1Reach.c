@@ -27,6 +27,8 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+static DdNode * Llb_ManComputeImagePar( Llb_Man_t * p, DdNode * bInit );
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -331,6 +333,8 @@ DdNode * Llb_ManComputeImage( Llb_Man_t * p, DdNode * bInit, int fBackward )
     Llb_Grp_t * pGroup;
     DdNode * bImage, * bGroup, * bCube, * bTemp;
     int k, Index;
+    if ( !fBackward && p->pPars->nProcs > 1 && p->pMatrix->nCols > 3 )
+        return Llb_ManComputeImagePar( p, bInit );
     bImage = bInit;  Cudd_Ref( bImage );
     for ( k = 1; k < p->pMatrix->nCols-1; k++ )
     {
@@ -398,6 +402,340 @@ DdNode * Llb_ManComputeImage( Llb_Man_t * p, DdNode * bInit, int fBackward )
     return bImage;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Derives BDD for the group in the given manager.]
+
+  Description [Same as Llb_ManConstructGroupBdd() but keeps the node
+  BDDs in vFuncs, indexed by object IDs, instead of the AIG objects,
+  so that several groups can be processed concurrently.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+DdNode * Llb_ManConstructGroupBddPar( Llb_Man_t * p, Llb_Grp_t * pGroup, DdManager * dd, Vec_Ptr_t * vFuncs )
+{
+    Aig_Obj_t * pObj;
+    DdNode * bBdd0, * bBdd1, * bRes, * bXor, * bTemp;
+    int i;
+    Vec_PtrWriteEntry( vFuncs, Aig_ObjId(Aig_ManConst1(p->pAig)), Cudd_ReadOne(dd) );
+    Vec_PtrForEachEntry( Aig_Obj_t *, pGroup->vIns, pObj, i )
+        Vec_PtrWriteEntry( vFuncs, Aig_ObjId(pObj), Cudd_bddIthVar(dd, Vec_IntEntry(p->vObj2Var, Aig_ObjId(pObj))) );
+    bRes = NULL;
+    Vec_PtrForEachEntry( Aig_Obj_t *, pGroup->vNodes, pObj, i )
+    {
+        bBdd0 = Cudd_NotCond( (DdNode *)Vec_PtrEntry(vFuncs, Aig_ObjFaninId0(pObj)), Aig_ObjFaninC0(pObj) );
+        bBdd1 = Cudd_NotCond( (DdNode *)Vec_PtrEntry(vFuncs, Aig_ObjFaninId1(pObj)), Aig_ObjFaninC1(pObj) );
+        bTemp = Cudd_bddAnd( dd, bBdd0, bBdd1 );
+        if ( bTemp == NULL )
+            goto finish;
+        Cudd_Ref( bTemp );
+        Vec_PtrWriteEntry( vFuncs, Aig_ObjId(pObj), bTemp );
+    }
+    bRes = Cudd_ReadOne( dd );   Cudd_Ref( bRes );
+    Vec_PtrForEachEntry( Aig_Obj_t *, pGroup->vOuts, pObj, i )
+    {
+        if ( Aig_ObjIsCo(pObj) )
+            bBdd0 = Cudd_NotCond( (DdNode *)Vec_PtrEntry(vFuncs, Aig_ObjFaninId0(pObj)), Aig_ObjFaninC0(pObj) );
+        else
+            bBdd0 = (DdNode *)Vec_PtrEntry( vFuncs, Aig_ObjId(pObj) );
+        bBdd1 = Cudd_bddIthVar( dd, Vec_IntEntry(p->vObj2Var, Aig_ObjId(pObj)) );
+        bXor  = Cudd_bddXor( dd, bBdd0, bBdd1 );
+        if ( bXor == NULL )
+        {
+            Cudd_RecursiveDeref( dd, bRes );
+            bRes = NULL;
+            goto finish;
+        }
+        Cudd_Ref( bXor );
+        bRes  = Cudd_bddAnd( dd, bTemp = bRes, Cudd_Not(bXor) );
+        if ( bRes == NULL )
+        {
+            Cudd_RecursiveDeref( dd, bTemp );
+            Cudd_RecursiveDeref( dd, bXor );
+            goto finish;
+        }
+        Cudd_Ref( bRes );
+        Cudd_RecursiveDeref( dd, bTemp );
+        Cudd_RecursiveDeref( dd, bXor );
+    }
+finish:
+    Vec_PtrForEachEntry( Aig_Obj_t *, pGroup->vNodes, pObj, i )
+    {
+        bTemp = (DdNode *)Vec_PtrEntry( vFuncs, Aig_ObjId(pObj) );
+        if ( bTemp == NULL )
+            break;
+        Cudd_RecursiveDeref( dd, bTemp );
+        Vec_PtrWriteEntry( vFuncs, Aig_ObjId(pObj), NULL );
+    }
+    if ( bRes )
+        Cudd_Deref( bRes );
+    return bRes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives quantification cube for the range of partitions.]
+
+  Description [Collects the variables whose first and last partitions
+  (given by pBegs and pEnds) are in the range [iLo, iHi], but not both
+  on the same side of iMid (if iMid is not -1). The next-state variables
+  and the variables appearing only among the current-state ones are not
+  quantified, as in the linear schedule of Llb_ManComputeImage().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+DdNode * Llb_ManConstructQuantCubeRange( Llb_Man_t * p, DdManager * dd, int * pBegs, int * pEnds, int iLo, int iMid, int iHi )
+{
+    DdNode * bRes, * bTemp;
+    int i;
+    abctime TimeStop;
+    TimeStop = dd->TimeStop; dd->TimeStop = 0;
+    bRes = Cudd_ReadOne( dd );   Cudd_Ref( bRes );
+    for ( i = 0; i < Vec_IntSize(p->vVar2Obj); i++ )
+    {
+        if ( pBegs[i] < iLo || pEnds[i] > iHi || pEnds[i] < 1 || pEnds[i] > p->pMatrix->nCols - 2 )
+            continue;
+        if ( iMid >= 0 && (pEnds[i] <= iMid || pBegs[i] > iMid) )
+            continue;
+        bRes = Cudd_bddAnd( dd, bTemp = bRes, Cudd_bddIthVar(dd, i) );  Cudd_Ref( bRes );
+        Cudd_RecursiveDeref( dd, bTemp );
+    }
+    Cudd_Deref( bRes );
+    dd->TimeStop = TimeStop;
+    return bRes;
+}
+
+// one task of the parallel image computation
+typedef struct Llb_ImgJob_t_ Llb_ImgJob_t;
+struct Llb_ImgJob_t_
+{
+    Llb_Man_t *     p;              // reachability manager (read-only)
+    int *           pBegs;          // the first partition of each variable
+    int *           pEnds;          // the last partition of each variable
+    DdNode *        bInit;          // the state set in the main manager
+    DdManager *     dd;             // the manager of this range
+    DdNode *        bFunc;          // the product of this range
+    DdNode *        bCare;          // the state set in this manager (or NULL)
+    DdManager *     dd2;            // the manager of the range to be merged (or NULL)
+    DdNode *        bFunc2;         // the product of the range to be merged
+    DdNode *        bCare2;         // the state set in the manager to be merged
+    int             iLo;            // the first partition of the range
+    int             iMid;           // the last partition of the first half
+    int             iHi;            // the last partition of the range
+};
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one task of the parallel image computation.]
+
+  Description [If there is no range to be merged, starts the manager of
+  the leaf with the variable order of the main manager, copies the state
+  set into it, derives the BDD of the partition, simplifies it using the
+  state set as the care set, and quantifies its internal variables. The
+  main manager is only read while the jobs are running. Otherwise, transfers the product of
+  the second range into the manager of the first one and computes their
+  conjunction while quantifying the variables that do not appear outside
+  of the merged range. The products of the ranges, which do not include
+  the state set itself, are simplified using it as the care set.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Llb_ManComputeImageParJob( void * pArg )
+{
+    Llb_ImgJob_t * pJob = (Llb_ImgJob_t *)pArg;
+    Llb_Man_t * p = pJob->p;
+    DdManager * dd = pJob->dd;
+    DdNode * bCube, * bFunc2, * bTemp;
+    if ( pJob->dd2 == NULL )
+    {
+        Vec_Ptr_t * vFuncs;
+        int i, k, Level, nVars = Vec_IntSize( p->vVar2Obj );
+        assert( pJob->iLo == pJob->iHi && dd == NULL );
+        // create the variables in the order of the main manager
+        // (Cudd_ShuffleHeap() updates global counters and is not thread-safe)
+        pJob->dd = dd = Cudd_Init( 0, 0, CUDD_UNIQUE_SLOTS, CUDD_CACHE_SLOTS / 64, 0 );
+        for ( i = 0; i < nVars; i++ )
+        {
+            for ( Level = k = 0; k < i; k++ )
+                Level += (Cudd_ReadPerm(p->dd, k) < Cudd_ReadPerm(p->dd, i));
+            Cudd_bddNewVarAtLevel( dd, Level );
+        }
+        Cudd_AutodynDisable( dd );
+        pJob->bCare = Cudd_bddTransfer( p->dd, dd, pJob->bInit );  Cudd_Ref( pJob->bCare );
+        dd->TimeStop = p->dd->TimeStop;
+        // the first leaf is the state set
+        if ( pJob->iLo == 0 )
+        {
+            pJob->bFunc = pJob->bCare;  Cudd_Ref( pJob->bFunc );
+            return 0;
+        }
+        vFuncs = Vec_PtrStart( Aig_ManObjNumMax(p->pAig) );
+        bTemp = Llb_ManConstructGroupBddPar( p, p->pMatrix->pColGrps[pJob->iLo], dd, vFuncs );
+        Vec_PtrFree( vFuncs );
+        if ( bTemp == NULL )
+            return 0;
+        Cudd_Ref( bTemp );
+        pJob->bFunc = Cudd_bddRestrict( dd, bFunc2 = bTemp, pJob->bCare );
+        Cudd_RecursiveDeref( dd, bFunc2 );
+        if ( pJob->bFunc == NULL )
+            return 0;
+        Cudd_Ref( pJob->bFunc );
+        bCube = Llb_ManConstructQuantCubeRange( p, dd, pJob->pBegs, pJob->pEnds, pJob->iLo, -1, pJob->iHi );  Cudd_Ref( bCube );
+        pJob->bFunc = Cudd_bddExistAbstract( dd, bTemp = pJob->bFunc, bCube );
+        if ( pJob->bFunc )
+            Cudd_Ref( pJob->bFunc );
+        Cudd_RecursiveDeref( dd, bTemp );
+        Cudd_RecursiveDeref( dd, bCube );
+        return 0;
+    }
+    // merge the second range
+    bFunc2 = NULL;
+    if ( pJob->bFunc && pJob->bFunc2 )
+    {
+        bFunc2 = Cudd_bddTransfer( pJob->dd2, dd, pJob->bFunc2 );
+        if ( bFunc2 )
+            Cudd_Ref( bFunc2 );
+    }
+    if ( pJob->bFunc2 )
+        Cudd_RecursiveDeref( pJob->dd2, pJob->bFunc2 );
+    Cudd_RecursiveDeref( pJob->dd2, pJob->bCare2 );
+    Cudd_Quit( pJob->dd2 );
+    pJob->dd2 = NULL;
+    pJob->bFunc2 = NULL;
+    pJob->bCare2 = NULL;
+    if ( bFunc2 == NULL )
+    {
+        if ( pJob->bFunc )
+            Cudd_RecursiveDeref( dd, pJob->bFunc );
+        pJob->bFunc = NULL;
+        return 0;
+    }
+    bCube = Llb_ManConstructQuantCubeRange( p, dd, pJob->pBegs, pJob->pEnds, pJob->iLo, pJob->iMid, pJob->iHi );  Cudd_Ref( bCube );
+    pJob->bFunc = Cudd_bddAndAbstract( dd, bTemp = pJob->bFunc, bFunc2, bCube );
+    if ( pJob->bFunc )
+        Cudd_Ref( pJob->bFunc );
+    Cudd_RecursiveDeref( dd, bTemp );
+    Cudd_RecursiveDeref( dd, bFunc2 );
+    Cudd_RecursiveDeref( dd, bCube );
+    if ( pJob->bFunc && pJob->iLo > 0 )
+    {
+        pJob->bFunc = Cudd_bddRestrict( dd, bTemp = pJob->bFunc, pJob->bCare );
+        if ( pJob->bFunc )
+            Cudd_Ref( pJob->bFunc );
+        Cudd_RecursiveDeref( dd, bTemp );
+    }
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes forward image using several threads.]
+
+  Description [The state set and the partitions become the leaves of
+  a balanced tree of relational products. Each leaf is computed in its
+  own BDD manager with the same variable order as the main one, and
+  the neighboring ranges are merged level by level, with the merges on
+  the same level running concurrently. Each variable is quantified in
+  the smallest range containing all partitions where it appears, so
+  the image is the same as the one computed by the linear schedule.
+  Dynamic reordering is disabled in the thread-local managers.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static DdNode * Llb_ManComputeImagePar( Llb_Man_t * p, DdNode * bInit )
+{
+    Vec_Ptr_t * vJobs, * vLevel;
+    Util_ThPool_t * pPool;
+    Llb_ImgJob_t * pJob, * pJob2;
+    DdNode * bRes = NULL, * bSupp, * bTemp;
+    int i, k, ObjId, nVars = Vec_IntSize(p->vVar2Obj);
+    int nLeaves = p->pMatrix->nCols - 1;
+    int * pBegs = ABC_ALLOC( int, nVars );
+    int * pEnds = ABC_ALLOC( int, nVars );
+    // the partitions of the variables (the state set is partition 0)
+    for ( i = 0; i < nVars; i++ )
+    {
+        ObjId = Vec_IntEntry( p->vVar2Obj, i );
+        pBegs[i] = Vec_IntEntry( p->vVarBegs, ObjId );
+        pEnds[i] = Vec_IntEntry( p->vVarEnds, ObjId );
+    }
+    bSupp = Cudd_Support( p->dd, bInit );   Cudd_Ref( bSupp );
+    for ( bTemp = bSupp; bTemp != Cudd_ReadOne(p->dd); bTemp = cuddT(bTemp) )
+        pBegs[bTemp->index] = 0;
+    Cudd_RecursiveDeref( p->dd, bSupp );
+    // the leaves (their managers are started by the jobs)
+    vLevel = Vec_PtrAlloc( nLeaves );
+    for ( i = 0; i < nLeaves; i++ )
+    {
+        pJob = ABC_CALLOC( Llb_ImgJob_t, 1 );
+        pJob->p     = p;
+        pJob->pBegs = pBegs;
+        pJob->pEnds = pEnds;
+        pJob->iLo   = pJob->iHi = i;
+        pJob->iMid  = -1;
+        pJob->bInit = bInit;
+        Vec_PtrPush( vLevel, pJob );
+    }
+    // compute the partitions
+    pPool = Util_ThPoolStart( Llb_ManComputeImageParJob, p->pPars->nProcs );
+    vJobs = Vec_PtrDup( vLevel );
+    Util_ThPoolRun( pPool, vJobs );
+    // merge the neighboring ranges
+    while ( Vec_PtrSize(vLevel) > 1 )
+    {
+        Vec_PtrClear( vJobs );
+        for ( i = k = 0; i < Vec_PtrSize(vLevel); i += 2 )
+        {
+            pJob = (Llb_ImgJob_t *)Vec_PtrEntry( vLevel, i );
+            Vec_PtrWriteEntry( vLevel, k++, pJob );
+            if ( i + 1 == Vec_PtrSize(vLevel) )
+                break;
+            pJob2 = (Llb_ImgJob_t *)Vec_PtrEntry( vLevel, i + 1 );
+            pJob->dd2    = pJob2->dd;
+            pJob->bFunc2 = pJob2->bFunc;
+            pJob->bCare2 = pJob2->bCare;
+            pJob->iMid   = pJob->iHi;
+            pJob->iHi    = pJob2->iHi;
+            ABC_FREE( pJob2 );
+            Vec_PtrPush( vJobs, pJob );
+        }
+        Vec_PtrShrink( vLevel, k );
+        Util_ThPoolRun( pPool, vJobs );
+    }
+    Util_ThPoolStop( pPool );
+    // transfer the image into the main manager
+    pJob = (Llb_ImgJob_t *)Vec_PtrEntry( vLevel, 0 );
+    if ( pJob->bFunc )
+    {
+        bRes = Cudd_bddTransfer( pJob->dd, p->dd, pJob->bFunc );
+        if ( bRes )
+            Cudd_Ref( bRes );
+        Cudd_RecursiveDeref( pJob->dd, pJob->bFunc );
+    }
+    Cudd_RecursiveDeref( pJob->dd, pJob->bCare );
+    Cudd_Quit( pJob->dd );
+    ABC_FREE( pJob );
+    Vec_PtrFree( vLevel );
+    Vec_PtrFree( vJobs );
+    ABC_FREE( pBegs );
+    ABC_FREE( pEnds );
+    if ( bRes )
+        Cudd_Deref( bRes );
+    return bRes;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -219,6 +219,7 @@ struct If_Man_t_
     Vec_Ptr_t *        vObjs;         // all objects
     Vec_Ptr_t *        vObjsRev;      // reverse topological order of objects
     Vec_Ptr_t *        vTemp;         // temporary array
+    Vec_Ptr_t *        vRefUndo;      // objects whose references were changed by the exact area evaluation
     int                nObjs[IF_VOID];// the number of objects by type
     // various data
     int                nLevelMax;     // the max number of AIG levels
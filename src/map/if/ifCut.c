@@ -1096,11 +1096,58 @@ float If_CutAreaRef( If_Man_t * p, If_Cut_t * pCut )
     return Area;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Computes area of the MFFC while recording the changes.]
+
+  Description [Similar to If_CutAreaRef() and If_CutAreaDeref() but saves
+  the leaves whose reference counters were updated in p->vRefUndo, so that
+  the original counters can be restored without traversing the MFFC again.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+float If_CutAreaRefLog_rec( If_Man_t * p, If_Cut_t * pCut )
+{
+    If_Obj_t * pLeaf;
+    float Area;
+    int i;
+    Area = If_CutLutArea(p, pCut);
+    If_CutForEachLeaf( p, pCut, pLeaf, i )
+    {
+        assert( pLeaf->nRefs >= 0 );
+        Vec_PtrPush( p->vRefUndo, pLeaf );
+        if ( pLeaf->nRefs++ > 0 || !If_ObjIsAnd(pLeaf) )
+            continue;
+        Area += If_CutAreaRefLog_rec( p, If_ObjCutBest(pLeaf) );
+    }
+    return Area;
+}
+float If_CutAreaDerefLog_rec( If_Man_t * p, If_Cut_t * pCut )
+{
+    If_Obj_t * pLeaf;
+    float Area;
+    int i;
+    Area = If_CutLutArea(p, pCut);
+    If_CutForEachLeaf( p, pCut, pLeaf, i )
+    {
+        assert( pLeaf->nRefs > 0 );
+        Vec_PtrPush( p->vRefUndo, pLeaf );
+        if ( --pLeaf->nRefs > 0 || !If_ObjIsAnd(pLeaf) )
+            continue;
+        Area += If_CutAreaDerefLog_rec( p, If_ObjCutBest(pLeaf) );
+    }
+    return Area;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Computes area of the first level.]
 
-  Description [The cut need to be derefed.]
+  Description [The cut need to be derefed. The MFFC is traversed once
+  and the reference counters are restored using the undo log.]
                
   SideEffects []
 
@@ -1109,13 +1156,15 @@ float If_CutAreaRef( If_Man_t * p, If_Cut_t * pCut )
 ***********************************************************************/
 float If_CutAreaDerefed( If_Man_t * p, If_Cut_t * pCut )
 {
-    float aResult, aResult2;
+    If_Obj_t * pLeaf;
+    float aResult;
+    int i;
     if ( pCut->nLeaves < 2 )
         return 0;
-    aResult2 = If_CutAreaRef( p, pCut );
-    aResult  = If_CutAreaDeref( p, pCut );
-    assert( aResult > aResult2 - 3*p->fEpsilon );
-    assert( aResult < aResult2 + 3*p->fEpsilon );
+    Vec_PtrClear( p->vRefUndo );
+    aResult = If_CutAreaRefLog_rec( p, pCut );
+    Vec_PtrForEachEntry( If_Obj_t *, p->vRefUndo, pLeaf, i )
+        pLeaf->nRefs--;
     return aResult;
 }
 
@@ -1132,13 +1181,15 @@ float If_CutAreaDerefed( If_Man_t * p, If_Cut_t * pCut )
 ***********************************************************************/
 float If_CutAreaRefed( If_Man_t * p, If_Cut_t * pCut )
 {
-    float aResult, aResult2;
+    If_Obj_t * pLeaf;
+    float aResult;
+    int i;
     if ( pCut->nLeaves < 2 )
         return 0;
-    aResult2 = If_CutAreaDeref( p, pCut );
-    aResult  = If_CutAreaRef( p, pCut );
-//    assert( aResult > aResult2 - p->fEpsilon );
-//    assert( aResult < aResult2 + p->fEpsilon );
+    Vec_PtrClear( p->vRefUndo );
+    aResult = If_CutAreaDerefLog_rec( p, pCut );
+    Vec_PtrForEachEntry( If_Obj_t *, p->vRefUndo, pLeaf, i )
+        pLeaf->nRefs++;
     return aResult;
 }
 
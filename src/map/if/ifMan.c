@@ -62,6 +62,7 @@ If_Man_t * If_ManStart( If_Par_t * pPars )
     p->vCos     = Vec_PtrAlloc( 100 );
     p->vObjs    = Vec_PtrAlloc( 100 );
     p->vTemp    = Vec_PtrAlloc( 100 );
+    p->vRefUndo = Vec_PtrAlloc( 100 );
     p->vVisited = Vec_PtrAlloc( 100 );
     // prepare the memory manager
     if ( p->pPars->fTruth )
@@ -446,6 +447,7 @@ void If_ManStop( If_Man_t * p )
     Vec_PtrFree( p->vCos );
     Vec_PtrFree( p->vObjs );
     Vec_PtrFree( p->vTemp );
+    Vec_PtrFree( p->vRefUndo );
     Vec_IntFreeP( &p->vCover );
     Vec_IntFreeP( &p->vArray );
     Vec_WrdFreeP( &p->vAnds );
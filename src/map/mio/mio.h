@@ -221,8 +221,8 @@ extern void              Mio_LibraryCleanProfile2( Mio_Library_t * pLib );
 extern void              Mio_LibraryShortNames( Mio_Library_t * pLib );
 
 extern void              Mio_LibraryMatchesStop( Mio_Library_t * pLib );
-extern void              Mio_LibraryMatchesStart( Mio_Library_t * pLib, int fPinFilter, int fPinPerm, int fPinQuick );
-extern void              Mio_LibraryMatchesFetch( Mio_Library_t * pLib, Vec_Mem_t ** pvTtMem, Vec_Wec_t ** pvTt2Match, Mio_Cell2_t ** ppCells, int * pnCells, int fPinFilter, int fPinPerm, int fPinQuick );
+extern void              Mio_LibraryMatchesStart( Mio_Library_t * pLib, int fPinFilter, int fPinPerm, int fPinQuick, int nProcs, char * pFileName, int fVerbose );
+extern void              Mio_LibraryMatchesFetch( Mio_Library_t * pLib, Vec_Mem_t ** pvTtMem, Vec_Wec_t ** pvTt2Match, Mio_Cell2_t ** ppCells, int * pnCells, int fPinFilter, int fPinPerm, int fPinQuick, int nProcs, char * pFileName, int fVerbose );
 
 extern void              Mio_LibraryMatches2Stop( Mio_Library_t * pLib );
 extern void              Mio_LibraryMatches2Start( Mio_Library_t * pLib );
@@ -1745,6 +1745,114 @@ void Mio_LibraryShortNames( Mio_Library_t * pLib )
     pLib->pName = Abc_UtilStrsav( Buffer );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Persistent match tables.]
+
+  Description [The match table derived for &nf depends only on the cells 
+  of the current library and on the pin-matching flags. It can be saved 
+  into a binary file and read back instead of being recomputed. The file 
+  is keyed by the hash of the cells (names, functions, areas, and pin delays) 
+  and the flags; when the key does not match, the table is derived anew 
+  and the file is overwritten.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define MIO_MATCH_MAGIC  "MIOMTCH1"
+
+static inline word Mio_LibraryMatchesKeyAdd( word Key, word Data ) { return (Key ^ Data) * ABC_CONST(0x100000001B3); }
+
+word Mio_LibraryMatchesKey( Mio_Cell2_t * pCells, int nCells, int fPinFilter, int fPinPerm, int fPinQuick )
+{
+    word Key = ABC_CONST(0xCBF29CE484222325);
+    int i, k; char * pName;
+    Key = Mio_LibraryMatchesKeyAdd( Key, (word)(fPinFilter | (fPinPerm << 1) | (fPinQuick << 2)) );
+    Key = Mio_LibraryMatchesKeyAdd( Key, (word)nCells );
+    for ( i = 0; i < nCells; i++ )
+    {
+        for ( pName = pCells[i].pName; pName && *pName; pName++ )
+            Key = Mio_LibraryMatchesKeyAdd( Key, (word)(unsigned char)*pName );
+        Key = Mio_LibraryMatchesKeyAdd( Key, (word)pCells[i].nFanins );
+        Key = Mio_LibraryMatchesKeyAdd( Key, pCells[i].uTruth );
+        Key = Mio_LibraryMatchesKeyAdd( Key, pCells[i].AreaW );
+        for ( k = 0; k < (int)pCells[i].nFanins; k++ )
+            Key = Mio_LibraryMatchesKeyAdd( Key, (word)(unsigned)pCells[i].iDelays[k] );
+    }
+    return Key;
+}
+void Mio_LibraryMatchesWrite( Mio_Library_t * pLib, char * pFileName, word Key )
+{
+    Vec_Int_t * vLevel;
+    int i, nFuncs = Vec_MemEntryNum( pLib->vTtMem ), Size;
+    FILE * pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open file \"%s\" for writing the match table.\n", pFileName );
+        return;
+    }
+    assert( nFuncs == Vec_WecSize(pLib->vTt2Match) );
+    fwrite( MIO_MATCH_MAGIC, 1, 8, pFile );
+    fwrite( &Key, sizeof(word), 1, pFile );
+    fwrite( &nFuncs, sizeof(int), 1, pFile );
+    for ( i = 0; i < nFuncs; i++ )
+        fwrite( Vec_MemReadEntry(pLib->vTtMem, i), sizeof(word), 1, pFile );
+    Vec_WecForEachLevel( pLib->vTt2Match, vLevel, i )
+    {
+        Size = Vec_IntSize( vLevel );
+        fwrite( &Size, sizeof(int), 1, pFile );
+        if ( Size )
+            fwrite( Vec_IntArray(vLevel), sizeof(int), Size, pFile );
+    }
+    // repeat the key to detect incomplete files
+    fwrite( &Key, sizeof(word), 1, pFile );
+    fclose( pFile );
+}
+int Mio_LibraryMatchesRead( Mio_Library_t * pLib, char * pFileName, word Key )
+{
+    char Magic[8];
+    word KeyFile = 0, uTruth;
+    int i, Size, nFuncs = 0, RetValue = 0;
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return 0;
+    assert( Vec_MemEntryNum(pLib->vTtMem) == 2 && Vec_WecSize(pLib->vTt2Match) == 2 );
+    if ( fread( Magic, 1, 8, pFile ) != 8 || strncmp(Magic, MIO_MATCH_MAGIC, 8) )
+        goto finish;
+    if ( fread( &KeyFile, sizeof(word), 1, pFile ) != 1 || KeyFile != Key )
+        goto finish;
+    if ( fread( &nFuncs, sizeof(int), 1, pFile ) != 1 || nFuncs < 2 )
+        goto finish;
+    for ( i = 0; i < nFuncs; i++ )
+        if ( fread( &uTruth, sizeof(word), 1, pFile ) != 1 || Vec_MemHashInsert(pLib->vTtMem, &uTruth) != i )
+            goto finish;
+    for ( i = 0; i < nFuncs; i++ )
+    {
+        Vec_Int_t * vLevel = i < 2 ? Vec_WecEntry(pLib->vTt2Match, i) : Vec_WecPushLevel(pLib->vTt2Match);
+        if ( fread( &Size, sizeof(int), 1, pFile ) != 1 || Size < 0 || (Size & 1) )
+            goto finish;
+        Vec_IntFill( vLevel, Size, 0 );
+        if ( Size && fread( Vec_IntArray(vLevel), sizeof(int), Size, pFile ) != (size_t)Size )
+            goto finish;
+    }
+    RetValue = fread( &KeyFile, sizeof(word), 1, pFile ) == 1 && KeyFile == Key;
+finish:
+    fclose( pFile );
+    if ( RetValue )
+        return 1;
+    // restore the empty table
+    Vec_MemHashFree( pLib->vTtMem );
+    Vec_MemFree( pLib->vTtMem );
+    Vec_WecFree( pLib->vTt2Match );
+    pLib->vTtMem    = Vec_MemAllocForTT( 6, 0 );          
+    pLib->vTt2Match = Vec_WecAlloc( 1000 ); 
+    Vec_WecPushLevel( pLib->vTt2Match );
+    Vec_WecPushLevel( pLib->vTt2Match );
+    return 0;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -1765,9 +1873,11 @@ void Mio_LibraryMatchesStop( Mio_Library_t * pLib )
     Vec_MemFree( pLib->vTtMem );
     ABC_FREE( pLib->pCells );
 }
-void Mio_LibraryMatchesStart( Mio_Library_t * pLib, int fPinFilter, int fPinPerm, int fPinQuick )
+void Mio_LibraryMatchesStart( Mio_Library_t * pLib, int fPinFilter, int fPinPerm, int fPinQuick, int nProcs, char * pFileName, int fVerbose )
 {
-    extern Mio_Cell2_t * Nf_StoDeriveMatches( Vec_Mem_t * vTtMem, Vec_Wec_t * vTt2Match, int * pnCells, int fPinFilter, int fPinPerm, int fPinQuick );
+    extern void Nf_StoDeriveMatches( Vec_Mem_t * vTtMem, Vec_Wec_t * vTt2Match, Mio_Cell2_t * pCells, int nCells, int fPinFilter, int fPinPerm, int fPinQuick, int nProcs );
+    abctime clk = Abc_Clock();
+    word Key;
     if ( pLib->vTtMem && pLib->fPinFilter == fPinFilter && pLib->fPinPerm == fPinPerm && pLib->fPinQuick == fPinQuick )
         return;
     if ( pLib->vTtMem )
@@ -1780,11 +1890,28 @@ void Mio_LibraryMatchesStart( Mio_Library_t * pLib, int fPinFilter, int fPinPerm
     Vec_WecPushLevel( pLib->vTt2Match );
     Vec_WecPushLevel( pLib->vTt2Match );
     assert( Vec_WecSize(pLib->vTt2Match) == Vec_MemEntryNum(pLib->vTtMem) );
-    pLib->pCells = Nf_StoDeriveMatches( pLib->vTtMem, pLib->vTt2Match, &pLib->nCells, fPinFilter, fPinPerm, fPinQuick );
+    pLib->pCells = Mio_CollectRootsNewDefault2( 6, &pLib->nCells, 0 );
+    if ( pLib->pCells == NULL )
+        return;
+    Key = Mio_LibraryMatchesKey( pLib->pCells, pLib->nCells, fPinFilter, fPinPerm, fPinQuick );
+    if ( pFileName && Mio_LibraryMatchesRead( pLib, pFileName, Key ) )
+    {
+        if ( fVerbose )
+            Abc_PrintTime( 1, "Match table was read from file", Abc_Clock() - clk );
+        return;
+    }
+    Nf_StoDeriveMatches( pLib->vTtMem, pLib->vTt2Match, pLib->pCells, pLib->nCells, fPinFilter, fPinPerm, fPinQuick, nProcs );
+    if ( fVerbose )
+    {
+        printf( "Match table was derived using %d thread%s.  ", Abc_MaxInt(1, nProcs), nProcs > 1 ? "s":"" );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    if ( pFileName )
+        Mio_LibraryMatchesWrite( pLib, pFileName, Key );
 }
-void Mio_LibraryMatchesFetch( Mio_Library_t * pLib, Vec_Mem_t ** pvTtMem, Vec_Wec_t ** pvTt2Match, Mio_Cell2_t ** ppCells, int * pnCells, int fPinFilter, int fPinPerm, int fPinQuick )
+void Mio_LibraryMatchesFetch( Mio_Library_t * pLib, Vec_Mem_t ** pvTtMem, Vec_Wec_t ** pvTt2Match, Mio_Cell2_t ** ppCells, int * pnCells, int fPinFilter, int fPinPerm, int fPinQuick, int nProcs, char * pFileName, int fVerbose )
 {
-    Mio_LibraryMatchesStart( pLib, fPinFilter, fPinPerm, fPinQuick );
+    Mio_LibraryMatchesStart( pLib, fPinFilter, fPinPerm, fPinQuick, nProcs, pFileName, fVerbose );
     *pvTtMem    = pLib->vTtMem;     // truth tables
     *pvTt2Match = pLib->vTt2Match;  // matches for truth tables
     *ppCells    = pLib->pCells;     // library gates
@@ -1066,10 +1066,11 @@ int Scl_CommandBuffer( Abc_Frame_t * pAbc, int argc, char ** argv )
     pPars->fAddBufs      =    1;
     pPars->fBufPis       =    0;
     pPars->fUseWireLoads =    0;
+    pPars->nProcs        =    1;
     pPars->fVerbose      =    0;
     pPars->fVeryVerbose  =    0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "GSNsbpcvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "GSNPsbpcvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -1106,6 +1107,17 @@ int Scl_CommandBuffer( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nDegree < 0 ) 
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by a positive integer.\n" );
+                goto usage;
+            }
+            pPars->nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nProcs < 1 || pPars->nProcs > 100 ) 
+                goto usage;
+            break;
         case 's':
             pPars->fSizeOnly ^= 1;
             break;
@@ -1163,11 +1175,12 @@ int Scl_CommandBuffer( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: buffer [-GSN num] [-sbpcvwh]\n" );
+    fprintf( pAbc->Err, "usage: buffer [-GSNP num] [-sbpcvwh]\n" );
     fprintf( pAbc->Err, "\t           performs buffering and sizing on mapped network\n" );
     fprintf( pAbc->Err, "\t-G <num> : target gain percentage [default = %d]\n", pPars->GainRatio );
     fprintf( pAbc->Err, "\t-S <num> : target slew in picoseconds [default = %d]\n", pPars->Slew );
     fprintf( pAbc->Err, "\t-N <num> : the maximum fanout count [default = %d]\n", pPars->nDegree );
+    fprintf( pAbc->Err, "\t-P <num> : the number of concurrent threads (1 <= num <= 100) [default = %d]\n", pPars->nProcs );
     fprintf( pAbc->Err, "\t-s       : toggle performing only sizing [default = %s]\n", pPars->fSizeOnly? "yes": "no" );
     fprintf( pAbc->Err, "\t-b       : toggle using buffers instead of inverters [default = %s]\n", pPars->fAddBufs? "yes": "no" );
     fprintf( pAbc->Err, "\t-p       : toggle buffering primary inputs [default = %s]\n", pPars->fBufPis? "yes": "no" );
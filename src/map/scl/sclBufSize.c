@@ -49,6 +49,40 @@ struct Bus_Man_t_
     Vec_Ptr_t *    vFanouts;   // fanout array
 };
 
+// fanout of a node as seen by the local timing analysis
+typedef struct Bus_Fan_t_ Bus_Fan_t;
+struct Bus_Fan_t_
+{
+    int            Lit;        // (ObjId, 0) for the old fanout; (InvId, 1) for the new inverter
+    int            fCo;        // the fanout is a combinational output
+    float          ETime;      // fanout edge departure
+    float          Cin;        // fanout input cap
+};
+
+// buffer tree of one node derived independently of other nodes
+typedef struct Bus_Plan_t_ Bus_Plan_t;
+struct Bus_Plan_t_
+{
+    Abc_Obj_t *    pObj;       // the node
+    float          Load;       // the node load after buffering
+    int            nInvs;      // the number of new inverters
+    Vec_Int_t *    vInvs;      // inverters: cell ID, fanout count, fanout literals
+    Vec_Flt_t *    vTimes;     // inverters: departure, load, input cap, edge departure
+    Vec_Int_t *    vRoots;     // fanout literals remaining at the node
+};
+
+// planning job processed by one thread
+typedef struct Bus_Job_t_ Bus_Job_t;
+struct Bus_Job_t_
+{
+    Bus_Man_t *    pMan;       // buffering manager
+    Bus_Plan_t *   pPlans;     // the plans of the current wave
+    int            iStart;     // the first plan of this job
+    int            iStop;      // the last plan of this job
+    float          GainGate;   // gain for the gates
+    float          GainInv;    // gain for the inverters
+    Bus_Fan_t *    pFans;      // fanout storage
+};
 
 static inline Bus_Man_t * Bus_SclObjMan( Abc_Obj_t * p )                     { return (Bus_Man_t *)p->pNtk->pBSMan;                                  }
 static inline float       Bus_SclObjCin( Abc_Obj_t * p )                     { return Vec_FltEntry( Bus_SclObjMan(p)->vCins, Abc_ObjId(p) );         }
@@ -488,6 +522,376 @@ void Abc_SclBufSize( Bus_Man_t * p, float Gain )
         Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
     }
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the buffer tree of one node using local timing.]
+
+  Description [Mirrors the loop in Abc_SclBufSize() but keeps the timing
+  of the fanouts and of the new inverters in the thread-local array pFans
+  instead of the global arrays of the manager. The network is not modified.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Bus_SclCompareFans( Bus_Fan_t * p1, Bus_Fan_t * p2 )
+{
+    if ( p1->ETime < p2->ETime )
+        return -1;
+    if ( p1->ETime > p2->ETime )
+        return 1;
+    if ( p1->Cin > p2->Cin )
+        return -1;
+    if ( p1->Cin < p2->Cin )
+        return 1;
+    return -1;
+}
+static inline float Bus_SclFansLoad( Bus_Man_t * p, Bus_Fan_t * pFans, int nFans )
+{
+    float Load = Abc_SclFindWireLoad( p->vWireCaps, nFans );
+    int i;
+    for ( i = 0; i < nFans; i++ )
+        Load += pFans[i].Cin;
+    return Load;
+}
+void Abc_SclBufPlanNode( Bus_Man_t * p, Bus_Plan_t * pPlan, Bus_Fan_t * pFans, float GainGate, float GainInv )
+{
+    Abc_Obj_t * pObj = pPlan->pObj, * pFanout;
+    SC_Cell * pCell, * pCellNew;
+    Bus_Fan_t * pFan, Fan;
+    float Target = SC_CellPinCap(p->pInv, 0) * GainInv;
+    float Load, LoadInv, Cin, Dept;
+    int i, k, iStop, Limit, nFans = 0;
+    // compute fanout info (similar to Abc_NtkComputeFanoutInfo)
+    Abc_ObjForEachFanout( pObj, pFanout, i )
+    {
+        pFan = pFans + nFans++;
+        pFan->Lit = Abc_Var2Lit( Abc_ObjId(pFanout), 0 );
+        pFan->fCo = Abc_ObjIsCo(pFanout);
+        if ( Abc_ObjIsBarBuf(pFanout) )
+        {
+            pFan->ETime = Bus_SclObjDept(pFanout);
+            pFan->Cin   = Bus_SclObjLoad(pFanout);
+        }
+        else if ( !Abc_ObjIsCo(pFanout) )
+        {
+            int iFanin  = Abc_NodeFindFanin(pFanout, pObj);
+            pFan->ETime = Abc_NtkComputeEdgeDept(pFanout, iFanin, p->pPars->Slew);
+            pFan->Cin   = SC_CellPinCap( Abc_SclObjCell(pFanout), iFanin );
+        }
+        else
+        {
+            pFan->ETime = Bus_SclObjETime(pFanout);
+            pFan->Cin   = Bus_SclObjCin(pFanout);
+        }
+    }
+    Load = Bus_SclFansLoad( p, pFans, nFans );
+    pPlan->Load = Load;
+    pPlan->nInvs = 0;
+    // consider the gate
+    if ( Abc_ObjIsCi(pObj) || Abc_ObjIsBarBuf(pObj) )
+    {
+        pCell = p->pPiDrive;
+        Cin = pCell ? SC_CellPinCapAve(pCell) : Load;
+    }
+    else
+    {
+        pCell = Abc_SclObjCell( pObj );
+        Cin = SC_CellPinCapAve( pCell->pAve );
+    }
+    if ( p->pPars->fSizeOnly || !(nFans > p->pPars->nDegree || Load > GainGate * Cin) )
+        return;
+    // add one or more inverters (similar to Abc_SclAddOneInv)
+    qsort( (void *)pFans, (size_t)nFans, sizeof(Bus_Fan_t), (int(*)(const void *, const void *))Bus_SclCompareFans );
+    do
+    {
+        LoadInv = 0;
+        Limit = Abc_MinInt( p->pPars->nDegree, nFans );
+        for ( iStop = 0; iStop < Limit; iStop++ )
+        {
+            LoadInv += pFans[iStop].Cin - Abc_SclFindWireLoad( p->vWireCaps, iStop ) + Abc_SclFindWireLoad( p->vWireCaps, iStop+1 );
+            if ( LoadInv > Target )
+            {
+                iStop++;
+                break;
+            }
+        }
+        Limit = Abc_MinInt( Abc_MaxInt(iStop, 2), nFans );
+        pCellNew = Abc_SclFindSmallestGate( p->pInv, LoadInv / GainInv );
+        // record the inverter and its fanouts
+        Dept = 0;
+        Vec_IntPush( pPlan->vInvs, pCellNew->Id );
+        Vec_IntPush( pPlan->vInvs, Limit );
+        for ( k = 0; k < Limit; k++ )
+        {
+            Vec_IntPush( pPlan->vInvs, pFans[k].Lit );
+            if ( !pFans[k].fCo )
+                Dept = Abc_MaxFloat( Dept, pFans[k].ETime );
+        }
+        Fan.Lit   = Abc_Var2Lit( pPlan->nInvs++, 1 );
+        Fan.fCo   = 0;
+        Fan.Cin   = SC_CellPinCap( pCellNew, 0 );
+        LoadInv   = Bus_SclFansLoad( p, pFans, Limit );
+        Fan.ETime = Dept + Scl_LibPinArrivalEstimate( pCellNew, 0, p->pPars->Slew, LoadInv );
+        Vec_FltPush( pPlan->vTimes, Dept );
+        Vec_FltPush( pPlan->vTimes, LoadInv );
+        Vec_FltPush( pPlan->vTimes, Fan.Cin );
+        Vec_FltPush( pPlan->vTimes, Fan.ETime );
+        // replace the fanouts by the inverter (similar to Bus_SclInsertFanout)
+        memmove( pFans, pFans + Limit, sizeof(Bus_Fan_t) * (nFans - Limit) );
+        nFans -= Limit;
+        pFans[nFans++] = Fan;
+        for ( i = nFans - 1; i > 0; i-- )
+        {
+            if ( Bus_SclCompareFans( pFans + i - 1, pFans + i ) == -1 )
+                break;
+            ABC_SWAP( Bus_Fan_t, pFans[i-1], pFans[i] );
+        }
+        Load = Bus_SclFansLoad( p, pFans, nFans );
+    }
+    while ( nFans > p->pPars->nDegree || (nFans > 1 && Load > GainGate * Cin) );
+    pPlan->Load = Load;
+    for ( i = 0; i < nFans; i++ )
+        Vec_IntPush( pPlan->vRoots, pFans[i].Lit );
+}
+int Abc_SclBufPlanJob( void * pArg )
+{
+    Bus_Job_t * pJob = (Bus_Job_t *)pArg;
+    int i;
+    for ( i = pJob->iStart; i < pJob->iStop; i++ )
+        Abc_SclBufPlanNode( pJob->pMan, pJob->pPlans + i, pJob->pFans, pJob->GainGate, pJob->GainInv );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the buffer tree of one node to the network.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclBufApplyPlan( Bus_Man_t * p, Bus_Plan_t * pPlan, Vec_Ptr_t * vInvs )
+{
+    Abc_Obj_t * pObj = pPlan->pObj, * pFanout, * pInv;
+    float * pTimes = Vec_FltArray( pPlan->vTimes );
+    int i, k, Lit, nFans, iCell, iInv, Index = 0;
+    Vec_PtrClear( vInvs );
+    for ( iInv = 0; iInv < pPlan->nInvs; iInv++, pTimes += 4 )
+    {
+        iCell = Vec_IntEntry( pPlan->vInvs, Index++ );
+        nFans = Vec_IntEntry( pPlan->vInvs, Index++ );
+        if ( p->pPars->fAddBufs )
+            pInv = Abc_NtkCreateNodeBuf( p->pNtk, NULL );
+        else
+            pInv = Abc_NtkCreateNodeInv( p->pNtk, NULL );
+        Vec_PtrPush( vInvs, pInv );
+        assert( (int)Abc_ObjId(pInv) == Vec_FltSize(p->vCins) );
+        Vec_FltPush( p->vCins,   pTimes[2] );
+        Vec_FltPush( p->vETimes, pTimes[3] );
+        Vec_FltPush( p->vLoads,  pTimes[1] );
+        Vec_FltPush( p->vDepts,  pTimes[0] );
+        for ( k = 0; k < nFans; k++ )
+        {
+            Lit = Vec_IntEntry( pPlan->vInvs, Index++ );
+            if ( Abc_LitIsCompl(Lit) )
+                Abc_ObjAddFanin( (Abc_Obj_t *)Vec_PtrEntry(vInvs, Abc_Lit2Var(Lit)), pInv );
+            else
+                Abc_ObjPatchFanin( Abc_NtkObj(p->pNtk, Abc_Lit2Var(Lit)), pObj, pInv );
+        }
+        Vec_IntSetEntry( p->pNtk->vGates, Abc_ObjId(pInv), iCell );
+        if ( p->pNtk->vPhases && Abc_SclIsInv(pInv) )
+            Abc_NodeInvUpdateFanPolarity( pInv );
+    }
+    assert( Index == Vec_IntSize(pPlan->vInvs) );
+    Vec_IntForEachEntry( pPlan->vRoots, Lit, i )
+        if ( Abc_LitIsCompl(Lit) )
+        {
+            pFanout = (Abc_Obj_t *)Vec_PtrEntry( vInvs, Abc_Lit2Var(Lit) );
+            Abc_ObjAddFanin( pFanout, pObj );
+        }
+    Bus_SclObjSetLoad( pObj, pPlan->Load );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Multi-threaded version of Abc_SclBufSize().]
+
+  Description [The nodes are divided into waves such that the fanouts of
+  each node belong to the previous waves. The buffer trees of the nodes in
+  one wave are derived concurrently using only the timing information of
+  their fanouts, which is final at this point. The trees are added to the
+  network wave by wave, and in the decreasing order of object IDs within
+  each wave. This order does not depend on the number of threads, but it
+  differs from the reverse topological order of Abc_SclBufSize(), so the
+  result may differ from the single-threaded version.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclBufSizePar( Bus_Man_t * p, float Gain )
+{
+    Bus_Job_t * pJobs;
+    Bus_Plan_t * pPlans;
+    SC_Cell * pCell, * pCellNew;
+    Abc_Obj_t * pObj, * pFanout;
+    Vec_Ptr_t * vJobs, * vInvs;
+    Vec_Int_t * vWave, * vLevel;
+    Vec_Wec_t * vWaves;
+    abctime clk = Abc_Clock();
+    int i, k, w, Entry, nWaveLimit = 1000, nWavesPar = 0, fFinished = 1;
+    int nObjsOld = Abc_NtkObjNumMax(p->pNtk), nFanMax = 0;
+    int nJobs = Abc_MaxInt( 1, p->pPars->nProcs );
+    float GainGate, GainInv, DeptMax = 0;
+    GainGate = p->pPars->fAddBufs ? (float)pow( (double)Gain, (double)2.0 ) : Gain;
+    GainInv  = p->pPars->fAddBufs ? (float)pow( (double)Gain, (double)2.0 ) : Gain;
+    // divide the nodes into waves
+    vLevel = Vec_IntStartFull( nObjsOld );
+    vWaves = Vec_WecAlloc( 100 );
+    Abc_NtkForEachObjReverse( p->pNtk, pObj, i )
+    {
+        if ( !((Abc_ObjIsNode(pObj) && Abc_ObjFaninNum(pObj) > 0) || (Abc_ObjIsCi(pObj) && p->pPiDrive)) )
+            continue;
+        nFanMax = Abc_MaxInt( nFanMax, Abc_ObjFanoutNum(pObj) );
+        w = 0;
+        Abc_ObjForEachFanout( pObj, pFanout, k )
+            if ( Vec_IntEntry(vLevel, Abc_ObjId(pFanout)) >= 0 )
+                w = Abc_MaxInt( w, Vec_IntEntry(vLevel, Abc_ObjId(pFanout)) + 1 );
+        Vec_IntWriteEntry( vLevel, i, w );
+        Vec_WecPush( vWaves, w, i );
+    }
+    Vec_IntFree( vLevel );
+    // prepare planning jobs
+    pPlans = ABC_CALLOC( Bus_Plan_t, Vec_WecMaxLevelSize(vWaves) + 1 );
+    pJobs  = ABC_CALLOC( Bus_Job_t, nJobs );
+    vJobs  = Vec_PtrAlloc( nJobs );
+    for ( k = 0; k < nJobs; k++ )
+    {
+        pJobs[k].pMan     = p;
+        pJobs[k].pPlans   = pPlans;
+        pJobs[k].GainGate = GainGate;
+        pJobs[k].GainInv  = GainInv;
+        pJobs[k].pFans    = ABC_ALLOC( Bus_Fan_t, nFanMax + 1 );
+    }
+    vInvs = Vec_PtrAlloc( 100 );
+    Vec_WecForEachLevel( vWaves, vWave, w )
+    {
+        // derive the buffer trees
+        Vec_IntForEachEntry( vWave, Entry, i )
+        {
+            Bus_Plan_t * pPlan = pPlans + i;
+            pPlan->pObj = Abc_NtkObj( p->pNtk, Entry );
+            if ( pPlan->vInvs == NULL )
+            {
+                pPlan->vInvs  = Vec_IntAlloc( 16 );
+                pPlan->vTimes = Vec_FltAlloc( 16 );
+                pPlan->vRoots = Vec_IntAlloc( 16 );
+            }
+            Vec_IntClear( pPlan->vInvs );
+            Vec_FltClear( pPlan->vTimes );
+            Vec_IntClear( pPlan->vRoots );
+        }
+        if ( nJobs > 1 && Vec_IntSize(vWave) >= nWaveLimit )
+        {
+            Vec_PtrClear( vJobs );
+            for ( k = 0; k < nJobs; k++ )
+            {
+                pJobs[k].iStart = k * Vec_IntSize(vWave) / nJobs;
+                pJobs[k].iStop  = (k + 1) * Vec_IntSize(vWave) / nJobs;
+                Vec_PtrPush( vJobs, pJobs + k );
+            }
+            Util_ProcessThreads( Abc_SclBufPlanJob, vJobs, nJobs, 0, 0 );
+            nWavesPar++;
+        }
+        else
+        {
+            pJobs[0].iStart = 0;
+            pJobs[0].iStop  = Vec_IntSize(vWave);
+            Abc_SclBufPlanJob( pJobs );
+        }
+        // update the network
+        Vec_IntForEachEntry( vWave, Entry, i )
+        {
+            pObj = pPlans[i].pObj;
+            if ( 2 * nObjsOld < Abc_NtkObjNumMax(p->pNtk) )
+            {
+                printf( "Buffering could not be completed because the gain value (%d) is too low.\n", p->pPars->GainRatio );
+                fFinished = 0;
+                break;
+            }
+            Abc_SclBufApplyPlan( p, pPlans + i, vInvs );
+            if ( Abc_ObjIsCi(pObj) )
+                continue;
+            Abc_NtkComputeNodeDeparture( pObj, p->pPars->Slew );
+            if ( Abc_ObjIsBarBuf(pObj) )
+                continue;
+            pCell = Abc_SclObjCell( pObj );
+            pCellNew = Abc_SclFindSmallestGate( pCell, pPlans[i].Load / GainGate );
+            Abc_SclObjSetCell( pObj, pCellNew );
+            if ( p->pPars->fVeryVerbose )
+                Abc_SclOneNodePrint( p, pObj );
+            assert( p->pPars->fSizeOnly || Abc_ObjFanoutNum(pObj) <= p->pPars->nDegree );
+        }
+        if ( !fFinished )
+            break;
+    }
+    // compute departure time of the PI
+    if ( fFinished )
+    Abc_NtkForEachCi( p->pNtk, pObj, i )
+    {
+        float DeptCur = Abc_NtkComputeNodeDeparture(pObj, p->pPars->Slew);
+        if ( p->pPiDrive )
+        {
+            float Load = Bus_SclObjLoad( pObj );
+            SC_Pair ArrOut, SlewOut, LoadIn = { Load, Load };
+            Scl_LibHandleInputDriver( p->pPiDrive, &LoadIn, &ArrOut, &SlewOut );
+            DeptCur += 0.5 * ArrOut.fall +  0.5 * ArrOut.rise;
+        }
+        DeptMax = Abc_MaxFloat( DeptMax, DeptCur );
+    }
+    if ( p->pPars->fVerbose )
+    {
+        printf( "WireLoads = %d  Degree = %d  Target slew =%4d ps   Gain2 =%5d  Buf = %6d  Delay =%7.0f ps   ",
+            p->pPars->fUseWireLoads, p->pPars->nDegree, p->pPars->Slew, p->pPars->GainRatio,
+            Abc_NtkObjNumMax(p->pNtk) - nObjsOld, DeptMax );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+        printf( "Threads = %d  Waves = %d  Parallel waves = %d  Max wave = %d\n",
+            nJobs, Vec_WecSize(vWaves), nWavesPar, Vec_WecMaxLevelSize(vWaves) );
+    }
+    // cleanup
+    for ( k = 0; k < nJobs; k++ )
+        ABC_FREE( pJobs[k].pFans );
+    for ( i = 0; i <= Vec_WecMaxLevelSize(vWaves); i++ )
+    {
+        Vec_IntFreeP( &pPlans[i].vInvs );
+        Vec_FltFreeP( &pPlans[i].vTimes );
+        Vec_IntFreeP( &pPlans[i].vRoots );
+    }
+    ABC_FREE( pPlans );
+    ABC_FREE( pJobs );
+    Vec_PtrFree( vJobs );
+    Vec_PtrFree( vInvs );
+    Vec_WecFree( vWaves );
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
 Abc_Ntk_t * Abc_SclBufferingPerform( Abc_Ntk_t * pNtk, SC_Lib * pLib, SC_BusPars * pPars )
 {
     Abc_Ntk_t * pNtkNew;
@@ -498,7 +902,10 @@ Abc_Ntk_t * Abc_SclBufferingPerform( Abc_Ntk_t * pNtk, SC_Lib * pLib, SC_BusPars
     Abc_SclMioGates2SclGates( pLib, pNtk );
     p = Bus_ManStart( pNtk, pLib, pPars );
     Bus_ManReadInOutLoads( p );
-    Abc_SclBufSize( p, 0.01 * pPars->GainRatio );
+    if ( pPars->nProcs > 1 )
+        Abc_SclBufSizePar( p, 0.01 * pPars->GainRatio );
+    else
+        Abc_SclBufSize( p, 0.01 * pPars->GainRatio );
     Bus_ManStop( p );
     Abc_SclSclGates2MioGates( pLib, pNtk );
     if ( pNtk->vPhases )
@@ -109,6 +109,7 @@ struct SC_BusPars_
     int        fAddBufs;        // add buffers
     int        fBufPis;         // use CI buffering
     int        fUseWireLoads;   // wire loads
+    int        nProcs;          // the number of threads
     int        fVerbose;        // verbose
     int        fVeryVerbose;    // verbose
 };
@@ -127,7 +127,9 @@ char * Nm_ManStoreIdName( Nm_Man_t * p, int ObjId, int Type, char * pName, char
     pEntry->pNextI2N = pEntry->pNextN2I = pEntry->pNameSake = NULL;
     pEntry->ObjId = ObjId;
     pEntry->Type = Type;
-    sprintf( pEntry->Name, "%s%s", pName, pSuffix? pSuffix : "" );
+    strcpy( pEntry->Name, pName );
+    if ( pSuffix )
+        strcat( pEntry->Name, pSuffix );
     // add the entry to the hash table
     RetValue = Nm_ManTableAdd( p, pEntry );
     assert( RetValue == 1 );
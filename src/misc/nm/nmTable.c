@@ -30,12 +30,8 @@ ABC_NAMESPACE_IMPL_START
 // hashing for integers
 static unsigned Nm_HashNumber( int Num, int TableSize ) 
 {
-    unsigned Key = 0;
-    Key ^= ( Num        & 0xFF) * 7937;
-    Key ^= ((Num >>  8) & 0xFF) * 2971;
-    Key ^= ((Num >> 16) & 0xFF) * 911;
-    Key ^= ((Num >> 24) & 0xFF) * 353;
-    return Key % TableSize;
+    // object IDs are dense, so consecutive IDs are placed into consecutive bins
+    return (unsigned)Num % TableSize;
 }
 
 // hashing for strings
@@ -555,6 +555,10 @@ extern word     Abc_RandomW( int fReset );
 
 // pthreads
 extern void Util_ProcessThreads( int (*pUserFunc)(void *), void * vData, int nProcs, int TimeOut, int fVerbose );
+typedef struct Util_ThPool_t_ Util_ThPool_t;
+extern Util_ThPool_t * Util_ThPoolStart( int (*pUserFunc)(void *), int nProcs );
+extern void            Util_ThPoolRun( Util_ThPool_t * p, void * vData );
+extern void            Util_ThPoolStop( Util_ThPool_t * p );
 
 ABC_NAMESPACE_HEADER_END
 
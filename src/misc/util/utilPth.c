@@ -74,6 +74,28 @@ void Util_ProcessThreads( int (*pUserFunc)(void *), void * vData, int nProcs, in
         pUserFunc( pData );
 }
 
+struct Util_ThPool_t_
+{
+    int        (*pUserFunc)(void *);
+};
+
+Util_ThPool_t * Util_ThPoolStart( int (*pUserFunc)(void *), int nProcs )
+{
+    Util_ThPool_t * p = ABC_CALLOC( Util_ThPool_t, 1 );
+    p->pUserFunc = pUserFunc;
+    return p;
+}
+void Util_ThPoolRun( Util_ThPool_t * p, void * vData )
+{
+    void * pData; int i;
+    Vec_PtrForEachEntry( void *, (Vec_Ptr_t *)vData, pData, i )
+        p->pUserFunc( pData );
+}
+void Util_ThPoolStop( Util_ThPool_t * p )
+{
+    ABC_FREE( p );
+}
+
 #else // pthreads are used
 
 #define PAR_THR_MAX 100
@@ -180,6 +202,120 @@ void Util_ProcessThreads( int (*pUserFunc)(void *), void * vData, int nProcs, in
     //    Abc_PrintTime( 1, "Time", Abc_Clock() - clkStart );    
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Thread pool reused by several rounds of jobs.]
+
+  Description [Util_ProcessThreads() creates and joins the threads and
+  polls them with 10 ms pauses, which is too slow for the engines that
+  dispatch many small rounds of jobs. The pool keeps nProcs-1 workers
+  blocked on a condition variable between the calls of Util_ThPoolRun(),
+  which returns when all the entries of vData have been processed. Same
+  as Util_ProcessThreads(), nProcs <= 2 runs the jobs on the calling
+  thread.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+struct Util_ThPool_t_
+{
+    int        (*pUserFunc)(void *);
+    int          nThreads;    // the number of workers
+    pthread_t    Threads[PAR_THR_MAX];
+    pthread_mutex_t Mutex;
+    pthread_cond_t  CondWork; // signals a new round or the stop
+    pthread_cond_t  CondDone; // signals the end of the round
+    Vec_Ptr_t *  vData;       // the jobs of the current round
+    int          iNext;       // the next job to be taken
+    int          nDone;       // the number of finished jobs
+    int          iRound;      // the round counter
+    int          fStop;       // the workers should exit
+};
+
+static void * Util_ThPoolWorker( void * pArg )
+{
+    Util_ThPool_t * p = (Util_ThPool_t *)pArg;
+    int iRound = 0;
+    pthread_mutex_lock( &p->Mutex );
+    while ( 1 )
+    {
+        while ( !p->fStop && p->iRound == iRound )
+            pthread_cond_wait( &p->CondWork, &p->Mutex );
+        if ( p->fStop )
+            break;
+        iRound = p->iRound;
+        while ( p->vData && p->iNext < Vec_PtrSize(p->vData) )
+        {
+            void * pData = Vec_PtrEntry( p->vData, p->iNext++ );
+            pthread_mutex_unlock( &p->Mutex );
+            p->pUserFunc( pData );
+            pthread_mutex_lock( &p->Mutex );
+            if ( ++p->nDone == Vec_PtrSize(p->vData) )
+                pthread_cond_signal( &p->CondDone );
+        }
+    }
+    pthread_mutex_unlock( &p->Mutex );
+    return NULL;
+}
+Util_ThPool_t * Util_ThPoolStart( int (*pUserFunc)(void *), int nProcs )
+{
+    Util_ThPool_t * p = ABC_CALLOC( Util_ThPool_t, 1 );
+    int i, status;
+    p->pUserFunc = pUserFunc;
+    if ( nProcs <= 2 )
+        return p;
+    p->nThreads = Abc_MinInt( nProcs - 1, PAR_THR_MAX );
+    pthread_mutex_init( &p->Mutex, NULL );
+    pthread_cond_init( &p->CondWork, NULL );
+    pthread_cond_init( &p->CondDone, NULL );
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        status = pthread_create( p->Threads + i, NULL, Util_ThPoolWorker, (void *)p );  assert( status == 0 );
+    }
+    return p;
+}
+void Util_ThPoolRun( Util_ThPool_t * p, void * vData )
+{
+    if ( p->nThreads == 0 )
+    {
+        void * pData; int i;
+        Vec_PtrForEachEntry( void *, (Vec_Ptr_t *)vData, pData, i )
+            p->pUserFunc( pData );
+        return;
+    }
+    if ( Vec_PtrSize((Vec_Ptr_t *)vData) == 0 )
+        return;
+    fflush( stdout );
+    pthread_mutex_lock( &p->Mutex );
+    p->vData = (Vec_Ptr_t *)vData;
+    p->iNext = p->nDone = 0;
+    p->iRound++;
+    pthread_cond_broadcast( &p->CondWork );
+    while ( p->nDone < Vec_PtrSize(p->vData) )
+        pthread_cond_wait( &p->CondDone, &p->Mutex );
+    p->vData = NULL;
+    pthread_mutex_unlock( &p->Mutex );
+}
+void Util_ThPoolStop( Util_ThPool_t * p )
+{
+    int i;
+    if ( p->nThreads > 0 )
+    {
+        pthread_mutex_lock( &p->Mutex );
+        p->fStop = 1;
+        pthread_cond_broadcast( &p->CondWork );
+        pthread_mutex_unlock( &p->Mutex );
+        for ( i = 0; i < p->nThreads; i++ )
+            pthread_join( p->Threads[i], NULL );
+        pthread_mutex_destroy( &p->Mutex );
+        pthread_cond_destroy( &p->CondWork );
+        pthread_cond_destroy( &p->CondDone );
+    }
+    ABC_FREE( p );
+}
+
 #endif // pthreads are used
 
 
@@ -22,6 +22,10 @@
 #include "aig/gia/gia.h"
 #include "dar.h"
 
+#if defined(ABC_USE_PTHREADS) && !defined(_MSC_VER)
+#include <pthread.h>
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -105,7 +109,19 @@ struct Dar_Lib_t_ // library
     unsigned char *  pMap;
 };
 
+// the library keeps scratch data used during evaluation, so each thread has its own copy;
+// a copy started by a worker thread is registered under a thread key and freed when
+// the thread exits, so workers do not need to call Dar_LibStop() themselves
+#ifdef _MSC_VER
 static Dar_Lib_t * s_DarLib = NULL;
+#else
+static __thread Dar_Lib_t * s_DarLib = NULL;
+#endif
+
+#if defined(ABC_USE_PTHREADS) && !defined(_MSC_VER)
+static pthread_key_t  s_DarLibKey;
+static pthread_once_t s_DarLibOnce = PTHREAD_ONCE_INIT;
+#endif
 
 static inline Dar_LibObj_t * Dar_LibObj( Dar_Lib_t * p, int Id )    { return p->pObjs + Id; }
 static inline int            Dar_LibObjTruth( Dar_LibObj_t * pObj ) { return pObj->Num < (0xFFFF & ~pObj->Num) ? pObj->Num : (0xFFFF & ~pObj->Num); }
@@ -193,6 +209,8 @@ void Dar_LibFree( Dar_Lib_t * p )
 ***********************************************************************/
 int Dar_LibReturnClass( unsigned uTruth )
 {
+    if ( s_DarLib == NULL )
+        Dar_LibStart();
     return s_DarLib->pMap[uTruth & 0xffff];
 }
 
@@ -477,8 +495,11 @@ void Dar_LibSetup0_rec( Dar_Lib_t * p, Dar_LibObj_t * pObj, int Class, int fColl
 ***********************************************************************/
 void Dar_LibPrepare( int nSubgraphs )
 {
-    Dar_Lib_t * p = s_DarLib;
+    Dar_Lib_t * p;
     int i, k, nNodes0Total;
+    if ( s_DarLib == NULL )
+        Dar_LibStart();
+    p = s_DarLib;
     if ( p->nSubgraphs == nSubgraphs )
         return;
 
@@ -579,6 +600,28 @@ Dar_Lib_t * Dar_LibRead()
     return p;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Frees the library of a thread when the thread exits.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#if defined(ABC_USE_PTHREADS) && !defined(_MSC_VER)
+static void Dar_LibThreadExit( void * pLib )
+{
+    Dar_LibFree( (Dar_Lib_t *)pLib );
+}
+static void Dar_LibKeyCreate()
+{
+    pthread_key_create( &s_DarLibKey, Dar_LibThreadExit );
+}
+#endif
+
 /**Function*************************************************************
 
   Synopsis    [Starts the library.]
@@ -597,6 +640,10 @@ void Dar_LibStart()
         return;
     assert( s_DarLib == NULL );
     s_DarLib = Dar_LibRead();
+#if defined(ABC_USE_PTHREADS) && !defined(_MSC_VER)
+    pthread_once( &s_DarLibOnce, Dar_LibKeyCreate );
+    pthread_setspecific( s_DarLibKey, s_DarLib );
+#endif
 //    printf( "The 4-input library started with %d nodes and %d subgraphs. ", s_DarLib->nObjs - 4, s_DarLib->nSubgrTotal );
 //    ABC_PRT( "Time", Abc_Clock() - clk );
 }
@@ -605,7 +652,7 @@ void Dar_LibStart()
 
   Synopsis    [Stops the library.]
 
-  Description []
+  Description [Stops the library of the calling thread, if it was started.]
                
   SideEffects []
 
@@ -614,7 +661,11 @@ void Dar_LibStart()
 ***********************************************************************/
 void Dar_LibStop()
 {
-    assert( s_DarLib != NULL );
+    if ( s_DarLib == NULL )
+        return;
+#if defined(ABC_USE_PTHREADS) && !defined(_MSC_VER)
+    pthread_setspecific( s_DarLibKey, NULL );
+#endif
     Dar_LibFree( s_DarLib );
     s_DarLib = NULL;
 }
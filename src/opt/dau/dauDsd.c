@@ -37,6 +37,13 @@ ABC_NAMESPACE_IMPL_START
     FUNCTION{abc} = FUNCTION( a, b, c )
 */
 
+// the scratch buffers are per-thread because DSD may be computed in several threads
+#ifdef _MSC_VER
+#define DAU_STATIC static
+#else
+#define DAU_STATIC static __thread
+#endif
+
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -79,7 +86,7 @@ static inline word ** Dau_DsdTtElems()
 ***********************************************************************/
 int * Dau_DsdComputeMatches( char * p )
 {
-    static int pMatches[DAU_MAX_STR];
+    DAU_STATIC int pMatches[DAU_MAX_STR];
     int pNested[DAU_MAX_VAR];
     int v, nNested = 0;
     for ( v = 0; p[v]; v++ )
@@ -188,7 +195,7 @@ int Dau_DsdNormalizeCompare( char * pStr, int * pMarks, int i, int j )
 }
 int * Dau_DsdNormalizePerm( char * pStr, int * pMarks, int nMarks )
 {
-    static int pPerm[DAU_MAX_VAR];
+    DAU_STATIC int pPerm[DAU_MAX_VAR];
     int i, k;
     for ( i = 0; i < nMarks; i++ )
         pPerm[i] = i;
@@ -204,7 +211,7 @@ int * Dau_DsdNormalizePerm( char * pStr, int * pMarks, int nMarks )
 }
 void Dau_DsdNormalize_rec( char * pStr, char ** p, int * pMatches )
 {
-    static char pBuffer[DAU_MAX_STR];
+    DAU_STATIC char pBuffer[DAU_MAX_STR];
     if ( **p == '!' )
         (*p)++;
     while ( (**p >= 'A' && **p <= 'F') || (**p >= '0' && **p <= '9') )
@@ -656,7 +663,7 @@ void Dau_DsdTest2()
 ***********************************************************************/
 static inline int Dau_DsdPerformReplace( char * pBuffer, int PosStart, int Pos, int Symb, char * pNext )
 {
-    static char pTemp[DAU_MAX_STR];
+    DAU_STATIC char pTemp[DAU_MAX_STR];
     char * pCur = pTemp;
     int i, k, RetValue;
     for ( i = PosStart; i < Pos; i++ )
@@ -827,7 +834,7 @@ int Dau_DsdPerform_rec( word t, char * pBuffer, int Pos, int * pVars, int nVars
 }
 char * Dau_DsdPerform( word t )
 {
-    static char pBuffer[DAU_MAX_STR];
+    DAU_STATIC char pBuffer[DAU_MAX_STR];
     int pVarsNew[6] = {0, 1, 2, 3, 4, 5};
     int Pos = 0;
     if ( t == 0 )
@@ -40,6 +40,7 @@ eSLIM::eSLIMConfig getCfg(const eSLIM_ParamStruct* params) {
   config.fill_subcircuits = params->fill_subcircuits;
   config.fix_seed = params->fix_seed;
   config.trial_limit_active = params->trial_limit_active;
+  config.cache_relations = params->cache_relations;
   config.timeout = params->timeout;
   config.iterations = params->iterations;
   config.subcircuit_size_bound = params->subcircuit_size_bound;
@@ -59,6 +60,7 @@ void seteSLIMParams(eSLIM_ParamStruct* params) {
   params->fix_seed = 0;
   params->trial_limit_active = 1;
   params->apply_inprocessing = 1;
+  params->cache_relations = 1;
   params->timeout = 1620;
   params->timeout_inprocessing = 180;
   params->iterations = 0;
@@ -185,6 +187,9 @@ Gia_Man_t* applyeSLIM(Gia_Man_t * pGia, const eSLIM_ParamStruct* params) {
     std::cout << "Total relation generation time (s): " << log.relation_generation_time << "\n";
     std::cout << "Total synthesis time (s): " << log.synthesis_time << "\n";
     std::cout << "#Iterations with forbidden pairs: " << log.subcircuits_with_forbidden_pairs << "\n";
+    if (params->cache_relations) {
+      std::cout << "#Iterations with cached relations: " << log.relation_cache_hits << "\n";
+    }
   }
   if (params->verbosity_level > 2) {
     for (int i = 2; i < log.nof_analyzed_circuits_per_size.size(); i++) {
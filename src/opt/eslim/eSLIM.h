@@ -35,6 +35,7 @@ ABC_NAMESPACE_HEADER_START
     int fix_seed;                                       
     int trial_limit_active;
     int apply_inprocessing;
+    int cache_relations;                                // Reuse the synthesis results of relations that were seen before
     
     unsigned int timeout;                               // available time in seconds (soft limit)
     unsigned int timeout_inprocessing;
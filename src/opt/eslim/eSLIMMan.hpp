@@ -22,6 +22,7 @@
 #define ABC__OPT__ESLIM__ESLIMMAN_h
 
 #include <vector>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -48,6 +49,7 @@ namespace eSLIM {
     private:
 
       eSLIM_Man(Gia_Man_t * gia_man, const eSLIMConfig& cfg, eSLIMLog& log);
+      ~eSLIM_Man();
       Gia_Man_t* getCircuit();
 
       void minimize();
@@ -59,6 +61,10 @@ namespace eSLIM {
       word getAllFalseBehaviour(const Subcircuit& subcir);
       bool getAllFalseBehaviourRec(Gia_Obj_t * pObj);
 
+      std::string getRelationKey(Vec_Wrd_t* vSimsDiv, Vec_Wrd_t* vSimsOut, word all_false_behaviour, const Subcircuit& subcir, int nVars, int nOuts);
+      Mini_Aig_t* lookupRelation(const std::string& key, int original_size);
+      void storeRelation(const std::string& key, Mini_Aig_t* replacement, int size);
+
       std::pair<int, Mini_Aig_t*> reduce( Vec_Wrd_t* vSimsDiv, Vec_Wrd_t* vSimsOut, const std::unordered_map<int, std::unordered_set<int>>& forbidden_pairs,
                                           int nVars, int nDivs, int nOuts, int initial_size);
       Mini_Aig_t* computeReplacement( SynthesisEngine& syn_man, int size);
@@ -73,6 +79,9 @@ namespace eSLIM {
       const eSLIMConfig& cfg;
       eSLIMLog& log;
       SelectionEngine subcircuit_selection;
+
+      // replacements found for the relations seen so far (the key encodes the relation)
+      std::unordered_map<std::string, std::pair<int, Mini_Aig_t*>> relation_cache;
       
       double relation_generation_time ;
       double synthesis_time ;
@@ -25,6 +25,7 @@
 #include <unordered_set>
 #include <iostream>
 #include <climits>
+#include <algorithm>
 
 #include "eSLIMMan.hpp"
 #include "synthesisEngine.hpp"
@@ -61,6 +62,15 @@ namespace eSLIM {
     relation_generation_time = log.relation_generation_time;
     synthesis_time = log.synthesis_time;
   }
+
+  template <typename Y, typename R, typename S>
+  eSLIM_Man<Y, R, S>::~eSLIM_Man() {
+    for (auto& entry : relation_cache) {
+      if (entry.second.second) {
+        Mini_AigStop(entry.second.second);
+      }
+    }
+  }
   
   template <typename Y, typename R, typename S>
   void eSLIM_Man<Y, R, S>::minimize() {
@@ -100,6 +110,7 @@ namespace eSLIM {
       if (cfg.verbosity_level > 1) {
         printf("Relation generation time: %.2f sec\n", log.relation_generation_time - relation_generation_time);
         printf("Synthesis time: %.2f sec\n", log.synthesis_time - synthesis_time);
+        printf("Cached relations: %d\n", (int)relation_cache.size());
       } 
     }
   }
@@ -177,20 +188,34 @@ namespace eSLIM {
     // In order to prevent this behaviour, we first modify the relation such that for the (0,...,0) input pattern only the original output patterns is allowed.
     vSimsOut->pArray[0] = getAllFalseBehaviour(subcir);
 
-    int DivCompl = (int)Vec_WrdEntry(vSimsDiv, 0) >> 1;
-    int OutCompl = Exa6_ManFindPolar( Vec_WrdEntry(vSimsOut, 0), nOuts );
-    Vec_Wrd_t* vSimsDiv2 = Exa6_ManTransformInputs( vSimsDiv );
-    Vec_Wrd_t* vSimsOut2 = Exa6_ManTransformOutputs( vSimsOut, nOuts );
-    Mini_Aig_t* pMini = nullptr;
     int original_size = Vec_IntSize(subcir.nodes);
-    int size = original_size;
-
     if (log.nof_analyzed_circuits_per_size.size() < original_size + 1) {
       log.nof_analyzed_circuits_per_size.resize(original_size + 1, 0);
       log.nof_replaced_circuits_per_size.resize(original_size + 1, 0);
       log.nof_reduced_circuits_per_size.resize(original_size + 1, 0);
     }
     log.nof_analyzed_circuits_per_size[original_size]++;
+
+    // The same relation is frequently generated again, e.g. if the subcircuit has not been changed since it was last selected.
+    // In this case, the stored result of the previous synthesis run is reused instead of calling the SAT solver again.
+    std::string key;
+    if (cfg.cache_relations) {
+      key = getRelationKey(vSimsDiv, vSimsOut, original_all_false_behaviour, subcir, nVars, nOuts);
+      Mini_Aig_t* pCached = lookupRelation(key, original_size);
+      if (pCached != nullptr) {
+        Abc_RDataStop(relation);
+        Vec_WrdFreeP( &vSimsDiv );
+        Vec_WrdFreeP( &vSimsOut );
+        return pCached;
+      }
+    }
+
+    int DivCompl = (int)Vec_WrdEntry(vSimsDiv, 0) >> 1;
+    int OutCompl = Exa6_ManFindPolar( Vec_WrdEntry(vSimsOut, 0), nOuts );
+    Vec_Wrd_t* vSimsDiv2 = Exa6_ManTransformInputs( vSimsDiv );
+    Vec_Wrd_t* vSimsOut2 = Exa6_ManTransformOutputs( vSimsOut, nOuts );
+    Mini_Aig_t* pMini = nullptr;
+    int size = original_size;
     
     abctime synthesis_start = Abc_Clock();
     std::tie(size, pMini) = reduce(vSimsDiv2, vSimsOut2, subcir.forbidden_pairs, nVars, nDivs, nOuts, size);
@@ -238,6 +263,9 @@ namespace eSLIM {
       if (size < original_size) {
         log.nof_reduced_circuits_per_size[original_size]++;
       }
+      if (cfg.cache_relations) {
+        storeRelation(key, pMini, size);
+      }
     }
     Vec_WrdFreeP( &vSimsDiv );
     Vec_WrdFreeP( &vSimsOut );
@@ -246,6 +274,57 @@ namespace eSLIM {
     return pMini;
   }
 
+  template <typename Y, typename R, typename S>
+  std::string eSLIM_Man<Y, R, S>::getRelationKey(Vec_Wrd_t* vSimsDiv, Vec_Wrd_t* vSimsOut, word all_false_behaviour, const Subcircuit& subcir, int nVars, int nOuts) {
+    // the key consists of the dimensions, the input and output patterns and the forbidden pairs
+    std::vector<word> data = {(word)nVars, (word)nOuts, (word)Vec_WrdSize(vSimsDiv), all_false_behaviour};
+    data.insert(data.end(), Vec_WrdArray(vSimsDiv), Vec_WrdArray(vSimsDiv) + Vec_WrdSize(vSimsDiv));
+    data.insert(data.end(), Vec_WrdArray(vSimsOut), Vec_WrdArray(vSimsOut) + Vec_WrdSize(vSimsOut));
+    std::vector<word> pairs;
+    for (const auto& it : subcir.forbidden_pairs) {
+      for (int target : it.second) {
+        pairs.push_back(((word)(unsigned)it.first << 32) | (unsigned)target);
+      }
+    }
+    std::sort(pairs.begin(), pairs.end());
+    data.insert(data.end(), pairs.begin(), pairs.end());
+    return std::string(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(word));
+  }
+
+  template <typename Y, typename R, typename S>
+  Mini_Aig_t* eSLIM_Man<Y, R, S>::lookupRelation(const std::string& key, int original_size) {
+    auto it = relation_cache.find(key);
+    if (it == relation_cache.end() || it->second.first > original_size) {
+      return nullptr;
+    }
+    log.relation_cache_hits++;
+    log.nof_replaced_circuits_per_size[original_size]++;
+    if (it->second.first < original_size) {
+      log.nof_reduced_circuits_per_size[original_size]++;
+    }
+    return Mini_AigDup(it->second.second);
+  }
+
+  template <typename Y, typename R, typename S>
+  void eSLIM_Man<Y, R, S>::storeRelation(const std::string& key, Mini_Aig_t* replacement, int size) {
+    // Only successful synthesis runs are stored, as a failure may be caused by a timeout.
+    if (relation_cache.size() >= cfg.relation_cache_limit) {
+      for (auto& entry : relation_cache) {
+        Mini_AigStop(entry.second.second);
+      }
+      relation_cache.clear();
+    }
+    auto it = relation_cache.find(key);
+    if (it != relation_cache.end()) {
+      if (it->second.first <= size) {
+        return;
+      }
+      Mini_AigStop(it->second.second);
+      relation_cache.erase(it);
+    }
+    relation_cache.emplace(key, std::make_pair(size, Mini_AigDup(replacement)));
+  }
+
   template <typename Y, typename R, typename S>
   word eSLIM_Man<Y, R, S>::getAllFalseBehaviour(const Subcircuit& subcir) {
     Gia_ManIncrementTravId(gia_man);
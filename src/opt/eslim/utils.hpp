@@ -40,6 +40,7 @@ namespace eSLIM {
     bool fill_subcircuits = false;                              
     bool trial_limit_active = true;
     bool allow_xors = false;               
+    bool cache_relations = true;
 
     unsigned int timeout = 3600;                    
     unsigned int iterations = 0;                          
@@ -48,6 +49,7 @@ namespace eSLIM {
     int seed = 0;
     unsigned int nselection_trials = 100;
     double expansion_probability = 0.6;  
+    unsigned int relation_cache_limit = 10000;
 
     // times given in sec
     int minimum_sat_timeout = 1;
@@ -63,6 +65,7 @@ namespace eSLIM {
     double relation_generation_time = 0;
     double synthesis_time = 0;
     unsigned int subcircuits_with_forbidden_pairs = 0;
+    unsigned int relation_cache_hits = 0;
 
     std::vector<int> nof_analyzed_circuits_per_size;
     std::vector<int> nof_replaced_circuits_per_size;
@@ -160,6 +160,7 @@ void Fxch_CubesUnGruping(Fxch_Man_t* pFxchMan)
 int Fxch_FastExtract( Vec_Wec_t* vCubes,
                       int ObjIdMax,
                       int nMaxDivExt,
+                      int nProcs,
                       int fVerbose,
                       int fVeryVerbose )
 {
@@ -173,7 +174,7 @@ int Fxch_FastExtract( Vec_Wec_t* vCubes,
     Fxch_ManGenerateLitHashKeys( pFxchMan );
     Fxch_ManComputeLevel( pFxchMan );
     Fxch_ManSCHashTablesInit( pFxchMan );
-    Fxch_ManDivCreate( pFxchMan );
+    Fxch_ManDivCreate( pFxchMan, nProcs );
     pFxchMan->timeInit = Abc_Clock() - TempTime;
 
     if ( fVeryVerbose )
@@ -228,6 +229,7 @@ int Fxch_FastExtract( Vec_Wec_t* vCubes,
 ***********************************************************************/
 int Abc_NtkFxchPerform( Abc_Ntk_t* pNtk,
                         int nMaxDivExt,
+                        int nProcs,
                         int fVerbose,
                         int fVeryVerbose )
 {
@@ -242,7 +244,7 @@ int Abc_NtkFxchPerform( Abc_Ntk_t* pNtk,
     }
 
     vCubes = Abc_NtkFxRetrieve( pNtk );
-    if ( Fxch_FastExtract( vCubes, Abc_NtkObjNumMax( pNtk ), nMaxDivExt, fVerbose, fVeryVerbose ) > 0 )
+    if ( Fxch_FastExtract( vCubes, Abc_NtkObjNumMax( pNtk ), nMaxDivExt, nProcs, fVerbose, fVeryVerbose ) > 0 )
     {
         Abc_NtkFxInsert( pNtk, vCubes );
         Vec_WecFree( vCubes );
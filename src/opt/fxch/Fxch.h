@@ -154,8 +154,8 @@ static inline int Fxch_CountOnes( unsigned num )
 }
 
 /*===== Fxch.c =======================================================*/
-int Abc_NtkFxchPerform( Abc_Ntk_t* pNtk, int nMaxDivExt, int fVerbose, int fVeryVerbose );
-int Fxch_FastExtract( Vec_Wec_t* vCubes, int ObjIdMax, int nMaxDivExt, int fVerbose, int fVeryVerbose );
+int Abc_NtkFxchPerform( Abc_Ntk_t* pNtk, int nMaxDivExt, int nProcs, int fVerbose, int fVeryVerbose );
+int Fxch_FastExtract( Vec_Wec_t* vCubes, int ObjIdMax, int nMaxDivExt, int nProcs, int fVerbose, int fVeryVerbose );
 
 /*===== FxchDiv.c ====================================================================================================*/
 int  Fxch_DivCreate( Fxch_Man_t* pFxchMan,  Fxch_SubCube_t* pSubCube0, Fxch_SubCube_t* pSubCube1 );
@@ -173,7 +173,7 @@ void  Fxch_ManMapLiteralsIntoCubes( Fxch_Man_t* pFxchMan, int nVars );
 void  Fxch_ManGenerateLitHashKeys( Fxch_Man_t* pFxchMan );
 void  Fxch_ManSCHashTablesInit( Fxch_Man_t* pFxchMan );
 void  Fxch_ManSCHashTablesFree( Fxch_Man_t* pFxchMan );
-void  Fxch_ManDivCreate( Fxch_Man_t* pFxchMan );
+void  Fxch_ManDivCreate( Fxch_Man_t* pFxchMan, int nProcs );
 int   Fxch_ManComputeLevelDiv( Fxch_Man_t* pFxchMan, Vec_Int_t* vCubeFree );
 int   Fxch_ManComputeLevelCube( Fxch_Man_t* pFxchMan, Vec_Int_t* vCube );
 void  Fxch_ManComputeLevel( Fxch_Man_t* pFxchMan );
@@ -216,6 +216,23 @@ int Fxch_SCHashTableRemove( Fxch_SCHashTable_t* pSCHashTable,
                             uint32_t iLit1,
                             char fUpdate );
 
+void Fxch_SCHashTableAdd( Fxch_SCHashTable_t* pSCHashTable,
+                          uint32_t SubCubeID,
+                          uint32_t iCube,
+                          uint32_t iLit0,
+                          uint32_t iLit1 );
+
+void Fxch_SCHashTableCollect( Fxch_SCHashTable_t* pSCHashTable,
+                              Vec_Wec_t* vCubes,
+                              uint32_t SubCubeID,
+                              uint32_t iCube,
+                              uint32_t iLit0,
+                              uint32_t iLit1,
+                              Vec_Wrd_t* vPairs );
+
+int Fxch_SCHashTablePair( Fxch_SCHashTable_t* pSCHashTable, word Pair, char fUpdate );
+int Fxch_SCHashTablePairCube( Fxch_SCHashTable_t* pSCHashTable, word Pair );
+
 unsigned int Fxch_SCHashTableMemory( Fxch_SCHashTable_t* );
 void Fxch_SCHashTablePrint( Fxch_SCHashTable_t* );
 
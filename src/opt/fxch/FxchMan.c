@@ -149,6 +149,149 @@ static inline void Fxch_ManDivDoubleCube( Fxch_Man_t* pFxchMan,
     }
 }
 
+static inline void Fxch_ManCollectSubCubes( Vec_Int_t* vLitHashKeys,
+                                            Vec_Int_t* vCube,
+                                            Vec_Int_t* vSubCubes )
+{
+    int SubCubeID = 0,
+        iLit0,
+        Lit0;
+
+    /* Same sub-cubes in the same order as in Fxch_ManDivDoubleCube */
+    Vec_IntClear( vSubCubes );
+    Vec_IntForEachEntryStart( vCube, Lit0, iLit0, 1)
+        SubCubeID += Vec_IntEntry( vLitHashKeys, Lit0 );
+
+    Vec_IntPushThree( vSubCubes, SubCubeID, 0, 0 );
+
+    Vec_IntForEachEntryStart( vCube, Lit0, iLit0, 1)
+    {
+        SubCubeID -= Vec_IntEntry( vLitHashKeys, Lit0 );
+        Vec_IntPushThree( vSubCubes, SubCubeID, iLit0, 0 );
+
+        if ( Vec_IntSize( vCube ) >= 3 )
+        {
+            int Lit1,
+                iLit1;
+
+            Vec_IntForEachEntryStart( vCube, Lit1, iLit1, iLit0 + 1)
+            {
+                SubCubeID -= Vec_IntEntry( vLitHashKeys, Lit1 );
+                Vec_IntPushThree( vSubCubes, SubCubeID, iLit0, iLit1 );
+                SubCubeID += Vec_IntEntry( vLitHashKeys, Lit1 );
+            }
+        }
+
+        SubCubeID += Vec_IntEntry( vLitHashKeys, Lit0 );
+    }
+}
+
+/* Parallel divisor creation
+ *
+ *   The sub-cube hash table is first filled with all sub-cubes, in the same
+ *   order as the sequential insertion would do. Then the threads look for
+ *   matching pairs of sub-cubes (which is where most of the time goes) for
+ *   their own ranges of cubes, each one using a private copy of the table
+ *   structure. Finally, the pairs are turned into divisors following the
+ *   order of the cubes, so that the divisors get the same IDs and weights
+ *   as in the sequential version and the result does not depend on the
+ *   number of threads.
+ */
+typedef struct Fxch_ManJob_t_ Fxch_ManJob_t;
+struct Fxch_ManJob_t_
+{
+    Fxch_Man_t*        pFxchMan;
+    Fxch_SCHashTable_t SCHashTable;  /* private copy of the table structure */
+    int                iCubeStart;
+    int                iCubeStop;
+    Vec_Wrd_t*         vPairs;       /* pairs of matching sub-cubes */
+};
+
+static int Fxch_ManDivCollectJob( void* pArg )
+{
+    Fxch_ManJob_t* pJob = (Fxch_ManJob_t*)pArg;
+    Vec_Wec_t* vCubes = pJob->pFxchMan->vCubes;
+    Vec_Int_t* vSubCubes = Vec_IntAlloc( 64 );
+    int iCube, i;
+
+    for ( iCube = pJob->iCubeStart; iCube < pJob->iCubeStop; iCube++ )
+    {
+        Fxch_ManCollectSubCubes( pJob->pFxchMan->vLitHashKeys, Vec_WecEntry( vCubes, iCube ), vSubCubes );
+        for ( i = 0; i < Vec_IntSize( vSubCubes ); i += 3 )
+            Fxch_SCHashTableCollect( &pJob->SCHashTable, vCubes,
+                                     Vec_IntEntry( vSubCubes, i ),
+                                     iCube,
+                                     Vec_IntEntry( vSubCubes, i + 1 ),
+                                     Vec_IntEntry( vSubCubes, i + 2 ),
+                                     pJob->vPairs );
+    }
+
+    Vec_IntFree( vSubCubes );
+    return 1;
+}
+
+static void Fxch_ManDivCreatePar( Fxch_Man_t* pFxchMan,
+                                  int nProcs )
+{
+    Vec_Ptr_t* vJobs = Vec_PtrAlloc( 4 * nProcs );
+    Vec_Int_t* vSubCubes = Vec_IntAlloc( 64 );
+    Fxch_ManJob_t* pJob;
+    int nCubes = Vec_WecSize( pFxchMan->vCubes ),
+        nJobs = 4 * nProcs,
+        iCube, i, k;
+
+    /* Fill the sub-cube hash table */
+    for ( iCube = 0; iCube < nCubes; iCube++ )
+    {
+        Fxch_ManCollectSubCubes( pFxchMan->vLitHashKeys, Vec_WecEntry( pFxchMan->vCubes, iCube ), vSubCubes );
+        for ( i = 0; i < Vec_IntSize( vSubCubes ); i += 3 )
+            Fxch_SCHashTableAdd( pFxchMan->pSCHashTable,
+                                 Vec_IntEntry( vSubCubes, i ),
+                                 iCube,
+                                 Vec_IntEntry( vSubCubes, i + 1 ),
+                                 Vec_IntEntry( vSubCubes, i + 2 ) );
+    }
+    Vec_IntFree( vSubCubes );
+
+    /* Collect pairs of matching sub-cubes */
+    for ( k = 0; k < nJobs; k++ )
+    {
+        pJob = ABC_CALLOC( Fxch_ManJob_t, 1 );
+        pJob->pFxchMan = pFxchMan;
+        pJob->SCHashTable = *pFxchMan->pSCHashTable;
+        memset( &pJob->SCHashTable.vSubCube0, 0, sizeof(Vec_Int_t) );
+        memset( &pJob->SCHashTable.vSubCube1, 0, sizeof(Vec_Int_t) );
+        pJob->iCubeStart = (int)((ABC_INT64_T)nCubes * k / nJobs);
+        pJob->iCubeStop = (int)((ABC_INT64_T)nCubes * (k + 1) / nJobs);
+        pJob->vPairs = Vec_WrdAlloc( 1024 );
+        Vec_PtrPush( vJobs, pJob );
+    }
+    Util_ProcessThreads( Fxch_ManDivCollectJob, vJobs, nProcs, 0, 0 );
+
+    /* Create divisors in the order of the sequential version */
+    Vec_PtrForEachEntry( Fxch_ManJob_t*, vJobs, pJob, k )
+    {
+        i = 0;
+        for ( iCube = pJob->iCubeStart; iCube < pJob->iCubeStop; iCube++ )
+        {
+            Fxch_ManDivSingleCube( pFxchMan, iCube, 1, 0 );
+            for ( ; i < Vec_WrdSize( pJob->vPairs ); i++ )
+            {
+                word Pair = Vec_WrdEntry( pJob->vPairs, i );
+                if ( Fxch_SCHashTablePairCube( pFxchMan->pSCHashTable, Pair ) != iCube )
+                    break;
+                pFxchMan->nPairsD += Fxch_SCHashTablePair( pFxchMan->pSCHashTable, Pair, 0 );
+            }
+        }
+        assert( i == Vec_WrdSize( pJob->vPairs ) );
+        Vec_IntErase( &pJob->SCHashTable.vSubCube0 );
+        Vec_IntErase( &pJob->SCHashTable.vSubCube1 );
+        Vec_WrdFree( pJob->vPairs );
+        ABC_FREE( pJob );
+    }
+    Vec_PtrFree( vJobs );
+}
+
 static inline void Fxch_ManCompressCubes( Vec_Wec_t* vCubes,
                                           Vec_Int_t* vLit2Cube )
 {
@@ -285,7 +428,8 @@ void Fxch_ManSCHashTablesFree( Fxch_Man_t* pFxchMan )
     Fxch_SCHashTableDelete( pFxchMan->pSCHashTable );
 }
 
-void Fxch_ManDivCreate( Fxch_Man_t* pFxchMan )
+void Fxch_ManDivCreate( Fxch_Man_t* pFxchMan,
+                        int nProcs )
 {
     Vec_Int_t* vCube;
     float Weight;
@@ -293,10 +437,15 @@ void Fxch_ManDivCreate( Fxch_Man_t* pFxchMan )
         fUpdate = 0,
         iCube;
 
-    Vec_WecForEachLevel( pFxchMan->vCubes, vCube, iCube )
+    if ( nProcs > 1 )
+        Fxch_ManDivCreatePar( pFxchMan, nProcs );
+    else
     {
-        Fxch_ManDivSingleCube( pFxchMan, iCube, fAdd, fUpdate );
-        Fxch_ManDivDoubleCube( pFxchMan, iCube, fAdd, fUpdate );
+        Vec_WecForEachLevel( pFxchMan->vCubes, vCube, iCube )
+        {
+            Fxch_ManDivSingleCube( pFxchMan, iCube, fAdd, fUpdate );
+            Fxch_ManDivDoubleCube( pFxchMan, iCube, fAdd, fUpdate );
+        }
     }
 
     pFxchMan->vDivPrio = Vec_QueAlloc( Vec_FltSize( pFxchMan->vDivWeights ) );
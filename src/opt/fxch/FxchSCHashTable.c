@@ -176,20 +176,15 @@ static inline int Fxch_SCHashTableEntryCompare( Fxch_SCHashTable_t* pSCHashTable
     return Vec_IntEqual( &pSCHashTable->vSubCube0, &pSCHashTable->vSubCube1 );
 }
 
-int Fxch_SCHashTableInsert( Fxch_SCHashTable_t* pSCHashTable,
-                            Vec_Wec_t* vCubes,
-                            uint32_t SubCubeID,
-                            uint32_t iCube,
-                            uint32_t iLit0,
-                            uint32_t iLit1,
-                            char fUpdate )
+static inline Fxch_SCHashTable_Entry_t* Fxch_SCHashTableAppend( Fxch_SCHashTable_t* pSCHashTable,
+                                                                uint32_t SubCubeID,
+                                                                uint32_t iCube,
+                                                                uint32_t iLit0,
+                                                                uint32_t iLit1 )
 {
     int iNewEntry;
-    int Pairs = 0;
     uint32_t BinID;
     Fxch_SCHashTable_Entry_t* pBin;
-    Fxch_SubCube_t* pNewEntry;
-    int iEntry;
 
     MurmurHash3_x86_32( ( void* ) &SubCubeID, sizeof( int ), 0x9747b28c, &BinID);
     pBin = Fxch_SCHashTableBin( pSCHashTable, BinID );
@@ -214,64 +209,168 @@ int Fxch_SCHashTableInsert( Fxch_SCHashTable_t* pSCHashTable,
     pBin->vSCData[iNewEntry].iLit1 = iLit1;
     pSCHashTable->nEntries++;
 
-    if ( pBin->Size == 1 )
+    return pBin;
+}
+
+static inline int Fxch_SCHashTableEntryMatch( Fxch_SCHashTable_t* pSCHashTable,
+                                              Vec_Wec_t* vCubes,
+                                              Fxch_SubCube_t* pEntry,
+                                              Fxch_SubCube_t* pNewEntry )
+{
+    if ( (pEntry->iLit1 != 0 && pNewEntry->iLit1 == 0) || (pEntry->iLit1 == 0 && pNewEntry->iLit1 != 0)  )
         return 0;
 
-    pNewEntry = &( pBin->vSCData[iNewEntry] );
-    for ( iEntry = 0; iEntry < (int)pBin->Size - 1; iEntry++ )
-    {
-        Fxch_SubCube_t* pEntry = &( pBin->vSCData[iEntry] );
-        int* pOutputID0 = Vec_IntEntryP( pSCHashTable->pFxchMan->vOutputID, pEntry->iCube * pSCHashTable->pFxchMan->nSizeOutputID );
-        int* pOutputID1 = Vec_IntEntryP( pSCHashTable->pFxchMan->vOutputID, pNewEntry->iCube * pSCHashTable->pFxchMan->nSizeOutputID );
-        int Result = 0;
-        int Base;
-        int iNewDiv = -1, i, z;
+    return Fxch_SCHashTableEntryCompare( pSCHashTable, vCubes, pEntry, pNewEntry );
+}
 
-        if ( (pEntry->iLit1 != 0 && pNewEntry->iLit1 == 0) || (pEntry->iLit1 == 0 && pNewEntry->iLit1 != 0)  )
-            continue;
+/* Processes a pair of matching sub-cubes: either records a single-cube
+ * containment or adds the corresponding double-cube divisor.
+ * Returns 1 if a divisor was added. */
+static inline int Fxch_SCHashTableEntryPair( Fxch_SCHashTable_t* pSCHashTable,
+                                             Fxch_SubCube_t* pEntry,
+                                             Fxch_SubCube_t* pNewEntry,
+                                             char fUpdate )
+{
+    int* pOutputID0 = Vec_IntEntryP( pSCHashTable->pFxchMan->vOutputID, pEntry->iCube * pSCHashTable->pFxchMan->nSizeOutputID );
+    int* pOutputID1 = Vec_IntEntryP( pSCHashTable->pFxchMan->vOutputID, pNewEntry->iCube * pSCHashTable->pFxchMan->nSizeOutputID );
+    int Result = 0;
+    int Base;
+    int iNewDiv = -1, i, z;
 
-        if ( !Fxch_SCHashTableEntryCompare( pSCHashTable, vCubes, pEntry, pNewEntry ) )
-            continue;
+    if ( ( pEntry->iLit0 == 0 ) || ( pNewEntry->iLit0 == 0 ) )
+    {
+        Vec_Int_t* vCube0 = Fxch_ManGetCube( pSCHashTable->pFxchMan, pEntry->iCube ),
+                 * vCube1 = Fxch_ManGetCube( pSCHashTable->pFxchMan, pNewEntry->iCube );
 
-        if ( ( pEntry->iLit0 == 0 ) || ( pNewEntry->iLit0 == 0 ) )
+        if ( Vec_IntSize( vCube0 ) > Vec_IntSize( vCube1 ) )
+        {
+            Vec_IntPush( pSCHashTable->pFxchMan->vSCC, pEntry->iCube );
+            Vec_IntPush( pSCHashTable->pFxchMan->vSCC, pNewEntry->iCube );
+        }
+        else
         {
-            Vec_Int_t* vCube0 = Fxch_ManGetCube( pSCHashTable->pFxchMan, pEntry->iCube ),
-                     * vCube1 = Fxch_ManGetCube( pSCHashTable->pFxchMan, pNewEntry->iCube );
+            Vec_IntPush( pSCHashTable->pFxchMan->vSCC, pNewEntry->iCube );
+            Vec_IntPush( pSCHashTable->pFxchMan->vSCC, pEntry->iCube );
+        }
 
-            if ( Vec_IntSize( vCube0 ) > Vec_IntSize( vCube1 ) )
-            {
-                Vec_IntPush( pSCHashTable->pFxchMan->vSCC, pEntry->iCube );
-                Vec_IntPush( pSCHashTable->pFxchMan->vSCC, pNewEntry->iCube );
-            }
-            else
-            {
-                Vec_IntPush( pSCHashTable->pFxchMan->vSCC, pNewEntry->iCube );
-                Vec_IntPush( pSCHashTable->pFxchMan->vSCC, pEntry->iCube );
-            }
+        return 0;
+    }
 
-            continue;
-        }
+    Base = Fxch_DivCreate( pSCHashTable->pFxchMan, pEntry, pNewEntry );
 
-        Base = Fxch_DivCreate( pSCHashTable->pFxchMan, pEntry, pNewEntry );
+    if ( Base < 0 )
+        return 0;
 
-        if ( Base < 0 )
-            continue;
+    for ( i = 0; i < pSCHashTable->pFxchMan->nSizeOutputID; i++ )
+        Result += Fxch_CountOnes( pOutputID0[i] & pOutputID1[i] );
 
-        for ( i = 0; i < pSCHashTable->pFxchMan->nSizeOutputID; i++ )
-            Result += Fxch_CountOnes( pOutputID0[i] & pOutputID1[i] );
+    for ( z = 0; z < Result; z++ )
+        iNewDiv = Fxch_DivAdd( pSCHashTable->pFxchMan, fUpdate, 0, Base );
 
-        for ( z = 0; z < Result; z++ )
-            iNewDiv = Fxch_DivAdd( pSCHashTable->pFxchMan, fUpdate, 0, Base );
+    Vec_WecPush( pSCHashTable->pFxchMan->vDivCubePairs, iNewDiv, pEntry->iCube );
+    Vec_WecPush( pSCHashTable->pFxchMan->vDivCubePairs, iNewDiv, pNewEntry->iCube );
 
-        Vec_WecPush( pSCHashTable->pFxchMan->vDivCubePairs, iNewDiv, pEntry->iCube );
-        Vec_WecPush( pSCHashTable->pFxchMan->vDivCubePairs, iNewDiv, pNewEntry->iCube );
+    return 1;
+}
 
-        Pairs++;
+int Fxch_SCHashTableInsert( Fxch_SCHashTable_t* pSCHashTable,
+                            Vec_Wec_t* vCubes,
+                            uint32_t SubCubeID,
+                            uint32_t iCube,
+                            uint32_t iLit0,
+                            uint32_t iLit1,
+                            char fUpdate )
+{
+    int Pairs = 0;
+    Fxch_SCHashTable_Entry_t* pBin;
+    Fxch_SubCube_t* pNewEntry;
+    int iEntry;
+
+    pBin = Fxch_SCHashTableAppend( pSCHashTable, SubCubeID, iCube, iLit0, iLit1 );
+
+    if ( pBin->Size == 1 )
+        return 0;
+
+    pNewEntry = &( pBin->vSCData[pBin->Size - 1] );
+    for ( iEntry = 0; iEntry < (int)pBin->Size - 1; iEntry++ )
+    {
+        Fxch_SubCube_t* pEntry = &( pBin->vSCData[iEntry] );
+
+        if ( !Fxch_SCHashTableEntryMatch( pSCHashTable, vCubes, pEntry, pNewEntry ) )
+            continue;
+
+        Pairs += Fxch_SCHashTableEntryPair( pSCHashTable, pEntry, pNewEntry, fUpdate );
     }
 
     return Pairs;
 }
 
+/* Adds a sub-cube to the hash table without looking for matching sub-cubes.
+ * Used when the table is filled up-front and the pairs are collected later. */
+void Fxch_SCHashTableAdd( Fxch_SCHashTable_t* pSCHashTable,
+                          uint32_t SubCubeID,
+                          uint32_t iCube,
+                          uint32_t iLit0,
+                          uint32_t iLit1 )
+{
+    Fxch_SCHashTableAppend( pSCHashTable, SubCubeID, iCube, iLit0, iLit1 );
+}
+
+/* Records every earlier entry of the sub-cube's bin matching it, that is,
+ * the pairs Fxch_SCHashTableInsert would have found when inserting it.
+ * Each pair is stored as the bin index and the positions of both entries.
+ * Nothing is modified, so several threads may collect pairs concurrently
+ * as long as each one uses its own copy of the table structure. */
+void Fxch_SCHashTableCollect( Fxch_SCHashTable_t* pSCHashTable,
+                              Vec_Wec_t* vCubes,
+                              uint32_t SubCubeID,
+                              uint32_t iCube,
+                              uint32_t iLit0,
+                              uint32_t iLit1,
+                              Vec_Wrd_t* vPairs )
+{
+    uint32_t BinID;
+    Fxch_SCHashTable_Entry_t* pBin;
+    Fxch_SubCube_t* pNewEntry;
+    int iEntry, iNewEntry;
+
+    MurmurHash3_x86_32( ( void* ) &SubCubeID, sizeof( int ), 0x9747b28c, &BinID);
+    pBin = Fxch_SCHashTableBin( pSCHashTable, BinID );
+
+    for ( iNewEntry = 0; iNewEntry < (int)pBin->Size; iNewEntry++ )
+    {
+        pNewEntry = &( pBin->vSCData[iNewEntry] );
+        if ( pNewEntry->iCube == iCube && pNewEntry->iLit0 == iLit0 && pNewEntry->iLit1 == iLit1 )
+            break;
+    }
+    assert( iNewEntry < (int)pBin->Size );
+
+    pNewEntry = &( pBin->vSCData[iNewEntry] );
+    for ( iEntry = 0; iEntry < iNewEntry; iEntry++ )
+        if ( Fxch_SCHashTableEntryMatch( pSCHashTable, vCubes, &( pBin->vSCData[iEntry] ), pNewEntry ) )
+            Vec_WrdPush( vPairs, ((word)(pBin - pSCHashTable->pBins) << 32) | ((word)iEntry << 16) | (word)iNewEntry );
+}
+
+/* Processes a pair collected by Fxch_SCHashTableCollect. */
+int Fxch_SCHashTablePair( Fxch_SCHashTable_t* pSCHashTable,
+                          word Pair,
+                          char fUpdate )
+{
+    Fxch_SCHashTable_Entry_t* pBin = pSCHashTable->pBins + (Pair >> 32);
+    return Fxch_SCHashTableEntryPair( pSCHashTable,
+                                      &( pBin->vSCData[(Pair >> 16) & 0xFFFF] ),
+                                      &( pBin->vSCData[Pair & 0xFFFF] ),
+                                      fUpdate );
+}
+
+/* Returns the cube of the newer sub-cube of a collected pair. */
+int Fxch_SCHashTablePairCube( Fxch_SCHashTable_t* pSCHashTable,
+                              word Pair )
+{
+    Fxch_SCHashTable_Entry_t* pBin = pSCHashTable->pBins + (Pair >> 32);
+    return (int)pBin->vSCData[Pair & 0xFFFF].iCube;
+}
+
 int Fxch_SCHashTableRemove( Fxch_SCHashTable_t* pSCHashTable,
                             Vec_Wec_t* vCubes,
                             uint32_t SubCubeID,
@@ -58,6 +58,7 @@ struct Mfs_Par_t_
     int           fDelay;        // performs optimization for delay
     int           fPower;        // performs power-aware optimization
     int           fGiaSat;       // use new SAT solver
+    int           fUseSim;       // filters divisor sets using simulation
     int           fVerbose;      // enable basic stats
     int           fVeryVerbose;  // enable detailed stats
     int           fPrintCares;   // prints careset at each node
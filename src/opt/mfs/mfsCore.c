@@ -57,6 +57,7 @@ void Abc_NtkMfsParsDefault( Mfs_Par_t * pPars )
     pPars->fResub       =    1;
     pPars->fArea        =    0;
     pPars->fMoreEffort  =    0;
+    pPars->fUseSim      =    0;
     pPars->fSwapEdge    =    0;
     pPars->fOneHotness  =    0;
     pPars->fVerbose     =    0;
@@ -113,6 +114,9 @@ int Abc_WinNode(Mfs_Man_t * p, Abc_Obj_t *pNode)
         p->nNodesBad++;
         return 1;
     }
+    // simulate the bank of patterns
+    if ( p->vSimPats )
+        Abc_NtkMfsSimWindow( p );
     return 0;
 }
 
@@ -271,6 +275,9 @@ clk = Abc_Clock();
         p->nNodesBad++;
         return 1;
     }
+    // simulate the bank of patterns
+    if ( p->vSimPats )
+        Abc_NtkMfsSimWindow( p );
 //clk = Abc_Clock();
 //    if ( p->pPars->fGiaSat )
 //        Abc_NtkMfsConstructGia( p );
@@ -432,6 +439,8 @@ int Abc_NtkMfs( Abc_Ntk_t * pNtk, Mfs_Par_t * pPars )
     p = Mfs_ManAlloc( pPars );
     p->pNtk = pNtk;
     p->nFaninMax = nFaninMax;
+    if ( pPars->fResub && pPars->fUseSim )
+        Abc_NtkMfsSimStart( p );
 
     // precomputer power-aware metrics
     if ( pPars->fPower )
@@ -69,6 +69,16 @@ struct Mfs_Man_t_
     int                 nCexes;    // the numbe rof current counter-examples
     int                 nSatCalls; 
     int                 nSatCexes;
+    // simulation-based filtering of divisor sets
+    Vec_Int_t *         vSimCiIds; // mapping of CI object IDs into CI numbers
+    Vec_Wrd_t *         vSimPats;  // the bank of CI patterns (random and c-exes)
+    Vec_Wrd_t *         vSimInfo;  // simulation info of the window AIG
+    Vec_Int_t *         vSimKeys;  // the keys used during filtering
+    int                 pSimOn[1<<MFS_FANIN_MAX];  // on-set pattern for each key
+    int                 pSimOff[1<<MFS_FANIN_MAX]; // off-set pattern for each key
+    int                 nSimWords; // the number of words per CI in the bank
+    int                 iSimPat;   // the next bank pattern to be replaced
+    int                 nSimCexes; // the number of c-exes found by simulation
 /*
     // intermediate AIG data
     Gia_Man_t *         pGia;      // replica of the AIG in the new package
@@ -131,6 +141,7 @@ struct Mfs_Man_t_
     abctime             timeCnf;
     abctime             timeSat;
     abctime             timeInt;
+    abctime             timeSim;
     abctime             timeTotal;
 };
 
@@ -167,6 +178,12 @@ extern int              Abc_NtkMfsResubNode2( Mfs_Man_t * p, Abc_Obj_t * pNode )
 /*=== mfsSat.c ==========================================================*/
 extern int              Abc_NtkMfsSolveSat( Mfs_Man_t * p, Abc_Obj_t * pNode );
 extern int              Abc_NtkAddOneHotness( Mfs_Man_t * p );
+/*=== mfsSim.c ==========================================================*/
+extern void             Abc_NtkMfsSimStart( Mfs_Man_t * p );
+extern void             Abc_NtkMfsSimStop( Mfs_Man_t * p );
+extern void             Abc_NtkMfsSimWindow( Mfs_Man_t * p );
+extern int              Abc_NtkMfsSimFilter( Mfs_Man_t * p, int * pCands, int nCands );
+extern void             Abc_NtkMfsSimAddCex( Mfs_Man_t * p );
 /*=== mfsStrash.c ==========================================================*/
 extern Aig_Man_t *      Abc_NtkConstructAig( Mfs_Man_t * p, Abc_Obj_t * pNode );
 extern double           Abc_NtkConstraintRatio( Mfs_Man_t * p, Abc_Obj_t * pNode );
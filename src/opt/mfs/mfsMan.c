@@ -115,6 +115,10 @@ void Mfs_ManPrint( Mfs_Man_t * p )
         printf( "Nodes = %d. Try = %d. Resub = %d. Div = %d. SAT calls = %d. Timeouts = %d. MaxDivs = %d.\n",
             p->nTotalNodesBeg, p->nNodesTried, p->nNodesResub, p->nTotalDivs, p->nSatCalls, p->nTimeOuts, p->nMaxDivs );
 
+        if ( p->vSimPats )
+            printf( "Simulation: Patterns = %d. C-exes = %d. Found by simulation = %d (%6.2f %%).\n",
+                64 * p->nSimWords, p->nSatCexes + p->nSimCexes, p->nSimCexes, 100.0*p->nSimCexes/Abc_MaxInt(1, p->nSatCexes + p->nSimCexes) );
+
         printf( "Attempts :   " );
         printf( "Remove %6d out of %6d (%6.2f %%)   ", p->nRemoves, p->nTryRemoves, 100.0*p->nRemoves/Abc_MaxInt(1, p->nTryRemoves) );
         printf( "Resub  %6d out of %6d (%6.2f %%)   ", p->nResubs,  p->nTryResubs,  100.0*p->nResubs /Abc_MaxInt(1, p->nTryResubs)  );
@@ -150,7 +154,9 @@ void Mfs_ManPrint( Mfs_Man_t * p )
     ABC_PRTP( "Aig", p->timeAig            ,  p->timeTotal );
     ABC_PRTP( "Gia", p->timeGia            ,  p->timeTotal );
     ABC_PRTP( "Cnf", p->timeCnf            ,  p->timeTotal );
-    ABC_PRTP( "Sat", p->timeSat-p->timeInt ,  p->timeTotal );
+    ABC_PRTP( "Sat", p->timeSat-p->timeInt-p->timeSim,  p->timeTotal );
+    if ( p->vSimPats )
+    ABC_PRTP( "Sim", p->timeSim            ,  p->timeTotal );
     ABC_PRTP( "Int", p->timeInt            ,  p->timeTotal );
     ABC_PRTP( "ALL", p->timeTotal          ,  p->timeTotal );
 
@@ -190,6 +196,7 @@ void Mfs_ManStop( Mfs_Man_t * p )
     Vec_IntFree( p->vProjVarsSat );
     Vec_IntFree( p->vDivLits );
     Vec_PtrFree( p->vDivCexes );
+    Abc_NtkMfsSimStop( p );
     ABC_FREE( p );
 }
 
@@ -111,6 +111,8 @@ p->timeGia += Abc_Clock() - clk;
         return RetValue2;
     }
 */ 
+    if ( p->vSimPats && Abc_NtkMfsSimFilter( p, pCands, nCands ) )
+        return 0;
     p->nSatCalls++;
     RetValue = sat_solver_solve( p->pSat, pCands, pCands + nCands, (ABC_INT64_T)p->pPars->nBTLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
 //    assert( RetValue == l_False || RetValue == l_True );
@@ -147,6 +149,9 @@ p->timeGia += Abc_Clock() - clk;
         }
     }
     p->nCexes++;
+    // add the counter-example to the bank of patterns
+    if ( p->vSimPats )
+        Abc_NtkMfsSimAddCex( p );
     return 0;
 
 }
@@ -0,0 +1,292 @@
+/**CFile****************************************************************
+
+  FileName    [mfsSim.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [The good old minimization with complete don't-cares.]
+
+  Synopsis    [Simulation-based filtering of divisor sets.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: mfsSim.c,v 1.00 2026/10/18 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "mfsInt.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define MFS_SIM_WORDS   4
+
+static inline word * Abc_MfsSimObj( Mfs_Man_t * p, int Id )  { return Vec_WrdEntryP( p->vSimInfo, p->nSimWords * Id );                             }
+static inline word * Abc_MfsSimCo( Mfs_Man_t * p, int i )    { return Abc_MfsSimObj( p, Aig_ObjId(Aig_ManCo(p->pAigWin, i)) );                     }
+static inline word * Abc_MfsSimPat( Mfs_Man_t * p, Abc_Obj_t * pCi ) { return Vec_WrdEntryP( p->vSimPats, p->nSimWords * Vec_IntEntry(p->vSimCiIds, pCi->Id) ); }
+static inline int    Abc_MfsSimBit( word * pSim, int iPat )  { return (int)((pSim[iPat >> 6] >> (iPat & 63)) & 1);                              }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the bank of simulation patterns.]
+
+  Description [The bank contains a fixed number of patterns for each CI
+  of the network. It is filled with random patterns and persists across
+  the windows, while the patterns are gradually replaced by the input
+  assignments of the counter-examples produced by the SAT solver.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkMfsSimStart( Mfs_Man_t * p )
+{
+    Abc_Obj_t * pObj;
+    int i;
+    assert( p->vSimPats == NULL );
+    p->nSimWords = MFS_SIM_WORDS;
+    p->vSimCiIds = Vec_IntStartFull( Abc_NtkObjNumMax(p->pNtk) );
+    Abc_NtkForEachCi( p->pNtk, pObj, i )
+        Vec_IntWriteEntry( p->vSimCiIds, pObj->Id, i );
+    p->vSimPats = Vec_WrdStart( p->nSimWords * Abc_NtkCiNum(p->pNtk) );
+    Abc_RandomW( 1 );
+    for ( i = 0; i < Vec_WrdSize(p->vSimPats); i++ )
+        Vec_WrdWriteEntry( p->vSimPats, i, Abc_RandomW(0) );
+    p->vSimInfo = Vec_WrdAlloc( 1000 );
+    p->vSimKeys = Vec_IntAlloc( 100 );
+    memset( p->pSimOn,  0xFF, sizeof(int) * (1<<MFS_FANIN_MAX) );
+    memset( p->pSimOff, 0xFF, sizeof(int) * (1<<MFS_FANIN_MAX) );
+    p->iSimPat = 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the bank of simulation patterns.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkMfsSimStop( Mfs_Man_t * p )
+{
+    Vec_IntFreeP( &p->vSimCiIds );
+    Vec_WrdFreeP( &p->vSimPats );
+    Vec_WrdFreeP( &p->vSimInfo );
+    Vec_IntFreeP( &p->vSimKeys );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates the given words of the bank through the window AIG.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_NtkMfsSimWindowWords( Mfs_Man_t * p, int wStart, int wStop )
+{
+    Aig_Obj_t * pObj;
+    word * pSim, * pSim0, * pSim1, * pPat, Mask0, Mask1;
+    int i, w;
+    pSim = Abc_MfsSimObj( p, Aig_ObjId(Aig_ManConst1(p->pAigWin)) );
+    for ( w = wStart; w < wStop; w++ )
+        pSim[w] = ~(word)0;
+    Aig_ManForEachCi( p->pAigWin, pObj, i )
+    {
+        pSim = Abc_MfsSimObj( p, Aig_ObjId(pObj) );
+        pPat = Abc_MfsSimPat( p, (Abc_Obj_t *)Vec_PtrEntry(p->vSupp, i) );
+        for ( w = wStart; w < wStop; w++ )
+            pSim[w] = pPat[w];
+    }
+    Aig_ManForEachObj( p->pAigWin, pObj, i )
+    {
+        pSim = Abc_MfsSimObj( p, i );
+        if ( Aig_ObjIsNode(pObj) )
+        {
+            pSim0 = Abc_MfsSimObj( p, Aig_ObjFaninId0(pObj) );
+            pSim1 = Abc_MfsSimObj( p, Aig_ObjFaninId1(pObj) );
+            Mask0 = Aig_ObjFaninC0(pObj) ? ~(word)0 : 0;
+            Mask1 = Aig_ObjFaninC1(pObj) ? ~(word)0 : 0;
+            for ( w = wStart; w < wStop; w++ )
+                pSim[w] = (pSim0[w] ^ Mask0) & (pSim1[w] ^ Mask1);
+        }
+        else if ( Aig_ObjIsCo(pObj) )
+        {
+            pSim0 = Abc_MfsSimObj( p, Aig_ObjFaninId0(pObj) );
+            Mask0 = Aig_ObjFaninC0(pObj) ? ~(word)0 : 0;
+            for ( w = wStart; w < wStop; w++ )
+                pSim[w] = pSim0[w] ^ Mask0;
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates the bank of patterns through the window AIG.]
+
+  Description [Should be called after the window AIG is constructed
+  in the resubstitution mode (the last COs are the node and the divisors).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkMfsSimWindow( Mfs_Man_t * p )
+{
+    abctime clk = Abc_Clock();
+    assert( p->pPars->fResub );
+    assert( Aig_ManCoNum(p->pAigWin) >= 2 + Vec_PtrSize(p->vDivs) );
+    Vec_WrdFill( p->vSimInfo, p->nSimWords * Aig_ManObjNumMax(p->pAigWin), 0 );
+    Abc_NtkMfsSimWindowWords( p, 0, p->nSimWords );
+p->timeSim += Abc_Clock() - clk;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Looks for a counter-example among the simulation patterns.]
+
+  Description [Checks whether there is a pair of care patterns, one in
+  the on-set and one in the off-set of the node, which the given divisors
+  cannot distinguish. In this case, the set of divisors is infeasible and
+  the pair is recorded as a counter-example without calling the SAT solver.
+  Returns 1 if the counter-example is found.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkMfsSimFilter( Mfs_Man_t * p, int * pCands, int nCands )
+{
+    word * pDivs[MFS_FANIN_MAX], * pNode, * pSim, Care;
+    unsigned * pData;
+    int nDivs = Vec_PtrSize(p->vDivs);
+    int nCos = Aig_ManCoNum(p->pAigWin);
+    int i, k, w, b, Key, iPat, iPatOn = -1, iPatOff = -1;
+    abctime clk = Abc_Clock();
+    assert( nCands <= MFS_FANIN_MAX );
+    assert( nDivs == Vec_IntSize(p->vProjVarsSat) );
+    for ( k = 0; k < nCands; k++ )
+    {
+        i = lit_var( pCands[k] ) - 2 * p->pCnf->nVars;
+        assert( i >= 0 && i < nDivs );
+        pDivs[k] = Abc_MfsSimCo( p, nCos - nDivs + i );
+    }
+    pNode = Abc_MfsSimCo( p, nCos - nDivs - 1 );
+    // hash the care patterns by the values of the divisors
+    Vec_IntClear( p->vSimKeys );
+    for ( w = 0; w < p->nSimWords && iPatOn == -1; w++ )
+    {
+        Care = ~(word)0;
+        for ( i = 0; i < nCos - nDivs - 1; i++ )
+            Care &= Abc_MfsSimCo(p, i)[w];
+        for ( b = 0; Care && iPatOn == -1; b++, Care >>= 1 )
+        {
+            if ( !(Care & 1) )
+                continue;
+            Key = 0;
+            for ( k = 0; k < nCands; k++ )
+                Key |= (int)((pDivs[k][w] >> b) & 1) << k;
+            iPat = 64 * w + b;
+            if ( (pNode[w] >> b) & 1 )
+            {
+                if ( p->pSimOff[Key] >= 0 )
+                    iPatOn = iPat, iPatOff = p->pSimOff[Key];
+                else if ( p->pSimOn[Key] < 0 )
+                    p->pSimOn[Key] = iPat, Vec_IntPush( p->vSimKeys, Key );
+            }
+            else
+            {
+                if ( p->pSimOn[Key] >= 0 )
+                    iPatOn = p->pSimOn[Key], iPatOff = iPat;
+                else if ( p->pSimOff[Key] < 0 )
+                    p->pSimOff[Key] = iPat, Vec_IntPush( p->vSimKeys, Key );
+            }
+        }
+    }
+    Vec_IntForEachEntry( p->vSimKeys, Key, i )
+        p->pSimOn[Key] = p->pSimOff[Key] = -1;
+    if ( iPatOn == -1 )
+    {
+p->timeSim += Abc_Clock() - clk;
+        return 0;
+    }
+    // store the counter-example in the same way as the SAT solver does
+    for ( i = 0; i < nDivs; i++ )
+    {
+        pSim = Abc_MfsSimCo( p, nCos - nDivs + i );
+        if ( Abc_MfsSimBit(pSim, iPatOn) != Abc_MfsSimBit(pSim, iPatOff) )
+            continue;
+        pData = (unsigned *)Vec_PtrEntry( p->vDivCexes, i );
+        assert( Abc_InfoHasBit(pData, p->nCexes) );
+        Abc_InfoXorBit( pData, p->nCexes );
+    }
+    p->nCexes++;
+    p->nSimCexes++;
+p->timeSim += Abc_Clock() - clk;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the satisfying assignment to the bank of patterns.]
+
+  Description [The CI values of both copies of the window are added,
+  replacing the oldest patterns in the bank. The simulation info of the
+  window is updated for the affected words.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkMfsSimAddCex( Mfs_Man_t * p )
+{
+    Aig_Obj_t * pObj;
+    word * pPat;
+    int i, c, iVar, iPat;
+    abctime clk = Abc_Clock();
+    for ( c = 0; c < 2; c++ )
+    {
+        iPat = p->iSimPat;
+        p->iSimPat = (p->iSimPat + 1) % (64 * p->nSimWords);
+        Aig_ManForEachCi( p->pAigWin, pObj, i )
+        {
+            iVar = p->pCnf->pVarNums[Aig_ObjId(pObj)];
+            if ( iVar < 0 )
+                continue;
+            pPat = Abc_MfsSimPat( p, (Abc_Obj_t *)Vec_PtrEntry(p->vSupp, i) );
+            if ( Abc_MfsSimBit(pPat, iPat) != sat_solver_var_value(p->pSat, iVar + c * p->pCnf->nVars) )
+                pPat[iPat >> 6] ^= (word)1 << (iPat & 63);
+        }
+        Abc_NtkMfsSimWindowWords( p, iPat >> 6, (iPat >> 6) + 1 );
+    }
+p->timeSim += Abc_Clock() - clk;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
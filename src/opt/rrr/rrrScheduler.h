@@ -35,6 +35,7 @@ namespace rrr {
     int iSeed;
     int nFlow;
     int nJobs;
+    int nThreads;
     bool fMultiThreading;
     bool fPartitioning;
     bool fDeterministic;
@@ -46,6 +47,7 @@ namespace rrr {
     // data
     int nCreatedJobs;
     int nFinishedJobs;
+    double durationJobs;
     time_point timeStart;
     Par par;
     std::queue<Job *> qPendingJobs;
@@ -368,6 +370,7 @@ namespace rrr {
       func(pJob);
       AddToSummary(vStatsSummaryKeys, mStatsSummary, pJob->stats);
       AddToSummary(vTimesSummaryKeys, mTimesSummary, pJob->times);
+      durationJobs += pJob->duration;
       delete pJob;
       nFinishedJobs++;
       return;
@@ -381,6 +384,7 @@ namespace rrr {
     func(pJob);
     AddToSummary(vStatsSummaryKeys, mStatsSummary, pJob->stats);
     AddToSummary(vTimesSummaryKeys, mTimesSummary, pJob->times);
+    durationJobs += pJob->duration;
     delete pJob;
     nFinishedJobs++;
   }
@@ -451,6 +455,7 @@ namespace rrr {
     iSeed(pPar->iSeed),
     nFlow(pPar->nSchedulerFlow),
     nJobs(pPar->nJobs),
+    nThreads(pPar->nThreads),
     fMultiThreading(pPar->nThreads > 1),
     fPartitioning(pPar->nPartitionSize > 0),
     fDeterministic(pPar->fDeterministic),
@@ -459,6 +464,7 @@ namespace rrr {
     nTimeout(pPar->nTimeout),
     nCreatedJobs(0),
     nFinishedJobs(0),
+    durationJobs(0),
     par(pPar),
     pOpt(NULL) {
     // prepare cost function
@@ -510,9 +516,17 @@ namespace rrr {
     timeStart = GetCurrentTime();
     double costStart = CostFunction(pNtk);
     if(fPartitioning) {
-      fDeterministic = false; // it is deterministic anyways as we wait until all jobs finish each round
+      // partitions are extracted and inserted by this thread while the others are being optimized;
+      // in deterministic mode, partitions are inserted in the order of creation, so the sequence of
+      // extractions and insertions does not depend on the number of threads or their timing
       pNtk->Sweep();
       par.AssignNetwork(pNtk);
+      std::function<void(Job *)> OnPartitionEnd = [&](Job *pJob) {
+        double cost = CostFunction(pJob->pNtk);
+        Print(1, pJob->prefix, "finished", ":", "i/o", "=", pJob->pNtk->GetNumPis(), "/", pJob->pNtk->GetNumPos(), ",", "node", "=", pJob->pNtk->GetNumInts(), ",", "level", "=", pJob->pNtk->GetNumLevels(), ",", "cost", "=", cost);
+        Print(0, "", "job", pJob->id, "(", nFinishedJobs + 1, "/", nJobs, ")", ":", "i/o", "=", pJob->pNtk->GetNumPis(), "/", pJob->pNtk->GetNumPos(), ",", "node", "=", pJob->pNtk->GetNumInts(), ",", "level", "=", pJob->pNtk->GetNumLevels(), ",", "cost", "=", cost, "(", 100 * (cost - pJob->costInitial) / pJob->costInitial, "%", ")", ",", "duration", "=", pJob->duration, "s", ",", "elapsed", "=", GetElapsedTime(), "s");
+        par.Insert(pJob->pNtk);
+      };
       while(nCreatedJobs < nJobs) {
         assert(nParallelPartitions > 0);
         if(nCreatedJobs < nFinishedJobs + nParallelPartitions) {
@@ -527,30 +541,23 @@ namespace rrr {
           PrintWarning("failed to partition");
           break;
         }
-        while(nFinishedJobs < nCreatedJobs) {
-          OnJobEnd([&](Job *pJob) {
-            double cost = CostFunction(pJob->pNtk);
-            Print(1, pJob->prefix, "finished", ":", "i/o", "=", pJob->pNtk->GetNumPis(), "/", pJob->pNtk->GetNumPos(), ",", "node", "=", pJob->pNtk->GetNumInts(), ",", "level", "=", pJob->pNtk->GetNumLevels(), ",", "cost", "=", cost);
-            Print(0, "", "job", pJob->id, "(", nFinishedJobs + 1, "/", nJobs, ")", ":", "i/o", "=", pJob->pNtk->GetNumPis(), "/", pJob->pNtk->GetNumPos(), ",", "node", "=", pJob->pNtk->GetNumInts(), ",", "level", "=", pJob->pNtk->GetNumLevels(), ",", "cost", "=", cost, "(", 100 * (cost - pJob->costInitial) / pJob->costInitial, "%", ")", ",", "duration", "=", pJob->duration, "s", ",", "elapsed", "=", GetElapsedTime(), "s");
-            par.Insert(pJob->pNtk);
-          });
+        if(!fOptOnInsert) {
+          // insert one partition and try extracting again, instead of waiting for all of them
+          OnJobEnd(OnPartitionEnd);
+          continue;
         }
-        if(fOptOnInsert) {
-          time_point timeStartLocal = GetCurrentTime();
-          CallAbc(pNtk, std::string("&put; ") + pCompress2rs + "; dc2; &get");
-          time_point timeEndLocal = GetCurrentTime();
-          par.AssignNetwork(pNtk);
-          double cost = CostFunction(pNtk);
-          Print(0, "", "c2rs; dc2", ":", std::string(34, ' '), "node", "=", pNtk->GetNumInts(), ",", "level", "=", pNtk->GetNumLevels(), ",", "cost", "=", cost, "(", 100 * (cost - costStart) / costStart, "%", ")", ",", "duration", "=", Duration(timeStartLocal, timeEndLocal), "s", ",", "elapsed", "=", GetElapsedTime(), "s");
+        while(nFinishedJobs < nCreatedJobs) {
+          OnJobEnd(OnPartitionEnd);
         }
+        time_point timeStartLocal = GetCurrentTime();
+        CallAbc(pNtk, std::string("&put; ") + pCompress2rs + "; dc2; &get");
+        time_point timeEndLocal = GetCurrentTime();
+        par.AssignNetwork(pNtk);
+        double cost = CostFunction(pNtk);
+        Print(0, "", "c2rs; dc2", ":", std::string(34, ' '), "node", "=", pNtk->GetNumInts(), ",", "level", "=", pNtk->GetNumLevels(), ",", "cost", "=", cost, "(", 100 * (cost - costStart) / costStart, "%", ")", ",", "duration", "=", Duration(timeStartLocal, timeEndLocal), "s", ",", "elapsed", "=", GetElapsedTime(), "s");
       }
       while(nFinishedJobs < nCreatedJobs) {
-        OnJobEnd([&](Job *pJob) {
-          double cost = CostFunction(pJob->pNtk);
-          Print(1, pJob->prefix, "finished", ":", "i/o", "=", pJob->pNtk->GetNumPis(), "/", pJob->pNtk->GetNumPos(), ",", "node", "=", pJob->pNtk->GetNumInts(), ",", "level", "=", pJob->pNtk->GetNumLevels(), ",", "cost", "=", CostFunction(pJob->pNtk));
-          Print(0, "", "job", pJob->id, "(", nFinishedJobs + 1, "/", nJobs, ")", ":", "i/o", "=", pJob->pNtk->GetNumPis(), "/", pJob->pNtk->GetNumPos(), ",", "node", "=", pJob->pNtk->GetNumInts(), ",", "level", "=", pJob->pNtk->GetNumLevels(), ",", "cost", "=", cost, "(", 100 * (cost - pJob->costInitial) / pJob->costInitial, "%", ")", ",", "duration", "=", pJob->duration, "s", ",", "elapsed", "=", GetElapsedTime(), "s");
-          par.Insert(pJob->pNtk);
-        });
+        OnJobEnd(OnPartitionEnd);
       }
       if(fOptOnInsert) {
         CallAbc(pNtk, std::string("&put; ") + pCompress2rs + "; dc2; &get");
@@ -590,6 +597,10 @@ namespace rrr {
     for(std::string key: vTimesSummaryKeys) {
       Print(0, "\t", SW{30, true}, key, ":", mTimesSummary[key], "s", "(", 100 * mTimesSummary[key] / duration, "%", ")");
     }
+    if(fMultiThreading) {
+      // ratio of the time spent in jobs to the time available in all threads
+      Print(0, "", "threads", ":", nThreads, ",", "utilization", "=", 100 * durationJobs / (duration * nThreads), "%");
+    }
     Print(0, "", "end", ":", "cost", "=", cost, "(", 100 * (cost - costStart) / costStart, "%", ")", ",", "time", "=", duration, "s");
   }
 
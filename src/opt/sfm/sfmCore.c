@@ -208,6 +208,16 @@ finish:
             iNode, f, Sfm_ObjFanin(p, iNode, f), iVar, Vec_IntEntry(p->vDivs, iVar) );
         Kit_DsdPrintFromTruth( (unsigned *)&uTruth, Vec_IntSize(p->vDivIds) ); printf( "\n" );
     }
+    if ( p->fDeferUpdate )
+    {
+        // record the decision to be committed by the main thread
+        p->DecType     = 1;
+        p->DecFanin    = f;
+        p->DecFaninNew = iVar == -1 ? iVar : Vec_IntEntry(p->vDivs, iVar);
+        p->DecTruth    = uTruth;
+        Abc_TtCopy( p->DecTruths, p->pTruth, SFM_WORDS_MAX, 0 );
+        return 1;
+    }
     if ( iVar == -1 )
         p->nRemoves++;
     else
@@ -277,6 +287,12 @@ p->timeSat += Abc_Clock() - clk;
         if ( New > Old )
             return 0;
     }
+    if ( p->fDeferUpdate )
+    {
+        p->DecType  = 2;
+        p->DecTruth = uTruth;
+        return 1;
+    }
     p->nImproves++;
     if ( fSkipUpdate )
         return 0;
@@ -289,6 +305,7 @@ int Sfm_NodeResub( Sfm_Ntk_t * p, int iNode )
 {
     int i, iFanin;
     p->nNodesTried++;
+    p->DecType = 0;
     // prepare SAT solver
     if ( !Sfm_NtkCreateWindow( p, iNode, p->pPars->fVeryVerbose ) )
         return 0;
@@ -353,6 +370,248 @@ void Sfm_NtkPrint( Sfm_Ntk_t * p )
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Multi-threaded resubstitution.]
+
+  Description [The nodes are processed in batches. Each thread has its own
+  copy of the manager, which computes the windows, runs the SAT solver 
+  and records the decisions without updating the network. The decisions
+  are committed by the main thread in the order of node IDs. A decision
+  is rejected if its window (the TFI of the roots and divisors, the TFO,
+  and the roots) contains an object whose fanins or fanouts were changed 
+  by a decision committed earlier in the same batch. The rejected nodes 
+  and the improved nodes are tried again in the next batch. Because the 
+  node-to-thread assignment is fixed, the result does not depend on the 
+  thread scheduling. The batches are kept small to limit the conflicts,
+  so the same worker threads are reused for all of them.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Sfm_Job_t_ Sfm_Job_t;
+struct Sfm_Job_t_
+{
+    Sfm_Ntk_t *       pNtk;        // thread manager
+    Vec_Int_t *       vNodes;      // nodes to try
+    Vec_Int_t *       vRes;        // decisions and their windows
+    Vec_Wrd_t *       vTruths;     // truth tables of the decisions
+};
+int Sfm_NtkPerformJob( void * pArg )
+{
+    Sfm_Job_t * pJob = (Sfm_Job_t *)pArg;
+    Sfm_Ntk_t * p = pJob->pNtk;
+    int i, k, iNode;
+    Vec_IntClear( pJob->vRes );
+    Vec_WrdClear( pJob->vTruths );
+    Vec_IntForEachEntry( pJob->vNodes, iNode, i )
+    {
+        if ( !Sfm_NodeResub(p, iNode) )
+        {
+            Vec_IntPush( pJob->vRes, 0 );
+            continue;
+        }
+        assert( p->DecType > 0 );
+        Vec_IntPush( pJob->vRes, p->DecType );
+        Vec_IntPush( pJob->vRes, p->DecFanin );
+        Vec_IntPush( pJob->vRes, p->DecFaninNew );
+        Vec_IntPush( pJob->vRes, Vec_IntSize(p->vOrder) + Vec_IntSize(p->vTfo) + Vec_IntSize(p->vRoots) );
+        Vec_IntAppend( pJob->vRes, p->vOrder );
+        Vec_IntAppend( pJob->vRes, p->vTfo );
+        Vec_IntAppend( pJob->vRes, p->vRoots );
+        Vec_WrdPush( pJob->vTruths, p->DecTruth );
+        for ( k = 0; k < SFM_WORDS_MAX; k++ )
+            Vec_WrdPush( pJob->vTruths, p->DecTruths[k] );
+    }
+    return 1;
+}
+static inline int Sfm_NtkNextNode( Sfm_Ntk_t * p, int * piNext, int iStop, int * pCounterLarge )
+{
+    for ( ; *piNext < iStop; (*piNext)++ )
+    {
+        int iNode = *piNext;
+        if ( Sfm_ObjIsFixed( p, iNode ) )
+            continue;
+        if ( p->pPars->nDepthMax && Sfm_ObjLevel(p, iNode) > p->pPars->nDepthMax )
+            continue;
+        if ( Sfm_ObjFaninNum(p, iNode) > SFM_SUPP_MAX )
+        {
+            (*pCounterLarge)++;
+            continue;
+        }
+        if ( Sfm_ObjFanoutNum(p, iNode) == 0 )
+            continue;
+        return (*piNext)++;
+    }
+    return -1;
+}
+int Sfm_NtkPerformPar( Sfm_Ntk_t * p, int * pCounterLarge )
+{
+    Sfm_Par_t * pPars = p->pPars;
+    int nJobs  = Abc_MaxInt( 1, pPars->nProcs - 1 );
+    int nBatch = 64 * nJobs;
+    // the nodes of a batch are taken from different segments of the node range
+    // to make it less likely that their windows overlap
+    int nSegs  = Abc_MinInt( nBatch, Abc_MaxInt(1, p->nNodes / 100) );
+    int * pSegNext = ABC_ALLOC( int, nSegs );
+    int * pSegStop = ABC_ALLOC( int, nSegs );
+    Sfm_Job_t * pJobs   = ABC_CALLOC( Sfm_Job_t, nJobs );
+    Vec_Ptr_t * vJobs   = Vec_PtrAlloc( nJobs );
+    Util_ThPool_t * pPool = Util_ThPoolStart( Sfm_NtkPerformJob, pPars->nProcs );
+    Vec_Int_t * vBatch  = Vec_IntAlloc( nBatch );
+    Vec_Int_t * vRetry  = Vec_IntAlloc( 100 );
+    Vec_Int_t * vRetry2 = Vec_IntAlloc( 100 );
+    Vec_Int_t * vStamps = Vec_IntStart( p->nObjs );
+    Vec_Str_t * vDone   = Vec_StrStart( p->nObjs );
+    int * pPosRes = ABC_CALLOC( int, nJobs );
+    int * pPosTru = ABC_CALLOC( int, nJobs );
+    int i, k, iNode, iObj, fAdded, fStop = 0;
+    int nBatches = 0, nConflicts = 0, Counter = 0;
+    for ( k = 0; k < nSegs; k++ )
+    {
+        pSegNext[k] = p->nPis + (int)((word)p->nNodes * k / nSegs);
+        pSegStop[k] = p->nPis + (int)((word)p->nNodes * (k+1) / nSegs);
+    }
+    p->vModified = Vec_IntAlloc( 100 );
+    for ( k = 0; k < nJobs; k++ )
+    {
+        pJobs[k].pNtk    = Sfm_NtkDupThread( p );
+        pJobs[k].vNodes  = Vec_IntAlloc( nBatch / nJobs + 1 );
+        pJobs[k].vRes    = Vec_IntAlloc( 1000 );
+        pJobs[k].vTruths = Vec_WrdAlloc( 1000 );
+        Vec_PtrPush( vJobs, pJobs + k );
+    }
+    while ( !fStop )
+    {
+        // collect the batch starting with the nodes to be tried again
+        Vec_IntClear( vBatch );
+        Vec_IntClear( vRetry2 );
+        Vec_IntForEachEntry( vRetry, iNode, i )
+        {
+            if ( Sfm_ObjFanoutNum(p, iNode) == 0 )
+                continue;
+            if ( Vec_IntSize(vBatch) < nBatch )
+                Vec_IntPush( vBatch, iNode );
+            else
+                Vec_IntPush( vRetry2, iNode );
+        }
+        ABC_SWAP( Vec_Int_t *, vRetry, vRetry2 );
+        for ( fAdded = 1; fAdded && Vec_IntSize(vBatch) < nBatch; )
+            for ( fAdded = 0, k = 0; k < nSegs && Vec_IntSize(vBatch) < nBatch; k++ )
+                if ( (iNode = Sfm_NtkNextNode(p, pSegNext + k, pSegStop[k], pCounterLarge)) >= 0 )
+                {
+                    Vec_IntPush( vBatch, iNode );
+                    fAdded = 1;
+                }
+        if ( Vec_IntSize(vBatch) == 0 )
+            break;
+        Vec_IntSort( vBatch, 0 );
+        // solve the nodes
+        for ( k = 0; k < nJobs; k++ )
+            Vec_IntClear( pJobs[k].vNodes );
+        Vec_IntForEachEntry( vBatch, iNode, i )
+            Vec_IntPush( pJobs[i % nJobs].vNodes, iNode );
+        Util_ThPoolRun( pPool, vJobs );
+        nBatches++;
+        // commit the decisions
+        memset( pPosRes, 0, sizeof(int) * nJobs );
+        memset( pPosTru, 0, sizeof(int) * nJobs );
+        Vec_IntForEachEntry( vBatch, iNode, i )
+        {
+            Sfm_Job_t * pJob = pJobs + i % nJobs;
+            int * pRes = Vec_IntEntryP( pJob->vRes, pPosRes[i % nJobs] );
+            word * pTruths;
+            int fConflict;
+            if ( pRes[0] == 0 )
+            {
+                pPosRes[i % nJobs]++;
+                continue;
+            }
+            pPosRes[i % nJobs] += 4 + pRes[3];
+            pTruths = Vec_WrdEntryP( pJob->vTruths, pPosTru[i % nJobs] );
+            pPosTru[i % nJobs] += 1 + SFM_WORDS_MAX;
+            if ( fStop )
+                continue;
+            // check whether the window was changed by the earlier decisions
+            fConflict = (Vec_IntEntry(vStamps, iNode) == nBatches);
+            for ( k = 0; !fConflict && k < pRes[3]; k++ )
+                fConflict = (Vec_IntEntry(vStamps, pRes[4+k]) == nBatches);
+            if ( fConflict )
+            {
+                Vec_IntPush( vRetry, iNode );
+                nConflicts++;
+                continue;
+            }
+            // update the network
+            if ( pRes[0] == 1 )
+            {
+                if ( pRes[2] == -1 )
+                    p->nRemoves++;
+                else
+                    p->nResubs++;
+                Sfm_NtkUpdate( p, iNode, pRes[1], pRes[2], pTruths[0], pTruths + 1 );
+            }
+            else
+            {
+                p->nImproves++;
+                Vec_IntPush( p->vModified, iNode );
+                Vec_WrdWriteEntry( p->vTruths, iNode, pTruths[0] );
+                Sfm_TruthToCnf( pTruths[0], NULL, Sfm_ObjFaninNum(p, iNode), p->vCover, (Vec_Str_t *)Vec_WecEntry(p->vCnfs, iNode) );
+            }
+            Vec_IntForEachEntry( p->vModified, iObj, k )
+                Vec_IntWriteEntry( vStamps, iObj, nBatches );
+            Vec_IntClear( p->vModified );
+            // the node is tried again, similar to the single-threaded version
+            Vec_IntPush( vRetry, iNode );
+            if ( !Vec_StrEntry(vDone, iNode) )
+            {
+                Vec_StrWriteEntry( vDone, iNode, 1 );
+                Counter++;
+            }
+            if ( pPars->nNodesMax && Counter >= pPars->nNodesMax )
+                fStop = 1;
+        }
+    }
+    if ( pPars->fVerbose )
+        printf( "MFS used %d threads to process %d batches with %d conflicts.\n", nJobs, nBatches, nConflicts );
+    for ( k = 0; k < nJobs; k++ )
+    {
+        Sfm_Ntk_t * pNtk = pJobs[k].pNtk;
+        p->nNodesTried  += pNtk->nNodesTried;
+        p->nTotalDivs   += pNtk->nTotalDivs;
+        p->nSatCalls    += pNtk->nSatCalls;
+        p->nTimeOuts    += pNtk->nTimeOuts;
+        p->nMaxDivs     += pNtk->nMaxDivs;
+        p->nTryRemoves  += pNtk->nTryRemoves;
+        p->nTryResubs   += pNtk->nTryResubs;
+        p->nTryImproves += pNtk->nTryImproves;
+        p->timeWin      += pNtk->timeWin / nJobs;
+        p->timeDiv      += pNtk->timeDiv / nJobs;
+        p->timeCnf      += pNtk->timeCnf / nJobs;
+        p->timeSat      += pNtk->timeSat / nJobs;
+        Sfm_NtkFreeThread( pNtk );
+        Vec_IntFree( pJobs[k].vNodes );
+        Vec_IntFree( pJobs[k].vRes );
+        Vec_WrdFree( pJobs[k].vTruths );
+    }
+    Vec_IntFreeP( &p->vModified );
+    Util_ThPoolStop( pPool );
+    Vec_PtrFree( vJobs );
+    Vec_IntFree( vBatch );
+    Vec_IntFree( vRetry );
+    Vec_IntFree( vRetry2 );
+    Vec_IntFree( vStamps );
+    Vec_StrFree( vDone );
+    ABC_FREE( pSegNext );
+    ABC_FREE( pSegStop );
+    ABC_FREE( pPosRes );
+    ABC_FREE( pPosTru );
+    ABC_FREE( pJobs );
+    return Counter;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -382,6 +641,9 @@ int Sfm_NtkPerform( Sfm_Ntk_t * p, Sfm_Par_t * pPars )
 //    return 0;
     p->nTotalNodesBeg = Vec_WecSizeUsedLimits( &p->vFanins, Sfm_NtkPiNum(p), Vec_WecSize(&p->vFanins) - Sfm_NtkPoNum(p) );
     p->nTotalEdgesBeg = Vec_WecSizeSize(&p->vFanins) - Sfm_NtkPoNum(p);
+    if ( pPars->nProcs > 1 )
+        Counter = Sfm_NtkPerformPar( p, &CounterLarge );
+    else
     Sfm_NtkForEachNode( p, i )
     {
         if ( Sfm_ObjIsFixed( p, i ) )
@@ -129,6 +129,14 @@ struct Sfm_Ntk_t_
     word *            pTtElems[SFM_FANIN_MAX];
     word              pTruth[SFM_WORDS_MAX];
     word              pCube[SFM_WORDS_MAX];
+    // deferred update (multi-threaded mode)
+    Vec_Int_t *       vModified;   // objects modified by the update
+    int               fDeferUpdate;// record the decision without updating
+    int               DecType;     // decision type (0 = none; 1 = fanin change; 2 = new function)
+    int               DecFanin;    // the fanin index to be changed
+    int               DecFaninNew; // the new fanin (-1 if removed)
+    word              DecTruth;    // the new function
+    word              DecTruths[SFM_WORDS_MAX];
     // nodes
     int               nTotalNodesBeg;
     int               nTotalEdgesBeg;
@@ -222,6 +230,9 @@ extern int          Sfm_LibImplementGatesDelay( Sfm_Lib_t * p, int * pFanins, Mi
 /*=== sfmNtk.c ==========================================================*/
 extern Sfm_Ntk_t *  Sfm_ConstructNetwork( Vec_Wec_t * vFanins, int nPis, int nPos );
 extern void         Sfm_NtkPrepare( Sfm_Ntk_t * p );
+extern void         Sfm_NtkPrepareWindow( Sfm_Ntk_t * p );
+extern Sfm_Ntk_t *  Sfm_NtkDupThread( Sfm_Ntk_t * p );
+extern void         Sfm_NtkFreeThread( Sfm_Ntk_t * p );
 extern void         Sfm_NtkUpdate( Sfm_Ntk_t * p, int iNode, int f, int iFaninNew, word uTruth, word * pTruth );
 /*=== sfmSat.c ==========================================================*/
 extern int          Sfm_NtkWindowToSolver( Sfm_Ntk_t * p );
@@ -201,6 +201,10 @@ Sfm_Ntk_t * Sfm_NtkConstruct( Vec_Wec_t * vFanins, int nPis, int nPos, Vec_Str_t
 void Sfm_NtkPrepare( Sfm_Ntk_t * p )
 {
     p->nLevelMax = Vec_IntFindMax(&p->vLevels) + p->pPars->nGrowthLevel;
+    Sfm_NtkPrepareWindow( p );
+}
+void Sfm_NtkPrepareWindow( Sfm_Ntk_t * p )
+{
     p->vNodes    = Vec_IntAlloc( 1000 );
     p->vDivs     = Vec_IntAlloc( 100 );
     p->vRoots    = Vec_IntAlloc( 1000 );
@@ -249,6 +253,80 @@ void Sfm_NtkFree( Sfm_Ntk_t * p )
     Vec_IntFreeP( &p->vValues );
     Vec_WecFreeP( &p->vClauses );
     Vec_IntFreeP( &p->vFaninMap );
+    Vec_IntFreeP( &p->vModified );
+    if ( p->pSat  ) sat_solver_delete( p->pSat );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Creates a copy of the manager for one thread.]
+
+  Description [The copy shares the network structure, truth tables, 
+  CNFs and levels with the original manager, which are read-only while
+  the threads are running. It has its own traversal IDs, window 
+  buffers, SAT solver, and statistics. The network updates are deferred.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Sfm_Ntk_t * Sfm_NtkDupThread( Sfm_Ntk_t * p )
+{
+    Sfm_Ntk_t * pNew = ABC_ALLOC( Sfm_Ntk_t, 1 ); int i;
+    memcpy( pNew, p, sizeof(Sfm_Ntk_t) );
+    pNew->pPars = ABC_ALLOC( Sfm_Par_t, 1 );
+    memcpy( pNew->pPars, p->pPars, sizeof(Sfm_Par_t) );
+    pNew->pPars->fVerbose     = 0;
+    pNew->pPars->fVeryVerbose = 0;
+    // private arrays
+    memset( &pNew->vCounts,   0, sizeof(Vec_Int_t) );
+    memset( &pNew->vTravIds,  0, sizeof(Vec_Int_t) );
+    memset( &pNew->vTravIds2, 0, sizeof(Vec_Int_t) );
+    memset( &pNew->vId2Var,   0, sizeof(Vec_Int_t) );
+    memset( &pNew->vVar2Id,   0, sizeof(Vec_Int_t) );
+    Vec_IntFill( &pNew->vCounts,   p->nObjs,  0 );
+    Vec_IntFill( &pNew->vTravIds,  p->nObjs,  0 );
+    Vec_IntFill( &pNew->vTravIds2, p->nObjs,  0 );
+    Vec_IntFill( &pNew->vId2Var,   2*p->nObjs, -1 );
+    Vec_IntFill( &pNew->vVar2Id,   2*p->nObjs, -1 );
+    pNew->nTravIds  = 0;
+    pNew->nTravIds2 = 0;
+    pNew->vCover    = Vec_IntAlloc( 1 << 16 );
+    pNew->vModified = NULL;
+    pNew->fDeferUpdate = 1;
+    Sfm_NtkPrepareWindow( pNew );
+    for ( i = 0; i < SFM_FANIN_MAX; i++ )
+        pNew->pTtElems[i] = pNew->TtElems[i];
+    // statistics
+    pNew->nTryRemoves = pNew->nTryImproves = pNew->nTryResubs = 0;
+    pNew->nRemoves = pNew->nImproves = pNew->nResubs = 0;
+    pNew->nNodesTried = pNew->nTotalDivs = pNew->nSatCalls = pNew->nTimeOuts = pNew->nMaxDivs = 0;
+    pNew->timeWin = pNew->timeDiv = pNew->timeCnf = pNew->timeSat = pNew->timeOther = pNew->timeTotal = 0;
+    return pNew;
+}
+void Sfm_NtkFreeThread( Sfm_Ntk_t * p )
+{
+    ABC_FREE( p->pPars );
+    ABC_FREE( p->vCounts.pArray );
+    ABC_FREE( p->vTravIds.pArray );
+    ABC_FREE( p->vTravIds2.pArray );
+    ABC_FREE( p->vId2Var.pArray );
+    ABC_FREE( p->vVar2Id.pArray );
+    Vec_IntFree( p->vCover );
+    Vec_IntFreeP( &p->vNodes );
+    Vec_IntFreeP( &p->vDivs  );
+    Vec_IntFreeP( &p->vRoots );
+    Vec_IntFreeP( &p->vTfo   );
+    Vec_WrdFreeP( &p->vDivCexes );
+    Vec_IntFreeP( &p->vOrder );
+    Vec_IntFreeP( &p->vDivVars );
+    Vec_IntFreeP( &p->vDivIds );
+    Vec_IntFreeP( &p->vLits  );
+    Vec_IntFreeP( &p->vValues );
+    Vec_WecFreeP( &p->vClauses );
+    Vec_IntFreeP( &p->vFaninMap );
     if ( p->pSat  ) sat_solver_delete( p->pSat );
     ABC_FREE( p );
 }
@@ -288,6 +366,8 @@ void Sfm_NtkAddFanin( Sfm_Ntk_t * p, int iNode, int iFanin )
 void Sfm_NtkDeleteObj_rec( Sfm_Ntk_t * p, int iNode )
 {
     int i, iFanin;
+    if ( p->vModified )
+        Vec_IntPush( p->vModified, iNode );
     if ( Sfm_ObjFanoutNum(p, iNode) > 0 || Sfm_ObjIsPi(p, iNode) || Sfm_ObjIsFixed(p, iNode) )
         return;
     assert( Sfm_ObjIsNode(p, iNode) );
@@ -326,6 +406,14 @@ void Sfm_NtkUpdate( Sfm_Ntk_t * p, int iNode, int f, int iFaninNew, word uTruth,
     assert( Sfm_ObjIsNode(p, iNode) );
     assert( iFanin != iFaninNew );
     assert( Sfm_ObjFaninNum(p, iNode) <= SFM_FANIN_MAX );
+    // remember the objects whose fanins or fanouts are changed
+    if ( p->vModified )
+    {
+        Vec_IntPush( p->vModified, iNode );
+        Vec_IntPush( p->vModified, iFanin );
+        if ( iFaninNew >= 0 )
+            Vec_IntPush( p->vModified, iFaninNew );
+    }
     if ( Abc_TtIsConst0(pTruth, nWords) || Abc_TtIsConst1(pTruth, nWords) )
     {
         Sfm_ObjForEachFanin( p, iNode, iFanin, f )
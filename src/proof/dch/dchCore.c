@@ -57,6 +57,7 @@ void Dch_ManSetDefaultParams( Dch_Pars_t * p )
     p->fVerbose       =     0;  // verbose stats
     p->nNodesAhead    =  1000;  // the lookahead in terms of nodes
     p->nCallsRecycle  =   100;  // calls to perform before recycling SAT solver
+    p->nProcs         =     1;  // the number of threads solving the candidates
 }
 
 /**Function*************************************************************
@@ -101,6 +102,9 @@ clk = Abc_Clock();
 p->timeSimInit = Abc_Clock() - clk;
 //    Dch_ClassesPrint( p->ppClasses, 0 );
     p->nLits = Dch_ClassesLitNum( p->ppClasses );
+    // solve the candidate pairs in parallel
+    if ( pPars->nProcs > 1 )
+        Dch_ManSolvePar( p );
     // perform SAT sweeping
     Dch_ManSweep( p );
     // free memory ahead of time
@@ -147,6 +151,9 @@ clk = Abc_Clock();
 p->timeSimInit = Abc_Clock() - clk;
 //    Dch_ClassesPrint( p->ppClasses, 0 );
     p->nLits = Dch_ClassesLitNum( p->ppClasses );
+    // solve the candidate pairs in parallel
+    if ( pPars->nProcs > 1 )
+        Dch_ManSolvePar( p );
     // perform SAT sweeping
     Dch_ManSweep( p );
     // free memory ahead of time
@@ -92,8 +92,10 @@ void Dch_ManPrintStats( Dch_Man_t * p )
     Abc_Print( 1, "Choices   : Lits = %6d. Reprs = %5d. Equivs = %5d. Choices = %5d.\n", 
         p->nLits, p->nReprs, p->nEquivs, p->nChoices );
     Abc_Print( 1, "Choicing runtime statistics:\n" );
-    p->timeOther = p->timeTotal-p->timeSimInit-p->timeSimSat-p->timeSat-p->timeChoice;
+    p->timeOther = p->timeTotal-p->timeSimInit-p->timeSimSat-p->timePar-p->timeSat-p->timeChoice;
     Abc_PrintTimeP( 1, "Sim init   ", p->timeSimInit,  p->timeTotal );
+    if ( p->timePar )
+    Abc_PrintTimeP( 1, "SAT threads", p->timePar,      p->timeTotal );
     Abc_PrintTimeP( 1, "Sim SAT    ", p->timeSimSat,   p->timeTotal );
     Abc_PrintTimeP( 1, "SAT solving", p->timeSat,      p->timeTotal );
     Abc_PrintTimeP( 1, "  sat      ", p->timeSatSat,   p->timeTotal );
@@ -135,6 +137,7 @@ void Dch_ManStop( Dch_Man_t * p )
     Vec_PtrFree( p->vSimRoots );
     Vec_PtrFree( p->vSimClasses );
     ABC_FREE( p->pReprsProved );
+    ABC_FREE( p->pReprsPar );
     ABC_FREE( p->pSatVars );
     ABC_FREE( p );
 }
@@ -0,0 +1,263 @@
+/**CFile****************************************************************
+
+  FileName    [dchPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Choice computation for tech-mapping.]
+
+  Synopsis    [Solving candidate equivalences by several threads.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: dchPar.c,v 1.00 2026/10/18 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "dchInt.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the number of simulation words used to refine classes with counter-examples
+#define DCH_PAR_WORDS  64
+
+// one chunk of candidate pairs solved by a thread
+typedef struct Dch_ParJob_t_ Dch_ParJob_t;
+struct Dch_ParJob_t_
+{
+    Dch_Man_t *      p;              // the choicing manager (read-only)
+    Vec_Ptr_t *      vPairs;         // candidate pairs (node, repr)
+    int              iStart;         // the first pair of this job
+    int              iStop;          // the last pair of this job
+    Vec_Int_t *      vStatus;        // the status of the pairs (1 = proved, 0 = disproved, -1 = undecided)
+    Vec_Int_t *      vCexes;         // CIs assigned to 1 by each counter-example (separated by -1)
+    int              nSatCallsSat;   // the number of disproved pairs
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Solves one chunk of candidate pairs.]
+
+  Description [The thread uses its own SAT solver, loaded with the CNF
+  of the cones of the candidates in the original AIG, which is not
+  modified. Consecutive pairs tend to share the logic cones, which is
+  why the solver is reused for the whole chunk.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Dch_ManSolveParJob( void * pArg )
+{
+    Dch_ParJob_t * pJob = (Dch_ParJob_t *)pArg;
+    Dch_Man_t * p = pJob->p, * pThis;
+    Aig_Obj_t * pObj, * pRepr, * pCi;
+    int i, k, RetValue, nVarNum;
+    // the manager of this thread sharing the AIG
+    pThis = ABC_CALLOC( Dch_Man_t, 1 );
+    pThis->pPars      = p->pPars;
+    pThis->pAigTotal  = p->pAigTotal;
+    pThis->pAigFraig  = p->pAigTotal;
+    pThis->nSatVars   = 1;
+    pThis->pSatVars   = ABC_CALLOC( int, Aig_ManObjNumMax(p->pAigTotal) );
+    pThis->vUsedNodes = Vec_PtrAlloc( 1000 );
+    pThis->vFanins    = Vec_PtrAlloc( 100 );
+    for ( i = pJob->iStart; i < pJob->iStop; i++ )
+    {
+        pObj  = (Aig_Obj_t *)Vec_PtrEntry( pJob->vPairs, 2*i );
+        pRepr = (Aig_Obj_t *)Vec_PtrEntry( pJob->vPairs, 2*i+1 );
+        RetValue = Dch_NodesAreEquiv( pThis, pRepr, pObj );
+        Vec_IntPush( pJob->vStatus, RetValue );
+        if ( RetValue != 0 )
+            continue;
+        // save the counter-example
+        Aig_ManForEachCi( p->pAigTotal, pCi, k )
+        {
+            nVarNum = Dch_ObjSatNum( pThis, pCi );
+            if ( nVarNum && sat_solver_var_value( pThis->pSat, nVarNum ) )
+                Vec_IntPush( pJob->vCexes, k );
+        }
+        Vec_IntPush( pJob->vCexes, -1 );
+    }
+    pJob->nSatCallsSat = pThis->nSatCallsSat;
+    if ( pThis->pSat )
+        sat_solver_delete( pThis->pSat );
+    Vec_PtrFree( pThis->vUsedNodes );
+    Vec_PtrFree( pThis->vFanins );
+    ABC_FREE( pThis->pSatVars );
+    ABC_FREE( pThis );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Refines the classes using the given counter-examples.]
+
+  Description [Each counter-example is the list of CIs assigned to 1,
+  terminated by -1. The patterns are simulated in groups of 32 *
+  DCH_PAR_WORDS at a time. Any input pattern is a valid witness for
+  the refinement, so the unused bits of the last group are left zero.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Dch_ManRefineWithCexes( Dch_Man_t * p, Vec_Int_t * vCexes )
+{
+    Vec_Ptr_t * vSims, * vRoots;
+    Aig_Obj_t * pObj;
+    unsigned * pSim;
+    int i, k, iCi, iPat = 0, nRefis = 0, RetValue;
+    vSims  = Vec_PtrAllocSimInfo( Aig_ManObjNumMax(p->pAigTotal), DCH_PAR_WORDS );
+    vRoots = Vec_PtrAlloc( 1000 );
+    Aig_ManForEachCi( p->pAigTotal, pObj, i )
+        memset( Vec_PtrEntry(vSims, pObj->Id), 0, sizeof(unsigned) * DCH_PAR_WORDS );
+    Dch_ClassesSetData( p->ppClasses, vSims, Dch_NodeHash, Dch_NodeIsConst, Dch_NodesAreEqual );
+    for ( i = 0; i < Vec_IntSize(vCexes); i++ )
+    {
+        iCi = Vec_IntEntry( vCexes, i );
+        if ( iCi >= 0 )
+        {
+            pSim = (unsigned *)Vec_PtrEntry( vSims, Aig_ManCi(p->pAigTotal, iCi)->Id );
+            Abc_InfoSetBit( pSim, iPat );
+            continue;
+        }
+        if ( ++iPat < 32 * DCH_PAR_WORDS && i < Vec_IntSize(vCexes) - 1 )
+            continue;
+        // simulate the patterns collected so far (the unused ones are all-zero)
+        iPat = 0;
+        Dch_PerformSimulation( p->pAigTotal, vSims );
+        // refine the constant candidates
+        Vec_PtrClear( vRoots );
+        Aig_ManForEachObj( p->pAigTotal, pObj, k )
+            if ( Dch_ObjIsConst1Cand( p->pAigTotal, pObj ) )
+                Vec_PtrPush( vRoots, pObj );
+        nRefis += Dch_ClassesRefineConst1Group( p->ppClasses, vRoots, 1 );
+        // refine the classes until convergence
+        while ( (RetValue = Dch_ClassesRefine( p->ppClasses )) )
+            nRefis += RetValue;
+        // clean the patterns
+        Aig_ManForEachCi( p->pAigTotal, pObj, k )
+            memset( Vec_PtrEntry(vSims, pObj->Id), 0, sizeof(unsigned) * DCH_PAR_WORDS );
+    }
+    Dch_ClassesSetData( p->ppClasses, NULL, NULL, Dch_NodeIsConstCex, Dch_NodesAreEqualCex );
+    Vec_PtrFree( vRoots );
+    Vec_PtrFree( vSims );
+    return nRefis;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the candidate equivalences using several threads.]
+
+  Description [Before the sequential SAT sweeping, the candidate pairs
+  (each node and the representative of its class) are distributed among
+  the threads, which solve them on the original AIG. The proved pairs are
+  recorded, so that the sweeping does not call the SAT solver for them.
+  The counter-examples of the disproved pairs are simulated together to
+  refine the candidate classes. Since the results are merged after all
+  threads have finished, the outcome does not depend on the scheduling.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dch_ManSolvePar( Dch_Man_t * p )
+{
+    Vec_Ptr_t * vPairs, * vJobs;
+    Vec_Int_t * vCexes;
+    Dch_ParJob_t * pJob;
+    Aig_Obj_t * pObj, * pRepr;
+    int i, k, nJobs, nPairs, nProved = 0, nDisproved = 0, nRefis;
+    abctime clk = Abc_Clock();
+    assert( p->pReprsPar == NULL );
+    // collect the candidate pairs
+    vPairs = Vec_PtrAlloc( 1000 );
+    Aig_ManForEachNode( p->pAigTotal, pObj, i )
+    {
+        pRepr = Aig_ObjRepr( p->pAigTotal, pObj );
+        if ( pRepr == NULL )
+            continue;
+        Vec_PtrPush( vPairs, pObj );
+        Vec_PtrPush( vPairs, pRepr );
+    }
+    nPairs = Vec_PtrSize(vPairs) / 2;
+    if ( nPairs == 0 )
+    {
+        Vec_PtrFree( vPairs );
+        return;
+    }
+    // create the jobs
+    nJobs = Abc_MinInt( 4 * p->pPars->nProcs, nPairs );
+    vJobs = Vec_PtrAlloc( nJobs );
+    for ( k = 0; k < nJobs; k++ )
+    {
+        pJob = ABC_CALLOC( Dch_ParJob_t, 1 );
+        pJob->p       = p;
+        pJob->vPairs  = vPairs;
+        pJob->iStart  = (int)((ABC_INT64_T)nPairs * k / nJobs);
+        pJob->iStop   = (int)((ABC_INT64_T)nPairs * (k + 1) / nJobs);
+        pJob->vStatus = Vec_IntAlloc( pJob->iStop - pJob->iStart );
+        pJob->vCexes  = Vec_IntAlloc( 1000 );
+        Vec_PtrPush( vJobs, pJob );
+    }
+    Util_ProcessThreads( Dch_ManSolveParJob, vJobs, p->pPars->nProcs, 0, 0 );
+    // merge the results in the order of the pairs
+    p->pReprsPar = ABC_CALLOC( Aig_Obj_t *, Aig_ManObjNumMax(p->pAigTotal) );
+    vCexes = Vec_IntAlloc( 1000 );
+    Vec_PtrForEachEntry( Dch_ParJob_t *, vJobs, pJob, k )
+    {
+        for ( i = pJob->iStart; i < pJob->iStop; i++ )
+        {
+            if ( Vec_IntEntry(pJob->vStatus, i - pJob->iStart) != 1 )
+                continue;
+            pObj  = (Aig_Obj_t *)Vec_PtrEntry( vPairs, 2*i );
+            pRepr = (Aig_Obj_t *)Vec_PtrEntry( vPairs, 2*i+1 );
+            p->pReprsPar[pObj->Id] = pRepr;
+            nProved++;
+        }
+        nDisproved += pJob->nSatCallsSat;
+        Vec_IntAppend( vCexes, pJob->vCexes );
+        Vec_IntFree( pJob->vStatus );
+        Vec_IntFree( pJob->vCexes );
+        ABC_FREE( pJob );
+    }
+    Vec_PtrFree( vJobs );
+    Vec_PtrFree( vPairs );
+    // refine the classes
+    nRefis = Dch_ManRefineWithCexes( p, vCexes );
+    Vec_IntFree( vCexes );
+    p->nLits = Dch_ClassesLitNum( p->ppClasses );
+    p->timePar = Abc_Clock() - clk;
+    if ( p->pPars->fVerbose )
+    {
+        Abc_Print( 1, "Parallel SAT: Pairs = %d. Proved = %d. Disproved = %d. Undecided = %d. Refined = %d. Lits = %d. ",
+            nPairs, nProved, nDisproved, nPairs - nProved - nDisproved, nRefis, p->nLits );
+        Abc_PrintTime( 1, "Time", p->timePar );
+    }
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -189,7 +189,7 @@ int Dch_NodesAreEqual( void * p, Aig_Obj_t * pObj0, Aig_Obj_t * pObj1 )
 
 /**Function*************************************************************
 
-  Synopsis    [Perform random simulation.]
+  Synopsis    [Simulates the AIG using the given CI patterns.]
 
   Description []
                
@@ -198,7 +198,7 @@ int Dch_NodesAreEqual( void * p, Aig_Obj_t * pObj0, Aig_Obj_t * pObj1 )
   SeeAlso     []
 
 ***********************************************************************/
-void Dch_PerformRandomSimulation( Aig_Man_t * pAig, Vec_Ptr_t * vSims )
+void Dch_PerformSimulation( Aig_Man_t * pAig, Vec_Ptr_t * vSims )
 {
     unsigned * pSim, * pSim0, * pSim1;
     Aig_Obj_t * pObj;
@@ -210,15 +210,6 @@ void Dch_PerformRandomSimulation( Aig_Man_t * pAig, Vec_Ptr_t * vSims )
     pSim = Dch_ObjSim( vSims, pObj );
     memset( pSim, 0xff, sizeof(unsigned) * nWords );
 
-    // assign primary input random sim info
-    Aig_ManForEachCi( pAig, pObj, i )
-    {
-        pSim = Dch_ObjSim( vSims, pObj );
-        for ( k = 0; k < nWords; k++ )
-            pSim[k] = Dch_ObjRandomSim();
-        pSim[0] <<= 1;
-    }
-
     // simulate AIG in the topological order
     Aig_ManForEachNode( pAig, pObj, i )
     {
@@ -250,6 +241,35 @@ void Dch_PerformRandomSimulation( Aig_Man_t * pAig, Vec_Ptr_t * vSims )
     // get simulation information for primary outputs
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Perform random simulation.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dch_PerformRandomSimulation( Aig_Man_t * pAig, Vec_Ptr_t * vSims )
+{
+    unsigned * pSim;
+    Aig_Obj_t * pObj;
+    int i, k, nWords;
+    nWords = (unsigned *)Vec_PtrEntry(vSims, 1) - (unsigned *)Vec_PtrEntry(vSims, 0);
+
+    // assign primary input random sim info
+    Aig_ManForEachCi( pAig, pObj, i )
+    {
+        pSim = Dch_ObjSim( vSims, pObj );
+        for ( k = 0; k < nWords; k++ )
+            pSim[k] = Dch_ObjRandomSim();
+        pSim[0] <<= 1;
+    }
+    Dch_PerformSimulation( pAig, vSims );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Derives candidate equivalence classes of AIG nodes.]
@@ -70,7 +70,11 @@ void Dch_ManSweepNode( Dch_Man_t * p, Aig_Obj_t * pObj )
         return;
     }
     assert( Aig_Regular(pObjFraig) != Aig_ManConst1(p->pAigFraig) );
-    RetValue = Dch_NodesAreEquiv( p, Aig_Regular(pObjReprFraig), Aig_Regular(pObjFraig) );
+    // skip the SAT call if the pair was proved by the threads
+    if ( p->pReprsPar && p->pReprsPar[pObj->Id] == pObjRepr )
+        RetValue = 1;
+    else
+        RetValue = Dch_NodesAreEquiv( p, Aig_Regular(pObjReprFraig), Aig_Regular(pObjFraig) );
     if ( RetValue == -1 ) // timed out
     {
         Dch_ObjSetFraig( pObj, NULL );